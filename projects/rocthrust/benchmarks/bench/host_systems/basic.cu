@@ -0,0 +1,225 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+#if defined(ROCTHRUST_BENCHMARK_HAS_OMP)
+#  include <thrust/system/omp/execution_policy.h>
+#endif
+#if defined(ROCTHRUST_BENCHMARK_HAS_TBB)
+#  include <thrust/system/tbb/execution_policy.h>
+#endif
+#if defined(ROCTHRUST_BENCHMARK_HAS_STDPAR)
+#  include <thrust/system/stdpar/execution_policy.h>
+#endif
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the host systems on the same algorithms and data. The systems
+// which weren't found when configuring are left out.
+struct reduce
+{
+    static constexpr const char* name = "reduce";
+
+    template <class Policy, class T>
+    void run(const Policy& policy, const thrust::host_vector<T>& input, thrust::host_vector<T>& output)
+    {
+        output[0] = thrust::reduce(policy, input.begin(), input.end());
+    }
+};
+
+struct inclusive_scan
+{
+    static constexpr const char* name = "inclusive_scan";
+
+    template <class Policy, class T>
+    void run(const Policy& policy, const thrust::host_vector<T>& input, thrust::host_vector<T>& output)
+    {
+        thrust::inclusive_scan(policy, input.begin(), input.end(), output.begin());
+    }
+};
+
+struct exclusive_scan
+{
+    static constexpr const char* name = "exclusive_scan";
+
+    template <class Policy, class T>
+    void run(const Policy& policy, const thrust::host_vector<T>& input, thrust::host_vector<T>& output)
+    {
+        thrust::exclusive_scan(policy, input.begin(), input.end(), output.begin());
+    }
+};
+
+struct sort
+{
+    static constexpr const char* name = "sort";
+
+    template <class Policy, class T>
+    void run(const Policy& policy, const thrust::host_vector<T>& input, thrust::host_vector<T>& output)
+    {
+        output = input;
+        thrust::sort(policy, output.begin(), output.end());
+    }
+};
+
+template <class Benchmark, class Policy, class T>
+void run_benchmark(benchmark::State& state,
+                   const Policy      policy,
+                   const std::size_t elements,
+                   const std::string seed_type)
+{
+    // Benchmark object
+    Benchmark benchmark {};
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    const bench_utils::managed_seed seed {seed_type};
+
+    std::default_random_engine       engine(seed.get_0());
+    std::uniform_int_distribution<T> distribution(0, 1 << 20);
+
+    thrust::host_vector<T> input(elements);
+    for(std::size_t i = 0; i < elements; ++i)
+    {
+        input[i] = distribution(engine);
+    }
+    thrust::host_vector<T> output(elements);
+
+    // Warm up
+    benchmark.run(policy, input, output);
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        benchmark.run(policy, input, output);
+        const auto stop = std::chrono::high_resolution_clock::now();
+
+        const float64_t duration = std::chrono::duration<float64_t>(stop - start).count();
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    state.SetBytesProcessed(state.iterations() * elements * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * elements);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(T, Elements)                                                            \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                         \
+                                     std::string("{algo:") + Benchmark::name + ",subalgo:"       \
+                                     + system + ",input_type:" #T + ",elements:" #Elements)      \
+                                     .c_str(),                                                   \
+                                 run_benchmark<Benchmark, Policy, T>,                            \
+                                 policy,                                                         \
+                                 Elements,                                                       \
+                                 seed_type)
+
+template <class Benchmark, class Policy>
+void add_benchmarks(const std::string&                            system,
+                    const Policy&                                 policy,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = { CREATE_BENCHMARK(int, 1 << 16),
+                                                        CREATE_BENCHMARK(int, 1 << 20),
+                                                        CREATE_BENCHMARK(int, 1 << 24),
+                                                        CREATE_BENCHMARK(long long, 1 << 24) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+template <class Policy>
+void add_system_benchmarks(const std::string&                            system,
+                           const Policy&                                 policy,
+                           std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                           const std::string                             seed_type)
+{
+    add_benchmarks<reduce>(system, policy, benchmarks, seed_type);
+    add_benchmarks<inclusive_scan>(system, policy, benchmarks, seed_type);
+    add_benchmarks<exclusive_scan>(system, policy, benchmarks, seed_type);
+    add_benchmarks<sort>(system, policy, benchmarks, seed_type);
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_system_benchmarks("cpp", thrust::cpp::par, benchmarks, seed_type);
+#if defined(ROCTHRUST_BENCHMARK_HAS_OMP)
+    add_system_benchmarks("omp", thrust::omp::par, benchmarks, seed_type);
+#endif
+#if defined(ROCTHRUST_BENCHMARK_HAS_TBB)
+    add_system_benchmarks("tbb", thrust::tbb::par, benchmarks, seed_type);
+#endif
+#if defined(ROCTHRUST_BENCHMARK_HAS_STDPAR)
+    add_system_benchmarks("stdpar", thrust::stdpar::par, benchmarks, seed_type);
+#endif
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
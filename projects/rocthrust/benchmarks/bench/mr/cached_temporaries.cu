@@ -0,0 +1,191 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measures the iterations of an iterative solver on the host, which sort data
+// of the same size in every iteration. The temporary storage of the sorts is
+// obtained from the system in every iteration by default, and from the cache
+// of the system with with_cached_temporaries otherwise.
+struct default_temporaries
+{
+    template <typename T>
+    float64_t run(const std::vector<thrust::host_vector<T>>& iterations, thrust::host_vector<T>& data)
+    {
+        float64_t duration = 0;
+        for(const auto& iteration : iterations)
+        {
+            data = iteration;
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            thrust::stable_sort(thrust::cpp::par, data.begin(), data.end());
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            duration += std::chrono::duration<float64_t>(stop - start).count();
+        }
+        return duration;
+    }
+};
+
+struct cached_temporaries
+{
+    template <typename T>
+    float64_t run(const std::vector<thrust::host_vector<T>>& iterations, thrust::host_vector<T>& data)
+    {
+        float64_t duration = 0;
+        for(const auto& iteration : iterations)
+        {
+            data = iteration;
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            thrust::stable_sort(thrust::cpp::par.with_cached_temporaries(), data.begin(), data.end());
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            duration += std::chrono::duration<float64_t>(stop - start).count();
+        }
+        return duration;
+    }
+};
+
+template <class Benchmark, class T>
+void run_benchmark(benchmark::State& state,
+                   const std::size_t elements,
+                   const std::string seed_type,
+                   const std::size_t iterations)
+{
+    // Benchmark object
+    Benchmark benchmark {};
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    const bench_utils::managed_seed seed {seed_type};
+
+    std::default_random_engine       engine(seed.get_0());
+    std::uniform_int_distribution<T> distribution;
+
+    // Generate the data of every iteration
+    std::vector<thrust::host_vector<T>> inputs(iterations, thrust::host_vector<T>(elements));
+    for(auto& input : inputs)
+    {
+        for(std::size_t i = 0; i < elements; ++i)
+        {
+            input[i] = distribution(engine);
+        }
+    }
+
+    thrust::host_vector<T> data(elements);
+
+    // Warm up
+    benchmark.run(inputs, data);
+
+    for(auto _ : state)
+    {
+        float64_t duration = benchmark.run(inputs, data);
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    state.SetBytesProcessed(state.iterations() * iterations * elements * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * iterations * elements);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(T, Elements, Iterations)                                                \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                         \
+                                     "{algo:mr,subalgo:" + name + ",input_type:" #T              \
+                                     + ",elements:" #Elements ",iterations:" #Iterations)        \
+                                     .c_str(),                                                   \
+                                 run_benchmark<Benchmark, T>,                                    \
+                                 Elements,                                                       \
+                                 seed_type,                                                      \
+                                 Iterations)
+
+template <class Benchmark>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = { CREATE_BENCHMARK(int, 1 << 10, 64),
+                                                        CREATE_BENCHMARK(int, 1 << 14, 64),
+                                                        CREATE_BENCHMARK(int, 1 << 18, 16),
+                                                        CREATE_BENCHMARK(int, 1 << 22, 4) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks<default_temporaries>("default_temporaries", benchmarks, seed_type);
+    add_benchmarks<cached_temporaries>("cached_temporaries", benchmarks, seed_type);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,220 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/mr/concurrent_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/sync_pool.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Every thread keeps a window of live allocations; each step frees the oldest
+// one and allocates a new one of a random size, like a host algorithm that
+// allocates temporaries of varying sizes from many threads.
+struct churn
+{
+    static constexpr std::size_t live_allocations = 64;
+
+    template <typename Resource>
+    float64_t run(Resource&                                     resource,
+                  const std::vector<std::vector<std::size_t>>& sizes)
+    {
+        const std::size_t num_threads = sizes.size();
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for(std::size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(
+                [&resource, &sizes, t]
+                {
+                    const std::vector<std::size_t>& my_sizes = sizes[t];
+
+                    void*       blocks[live_allocations] = {};
+                    std::size_t block_sizes[live_allocations] = {};
+
+                    for(std::size_t i = 0; i < my_sizes.size(); ++i)
+                    {
+                        const std::size_t slot = i % live_allocations;
+                        if(blocks[slot])
+                        {
+                            resource.do_deallocate(blocks[slot], block_sizes[slot]);
+                        }
+                        blocks[slot]      = resource.do_allocate(my_sizes[i]);
+                        block_sizes[slot] = my_sizes[i];
+                        benchmark::DoNotOptimize(blocks[slot]);
+                    }
+
+                    for(std::size_t slot = 0; slot < live_allocations; ++slot)
+                    {
+                        if(blocks[slot])
+                        {
+                            resource.do_deallocate(blocks[slot], block_sizes[slot]);
+                        }
+                    }
+                });
+        }
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto stop = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<float64_t>(stop - start).count();
+    }
+};
+
+template <class Benchmark, template <typename> class Pool>
+void run_benchmark(benchmark::State& state,
+                   const std::size_t elements,
+                   const std::string seed_type,
+                   const std::size_t num_threads,
+                   const std::size_t max_bytes)
+{
+    // Benchmark object
+    Benchmark benchmark {};
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    // Generate the allocation sizes of every thread; elements is the number of
+    // allocations made by each thread
+    const bench_utils::managed_seed seed {seed_type};
+
+    std::vector<std::vector<std::size_t>> sizes(num_threads);
+    for(std::size_t t = 0; t < num_threads; ++t)
+    {
+        std::default_random_engine                 engine(seed.get_0() + t);
+        std::uniform_int_distribution<std::size_t> distribution(1, max_bytes);
+
+        sizes[t].resize(elements);
+        for(std::size_t& size : sizes[t])
+        {
+            size = distribution(engine);
+        }
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    Pool<thrust::mr::new_delete_resource> resource(&upstream);
+
+    // Warm up the pool, so that the iterations measure cached allocations
+    benchmark.run(resource, sizes);
+
+    for(auto _ : state)
+    {
+        float64_t duration = benchmark.run(resource, sizes);
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_threads * elements);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(Pool, Elements, Threads, MaxBytes)                                    \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                       \
+                                     "{algo:mr,subalgo:" + name + ",input_type:" #Pool         \
+                                     + ",elements:" #Elements + ",threads:" #Threads           \
+                                     + ",max_bytes:" #MaxBytes)                                \
+                                     .c_str(),                                                 \
+                                 run_benchmark<Benchmark, thrust::mr::Pool>,                   \
+                                 Elements,                                                     \
+                                 seed_type,                                                    \
+                                 Threads,                                                      \
+                                 MaxBytes)
+
+#define BENCHMARK_THREADS(Pool, MaxBytes)                                                    \
+    CREATE_BENCHMARK(Pool, 1 << 16, 1, MaxBytes), CREATE_BENCHMARK(Pool, 1 << 16, 2, MaxBytes), \
+        CREATE_BENCHMARK(Pool, 1 << 16, 4, MaxBytes),                                        \
+        CREATE_BENCHMARK(Pool, 1 << 16, 8, MaxBytes),                                        \
+        CREATE_BENCHMARK(Pool, 1 << 16, 16, MaxBytes),                                       \
+        CREATE_BENCHMARK(Pool, 1 << 16, 32, MaxBytes)
+
+#define BENCHMARK_POOL(Pool) BENCHMARK_THREADS(Pool, 256), BENCHMARK_THREADS(Pool, 65536)
+
+template <class Benchmark>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs
+        = { BENCHMARK_POOL(synchronized_pool_resource), BENCHMARK_POOL(concurrent_pool_resource) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks<churn>("churn", benchmarks, seed_type);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
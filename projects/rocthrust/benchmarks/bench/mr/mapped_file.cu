@@ -0,0 +1,201 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/host_vector.h>
+#include <thrust/mapped_vector.h>
+#include <thrust/mr/mmap.h>
+#include <thrust/reduce.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// POSIX
+#include <unistd.h>
+
+// Measures loading a binary column file and reducing it, like the startup of a
+// service which loads its data from files. The file is read into a host vector
+// by default, and mapped into a mapped vector otherwise, in which case its
+// pages are only read when the reduction reaches them. The file is in the page
+// cache in both cases.
+struct read_file
+{
+    template <typename T>
+    float64_t run(const std::string& path, const std::size_t elements, T& result)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        thrust::host_vector<T> column(elements, thrust::no_init);
+        std::FILE*             file = std::fopen(path.c_str(), "rb");
+        const std::size_t      read = std::fread(column.data(), sizeof(T), elements, file);
+        std::fclose(file);
+
+        result = thrust::reduce(thrust::cpp::par, column.begin(), column.begin() + read);
+
+        const auto stop = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<float64_t>(stop - start).count();
+    }
+};
+
+struct map_file
+{
+    template <typename T>
+    float64_t run(const std::string& path, const std::size_t elements, T& result)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+        options.write_back               = false;
+        options.advice                   = thrust::mr::mmap_advice::sequential;
+
+        thrust::mr::mmap_resource  file(path.c_str(), options);
+        thrust::mapped_vector<T> column(elements, thrust::no_init, &file);
+
+        result = thrust::reduce(thrust::cpp::par, column.begin(), column.end());
+
+        const auto stop = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<float64_t>(stop - start).count();
+    }
+};
+
+template <class Benchmark, class T>
+void run_benchmark(benchmark::State& state, const std::size_t elements, const std::string seed_type)
+{
+    // Benchmark object
+    Benchmark benchmark {};
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    const bench_utils::managed_seed seed {seed_type};
+
+    std::default_random_engine       engine(seed.get_0());
+    std::uniform_int_distribution<T> distribution;
+
+    // Write the column file
+    const std::string path = "/tmp/thrust_mapped_file_" + std::to_string(::getpid()) + ".bin";
+    {
+        std::vector<T> column(elements);
+        for(T& value : column)
+        {
+            value = distribution(engine);
+        }
+
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        std::fwrite(column.data(), sizeof(T), elements, file);
+        std::fclose(file);
+    }
+
+    T result {};
+
+    // Warm up, which brings the file into the page cache
+    benchmark.run(path, elements, result);
+
+    for(auto _ : state)
+    {
+        float64_t duration = benchmark.run(path, elements, result);
+        benchmark::DoNotOptimize(result);
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    std::remove(path.c_str());
+
+    state.SetBytesProcessed(state.iterations() * elements * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * elements);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(T, Elements)                                                   \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                \
+                                     "{algo:mr,subalgo:" + name + ",input_type:" #T     \
+                                     + ",elements:" #Elements)                          \
+                                     .c_str(),                                          \
+                                 run_benchmark<Benchmark, T>,                           \
+                                 Elements,                                              \
+                                 seed_type)
+
+template <class Benchmark>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = { CREATE_BENCHMARK(int, 1 << 16),
+                                                        CREATE_BENCHMARK(int, 1 << 20),
+                                                        CREATE_BENCHMARK(int, 1 << 24),
+                                                        CREATE_BENCHMARK(int, 1 << 26) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks<read_file>("read_file", benchmarks, seed_type);
+    add_benchmarks<map_file>("map_file", benchmarks, seed_type);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
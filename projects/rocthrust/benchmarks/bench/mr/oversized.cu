@@ -0,0 +1,238 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measures how long an oversized allocation and its deallocation take when the
+// pool already caches many oversized blocks of varying sizes, like a service
+// whose cache of large temporaries fills up over time.
+template <std::size_t CachedMin,
+          std::size_t CachedMax,
+          std::size_t RequestMin,
+          std::size_t RequestMax,
+          std::size_t SizeCutoff>
+struct cached_oversized
+{
+    static constexpr std::size_t largest_block_size = 1024;
+
+    // pool_options::cached_size_cutoff_factor
+    static constexpr std::size_t size_cutoff = SizeCutoff;
+
+    // sizes of the blocks cached before the measurement
+    static constexpr std::size_t cached_min = CachedMin;
+    static constexpr std::size_t cached_max = CachedMax;
+
+    // sizes of the measured requests
+    static constexpr std::size_t request_min = RequestMin;
+    static constexpr std::size_t request_max = RequestMax;
+
+    // number of blocks in use at any time
+    static constexpr std::size_t live_allocations = 32;
+
+    template <typename Pool>
+    float64_t run(Pool& pool, const std::vector<std::size_t>& sizes)
+    {
+        void*       blocks[live_allocations]      = {};
+        std::size_t block_sizes[live_allocations] = {};
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for(std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            const std::size_t slot = i % live_allocations;
+            if(blocks[slot])
+            {
+                pool.do_deallocate(blocks[slot], block_sizes[slot]);
+            }
+            blocks[slot]      = pool.do_allocate(sizes[i]);
+            block_sizes[slot] = sizes[i];
+            benchmark::DoNotOptimize(blocks[slot]);
+        }
+
+        for(std::size_t slot = 0; slot < live_allocations; ++slot)
+        {
+            if(blocks[slot])
+            {
+                pool.do_deallocate(blocks[slot], block_sizes[slot]);
+            }
+        }
+
+        const auto stop = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<float64_t>(stop - start).count();
+    }
+};
+
+// the requests are served by cached blocks of about their size
+using similar_sizes = cached_oversized<1025, 16 * 1024, 1025, 16 * 1024, 16>;
+
+// most cached blocks are too small for the requests, and only a few fit
+using larger_requests = cached_oversized<1025, 8 * 1024, 8 * 1024 + 1, 16 * 1024, 16>;
+
+// only blocks less than twice the size of a request may serve it, so many
+// requests find no fitting block near the front of the cache
+using tight_cutoff = cached_oversized<1025, 16 * 1024, 1025, 16 * 1024, 2>;
+
+template <class Benchmark>
+void run_benchmark(benchmark::State& state,
+                   const std::size_t elements,
+                   const std::string seed_type,
+                   const std::size_t operations)
+{
+    using pool_t = thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource>;
+
+    // Benchmark object
+    Benchmark benchmark {};
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    const bench_utils::managed_seed seed {seed_type};
+
+    std::default_random_engine                 engine(seed.get_0());
+    std::uniform_int_distribution<std::size_t> cached_distribution(Benchmark::cached_min,
+                                                                   Benchmark::cached_max);
+    std::uniform_int_distribution<std::size_t> request_distribution(Benchmark::request_min,
+                                                                    Benchmark::request_max);
+
+    thrust::mr::pool_options options = pool_t::get_default_options();
+    options.largest_block_size        = Benchmark::largest_block_size;
+    options.cached_size_cutoff_factor = Benchmark::size_cutoff;
+
+    thrust::mr::new_delete_resource upstream;
+    pool_t                          pool(&upstream, options);
+
+    // Fill the cache with elements oversized blocks of random sizes
+    std::vector<std::size_t> cached_sizes(elements);
+    std::vector<void*>       cached_blocks(elements);
+    for(std::size_t i = 0; i < elements; ++i)
+    {
+        cached_sizes[i]  = cached_distribution(engine);
+        cached_blocks[i] = pool.do_allocate(cached_sizes[i]);
+    }
+    for(std::size_t i = 0; i < elements; ++i)
+    {
+        pool.do_deallocate(cached_blocks[i], cached_sizes[i]);
+    }
+
+    std::vector<std::size_t> sizes(operations);
+    for(std::size_t& size : sizes)
+    {
+        size = request_distribution(engine);
+    }
+
+    // Warm up the pool, so that the measured allocations are served from the
+    // cache, and every deallocation puts the block back
+    benchmark.run(pool, sizes);
+
+    for(auto _ : state)
+    {
+        float64_t duration = benchmark.run(pool, sizes);
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    state.SetItemsProcessed(state.iterations() * operations);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(Elements, Operations)                                              \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                    \
+                                     "{algo:mr,subalgo:" + name                             \
+                                     + ",input_type:unsynchronized_pool_resource,elements:" \
+                                       #Elements ",operations:" #Operations)                \
+                                     .c_str(),                                              \
+                                 run_benchmark<Benchmark>,                                  \
+                                 Elements,                                                  \
+                                 seed_type,                                                 \
+                                 Operations)
+
+template <class Benchmark>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = { CREATE_BENCHMARK(1 << 4, 1 << 12),
+                                                        CREATE_BENCHMARK(1 << 8, 1 << 12),
+                                                        CREATE_BENCHMARK(1 << 10, 1 << 12),
+                                                        CREATE_BENCHMARK(1 << 12, 1 << 12),
+                                                        CREATE_BENCHMARK(1 << 14, 1 << 12) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks<similar_sizes>("similar_sizes", benchmarks, seed_type);
+    add_benchmarks<larger_requests>("larger_requests", benchmarks, seed_type);
+    add_benchmarks<tight_cutoff>("tight_cutoff", benchmarks, seed_type);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
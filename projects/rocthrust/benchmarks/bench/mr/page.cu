@@ -0,0 +1,183 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/page.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measures a random gather on the host from an array allocated by the given
+// resource, which is dominated by TLB misses once the array is much larger
+// than the memory the TLB covers with ordinary pages.
+struct new_delete
+{
+    using resource_type = thrust::mr::new_delete_resource;
+
+    static resource_type make_resource()
+    {
+        return resource_type {};
+    }
+};
+
+template <thrust::mr::huge_page_policy HugePages>
+struct pages
+{
+    using resource_type = thrust::mr::page_resource;
+
+    static resource_type make_resource()
+    {
+        thrust::mr::page_options options = resource_type::get_default_options();
+        options.huge_pages               = HugePages;
+        return resource_type(options);
+    }
+};
+
+using small_pages = pages<thrust::mr::huge_page_policy::none>;
+using huge_pages  = pages<thrust::mr::huge_page_policy::transparent>;
+
+template <class Benchmark, class T>
+void run_benchmark(benchmark::State& state,
+                   const std::size_t elements,
+                   const std::string seed_type)
+{
+    using resource_type  = typename Benchmark::resource_type;
+    using allocator_type = thrust::mr::allocator<T, resource_type>;
+    using vector_type    = thrust::host_vector<T, allocator_type>;
+
+    // CPU times
+    std::vector<double> cpu_times;
+
+    const bench_utils::managed_seed seed {seed_type};
+
+    resource_type resource = Benchmark::make_resource();
+
+    vector_type input(elements, T(1), allocator_type(&resource));
+    vector_type output(elements, allocator_type(&resource));
+
+    // Generate random gather indices
+    std::default_random_engine                 engine(seed.get_0());
+    std::uniform_int_distribution<std::size_t> distribution(0, elements - 1);
+
+    thrust::host_vector<std::size_t> map(elements);
+    for(std::size_t i = 0; i < elements; ++i)
+    {
+        map[i] = distribution(engine);
+    }
+
+    // Warm up
+    thrust::gather(thrust::cpp::par, map.begin(), map.end(), input.begin(), output.begin());
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        thrust::gather(thrust::cpp::par, map.begin(), map.end(), input.begin(), output.begin());
+        const auto stop = std::chrono::high_resolution_clock::now();
+
+        float64_t duration = std::chrono::duration<float64_t>(stop - start).count();
+        state.SetIterationTime(duration);
+        cpu_times.push_back(duration);
+    }
+
+    state.SetBytesProcessed(state.iterations() * elements * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * elements);
+
+    const double cpu_cv         = bench_utils::StatisticsCV(cpu_times);
+    state.counters["cpu_noise"] = cpu_cv;
+}
+
+#define CREATE_BENCHMARK(T, Elements)                                                   \
+    benchmark::RegisterBenchmark(bench_utils::bench_naming::format_name(                \
+                                     "{algo:mr,subalgo:" + name + ",input_type:" #T     \
+                                     + ",elements:" #Elements)                          \
+                                     .c_str(),                                          \
+                                 run_benchmark<Benchmark, T>,                           \
+                                 Elements,                                              \
+                                 seed_type)
+
+template <class Benchmark>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::string                             seed_type)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = { CREATE_BENCHMARK(int, 1 << 16),
+                                                        CREATE_BENCHMARK(int, 1 << 20),
+                                                        CREATE_BENCHMARK(int, 1 << 24),
+                                                        CREATE_BENCHMARK(int, 1 << 26) };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks<new_delete>("new_delete_gather", benchmarks, seed_type);
+    add_benchmarks<small_pages>("page_gather", benchmarks, seed_type);
+    add_benchmarks<huge_pages>("huge_page_gather", benchmarks, seed_type);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
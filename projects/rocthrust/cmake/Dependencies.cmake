@@ -46,6 +46,9 @@ if(BUILD_TEST OR BUILD_HIPSTDPAR_TEST)
     message(STATUS "Force installing GTest.")
   endif()
 
+  # OpenMP (for the tests of the OMP host system), provided by the compiler
+  find_package(OpenMP QUIET COMPONENTS CXX)
+
   if(NOT TARGET GTest::GTest AND NOT TARGET GTest::gtest)
     message(STATUS "GTest not found or force download GTest on. Downloading and building GTest.")
     set(GTEST_ROOT ${CMAKE_CURRENT_BINARY_DIR}/deps/gtest CACHE PATH "")
@@ -143,6 +146,12 @@ if(BUILD_BENCHMARKS)
     message(STATUS "Force installing Google Benchmark.")
   endif()
 
+  # OpenMP and TBB (for the benchmarks of the parallel host systems)
+  find_package(OpenMP QUIET COMPONENTS CXX)
+  if(NOT TARGET TBB::tbb)
+    find_package(TBB QUIET)
+  endif()
+
   if(NOT benchmark_FOUND)
     message(STATUS "Google Benchmark not found or force download Google Benchmark on. Downloading and building Google Benchmark.")
     if(CMAKE_CONFIGURATION_TYPES)
@@ -0,0 +1,116 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/batch_copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(BatchCopyPrimitiveTests, NumericalTestsParams);
+
+// Sizes of buffers totalling roughly size elements, with a mix of empty, short and long buffers
+thrust::host_vector<int> get_random_buffer_sizes(size_t size, int seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> short_length(0, 40);
+
+    thrust::host_vector<int> sizes;
+    size_t total = 0;
+    while(total < size)
+    {
+        const int length = engine() % 64 == 0 ? 100000 : short_length(engine);
+        sizes.push_back(static_cast<int>((std::min)(size - total, static_cast<size_t>(length))));
+        total += sizes.back();
+    }
+    return sizes;
+}
+
+TYPED_TEST(BatchCopyPrimitiveTests, TestBatchCopy)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_source = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_sizes = get_random_buffer_sizes(size, seed);
+
+            thrust::device_vector<T>   d_source = h_source;
+            thrust::device_vector<int> d_sizes  = h_sizes;
+
+            const size_t num_buffers = h_sizes.size();
+
+            // gather the buffers, which are consecutive in the source, in reverse order
+            thrust::host_vector<T>   h_result(size);
+            thrust::device_vector<T> d_result(size);
+
+            thrust::host_vector<const T*> h_src_ptrs(num_buffers);
+            thrust::host_vector<T*>       h_dst_ptrs(num_buffers);
+            thrust::host_vector<const T*> d_src_ptrs_staging(num_buffers);
+            thrust::host_vector<T*>       d_dst_ptrs_staging(num_buffers);
+
+            size_t src_offset = 0;
+            size_t dst_offset = size;
+            for(size_t i = 0; i < num_buffers; i++)
+            {
+                dst_offset -= h_sizes[i];
+
+                h_src_ptrs[i] = thrust::raw_pointer_cast(h_source.data()) + src_offset;
+                h_dst_ptrs[i] = thrust::raw_pointer_cast(h_result.data()) + dst_offset;
+
+                d_src_ptrs_staging[i] = thrust::raw_pointer_cast(d_source.data()) + src_offset;
+                d_dst_ptrs_staging[i] = thrust::raw_pointer_cast(d_result.data()) + dst_offset;
+
+                src_offset += h_sizes[i];
+            }
+
+            thrust::device_vector<const T*> d_src_ptrs = d_src_ptrs_staging;
+            thrust::device_vector<T*>       d_dst_ptrs = d_dst_ptrs_staging;
+
+            thrust::batch_copy(h_src_ptrs.begin(), h_dst_ptrs.begin(), h_sizes.begin(), num_buffers);
+            thrust::batch_copy(d_src_ptrs.begin(), d_dst_ptrs.begin(), d_sizes.begin(), num_buffers);
+
+            thrust::host_vector<T> d_copy = d_result;
+
+            src_offset = 0;
+            dst_offset = size;
+            for(size_t i = 0; i < num_buffers; i++)
+            {
+                dst_offset -= h_sizes[i];
+                for(int j = 0; j < h_sizes[i]; j++)
+                {
+                    ASSERT_EQ(h_result[dst_offset + j], h_source[src_offset + j]);
+                    ASSERT_EQ(d_copy[dst_offset + j], h_source[src_offset + j]);
+                }
+                src_offset += h_sizes[i];
+            }
+        }
+    }
+}
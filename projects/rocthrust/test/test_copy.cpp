@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/memory.h>
 #include <thrust/sequence.h>
+#include <thrust/system/detail/generic/copy_if.h>
 
 #include "test_header.hpp"
 
@@ -572,6 +573,61 @@ TYPED_TEST(CopyIntegerTests, TestCopyIfStencil)
     }
 }
 
+TYPED_TEST(CopyIntegerTests, TestCopyIfGenericTiles)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the generic implementation compacts the input in tiles; use tiny tiles
+    // so that the output of every tile is appended to the previous ones
+    const std::vector<std::ptrdiff_t> tile_sizes = {1, 2, 7, 64};
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<T> h_stencil = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed + seed_value_addition);
+
+            thrust::host_vector<T> h_expected(size);
+            h_expected.resize(thrust::copy_if(thrust::seq,
+                                              h_data.begin(),
+                                              h_data.end(),
+                                              h_stencil.begin(),
+                                              h_expected.begin(),
+                                              is_even<T>())
+                              - h_expected.begin());
+
+            for(auto tile_size : tile_sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "with tile_size= " << tile_size);
+
+                thrust::host_vector<T> h_result(size);
+
+                auto policy = thrust::host;
+                auto h_new_end = thrust::system::detail::generic::detail::copy_if_tiles(policy,
+                                                                                        h_data.begin(),
+                                                                                        h_data.end(),
+                                                                                        h_stencil.begin(),
+                                                                                        h_result.begin(),
+                                                                                        is_even<T>(),
+                                                                                        tile_size);
+
+                h_result.resize(h_new_end - h_result.begin());
+
+                ASSERT_EQ(h_result, h_expected);
+            }
+        }
+    }
+}
+
 TYPED_TEST(CopyTests, TestCopyCountingIterator)
 {
     using Vector = typename TestFixture::input_type;
@@ -0,0 +1,189 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/hash_reduce_by_key.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(HashReduceByKeyTests, FullTestsParams);
+TESTS_DEFINE(HashReduceByKeyIntegralTests, IntegerTestsParams);
+
+struct collide_hash
+{
+    template <typename T>
+    __host__ __device__ unsigned long long operator()(const T& x) const
+    {
+        return static_cast<unsigned long long>(x) % 3;
+    }
+};
+
+// sorts the groups by key, since they are written in an unspecified order
+template <typename Vector1, typename Vector2>
+void sort_groups(Vector1& keys, Vector2& values, size_t num_groups)
+{
+    keys.resize(num_groups);
+    values.resize(num_groups);
+
+    thrust::sort_by_key(keys.begin(), keys.end(), values.begin());
+}
+
+TYPED_TEST(HashReduceByKeyTests, TestHashReduceByKeySimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(7);
+    Vector values(7);
+
+    keys[0] = T(1); values[0] = T(9);
+    keys[1] = T(3); values[1] = T(8);
+    keys[2] = T(3); values[2] = T(7);
+    keys[3] = T(3); values[3] = T(6);
+    keys[4] = T(2); values[4] = T(5);
+    keys[5] = T(2); values[5] = T(4);
+    keys[6] = T(1); values[6] = T(3);
+
+    Vector output_keys(7);
+    Vector output_values(7);
+
+    auto end = thrust::hash_reduce_by_key(
+        Policy{}, keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+    ASSERT_EQ(end.first - output_keys.begin(), 3);
+    ASSERT_EQ(end.second - output_values.begin(), 3);
+
+    sort_groups(output_keys, output_values, 3);
+
+    ASSERT_EQ(output_keys[0], T(1));
+    ASSERT_EQ(output_keys[1], T(2));
+    ASSERT_EQ(output_keys[2], T(3));
+
+    ASSERT_EQ(output_values[0], T(12));
+    ASSERT_EQ(output_values[1], T(9));
+    ASSERT_EQ(output_values[2], T(21));
+}
+
+TYPED_TEST(HashReduceByKeyTests, TestHashReduceByKeyEmpty)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys;
+    Vector values;
+    Vector output_keys(1);
+    Vector output_values(1);
+
+    auto end = thrust::hash_reduce_by_key(
+        Policy{}, keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+    ASSERT_EQ(end.first - output_keys.begin(), 0);
+    ASSERT_EQ(end.second - output_values.begin(), 0);
+}
+
+TYPED_TEST(HashReduceByKeyIntegralTests, TestHashReduceByKey)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_keys = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_values = get_random_data<int>(size, 0, 100, seed + 1);
+
+            // few distinct keys, so that every key occurs many times
+            for(size_t i = 0; i < size; i++)
+            {
+                h_keys[i] = static_cast<T>(h_keys[i] % 13);
+            }
+
+            thrust::device_vector<T>   d_keys   = h_keys;
+            thrust::device_vector<int> d_values = h_values;
+
+            // the reference sorts the keys and reduces them
+            thrust::host_vector<T>   h_sorted_keys   = h_keys;
+            thrust::host_vector<int> h_sorted_values = h_values;
+
+            thrust::sort_by_key(h_sorted_keys.begin(), h_sorted_keys.end(), h_sorted_values.begin());
+
+            thrust::host_vector<T>   h_output_keys(size);
+            thrust::host_vector<int> h_output_values(size);
+
+            const size_t num_keys = thrust::reduce_by_key(h_sorted_keys.begin(),
+                                                          h_sorted_keys.end(),
+                                                          h_sorted_values.begin(),
+                                                          h_output_keys.begin(),
+                                                          h_output_values.begin())
+                                        .first
+                                    - h_output_keys.begin();
+
+            h_output_keys.resize(num_keys);
+            h_output_values.resize(num_keys);
+
+            thrust::device_vector<T>   d_output_keys(size);
+            thrust::device_vector<int> d_output_values(size);
+
+            auto d_end = thrust::hash_reduce_by_key(
+                d_keys.begin(), d_keys.end(), d_values.begin(), d_output_keys.begin(), d_output_values.begin());
+
+            ASSERT_EQ(static_cast<size_t>(d_end.first - d_output_keys.begin()), num_keys);
+            ASSERT_EQ(static_cast<size_t>(d_end.second - d_output_values.begin()), num_keys);
+
+            sort_groups(d_output_keys, d_output_values, num_keys);
+
+            test_equality(h_output_keys, d_output_keys);
+            test_equality(h_output_values, d_output_values);
+
+            // a hash which maps many keys to the same value gives the same groups
+            thrust::device_vector<T>   d_collided_keys(size);
+            thrust::device_vector<int> d_collided_values(size);
+
+            d_end = thrust::hash_reduce_by_key(d_keys.begin(),
+                                               d_keys.end(),
+                                               d_values.begin(),
+                                               d_collided_keys.begin(),
+                                               d_collided_values.begin(),
+                                               thrust::equal_to<T>(),
+                                               thrust::plus<int>(),
+                                               collide_hash());
+
+            ASSERT_EQ(static_cast<size_t>(d_end.first - d_collided_keys.begin()), num_keys);
+
+            sort_groups(d_collided_keys, d_collided_values, num_keys);
+
+            test_equality(h_output_keys, d_collided_keys);
+            test_equality(h_output_values, d_collided_values);
+        }
+    }
+}
@@ -0,0 +1,271 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/histogram.h>
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(HistogramTests, FullTestsParams);
+TESTS_DEFINE(HistogramPrimitiveTests, NumericalTestsParams);
+
+TYPED_TEST(HistogramTests, TestHistogramEvenSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector samples(8);
+    samples[0] = T(2);
+    samples[1] = T(6);
+    samples[2] = T(7);
+    samples[3] = T(3);
+    samples[4] = T(12);
+    samples[5] = T(0);
+    samples[6] = T(3);
+    samples[7] = T(2);
+
+    thrust::device_vector<unsigned int> d_counts(4);
+    thrust::host_vector<unsigned int>   counts(4);
+
+    // bins [0, 2), [2, 4), [4, 6) and [6, 8)
+    auto end = thrust::histogram_even(
+        Policy{}, samples.begin(), samples.end(), d_counts.begin(), 5, T(0), T(8));
+
+    ASSERT_EQ(end - d_counts.begin(), 4);
+
+    counts = d_counts;
+    ASSERT_EQ(counts[0], 1u);
+    ASSERT_EQ(counts[1], 4u);
+    ASSERT_EQ(counts[2], 0u);
+    ASSERT_EQ(counts[3], 2u);
+}
+
+TYPED_TEST(HistogramTests, TestHistogramRangeSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector samples(8);
+    samples[0] = T(1);
+    samples[1] = T(7);
+    samples[2] = T(12);
+    samples[3] = T(3);
+    samples[4] = T(40);
+    samples[5] = T(100);
+    samples[6] = T(5);
+    samples[7] = T(18);
+
+    Vector levels(4);
+    levels[0] = T(0);
+    levels[1] = T(5);
+    levels[2] = T(20);
+    levels[3] = T(50);
+
+    thrust::device_vector<unsigned int> d_counts(3);
+    thrust::host_vector<unsigned int>   counts(3);
+
+    // bins [0, 5), [5, 20) and [20, 50)
+    auto end = thrust::histogram_range(
+        Policy{}, samples.begin(), samples.end(), d_counts.begin(), levels.begin(), levels.end());
+
+    ASSERT_EQ(end - d_counts.begin(), 3);
+
+    counts = d_counts;
+    ASSERT_EQ(counts[0], 2u);
+    ASSERT_EQ(counts[1], 4u);
+    ASSERT_EQ(counts[2], 1u);
+}
+
+template <typename T>
+int histogram_even_reference_bin(T x, T lower_level, T upper_level, int num_bins, std::true_type)
+{
+    return static_cast<int>(static_cast<long long>(x - lower_level) * num_bins / static_cast<long long>(upper_level - lower_level));
+}
+
+template <typename T>
+int histogram_even_reference_bin(T x, T lower_level, T upper_level, int num_bins, std::false_type)
+{
+    const int bin = static_cast<int>((x - lower_level) / (upper_level - lower_level) * num_bins);
+    return (std::min)(bin, num_bins - 1);
+}
+
+template <typename T>
+int histogram_even_reference_bin(T x, T lower_level, T upper_level, int num_bins)
+{
+    return histogram_even_reference_bin(x, lower_level, upper_level, num_bins, std::is_integral<T>());
+}
+
+TYPED_TEST(HistogramPrimitiveTests, TestHistogramEven)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const T   lower_level = T(10);
+    const T   upper_level = T(110);
+    const int num_bins    = 20;
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_samples = get_random_data<T>(size, T(0), T(120), seed);
+            thrust::device_vector<T> d_samples = h_samples;
+
+            std::vector<size_t> expected(num_bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                const T x = h_samples[i];
+                if(x >= lower_level && x < upper_level)
+                {
+                    expected[histogram_even_reference_bin(x, lower_level, upper_level, num_bins)]++;
+                }
+            }
+
+            thrust::host_vector<size_t>   h_counts(num_bins);
+            thrust::device_vector<size_t> d_counts(num_bins);
+
+            thrust::histogram_even(h_samples.begin(), h_samples.end(), h_counts.begin(), num_bins + 1, lower_level, upper_level);
+            thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), num_bins + 1, lower_level, upper_level);
+
+            thrust::host_vector<size_t> d_result = d_counts;
+            for(int bin = 0; bin < num_bins; bin++)
+            {
+                ASSERT_EQ(h_counts[bin], expected[bin]);
+                ASSERT_EQ(d_result[bin], expected[bin]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(HistogramPrimitiveTests, TestHistogramRange)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<T> h_levels(6);
+    h_levels[0] = T(0);
+    h_levels[1] = T(1);
+    h_levels[2] = T(4);
+    h_levels[3] = T(16);
+    h_levels[4] = T(64);
+    h_levels[5] = T(100);
+    thrust::device_vector<T> d_levels = h_levels;
+
+    const int num_bins = 5;
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_samples = get_random_data<T>(size, T(0), T(120), seed);
+            thrust::device_vector<T> d_samples = h_samples;
+
+            std::vector<size_t> expected(num_bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                const auto upper = std::upper_bound(h_levels.begin(), h_levels.end(), h_samples[i]) - h_levels.begin();
+                if(upper > 0 && upper <= num_bins)
+                {
+                    expected[upper - 1]++;
+                }
+            }
+
+            thrust::host_vector<size_t>   h_counts(num_bins);
+            thrust::device_vector<size_t> d_counts(num_bins);
+
+            thrust::histogram_range(h_samples.begin(), h_samples.end(), h_counts.begin(), h_levels.begin(), h_levels.end());
+            thrust::histogram_range(d_samples.begin(), d_samples.end(), d_counts.begin(), d_levels.begin(), d_levels.end());
+
+            thrust::host_vector<size_t> d_result = d_counts;
+            for(int bin = 0; bin < num_bins; bin++)
+            {
+                ASSERT_EQ(h_counts[bin], expected[bin]);
+                ASSERT_EQ(d_result[bin], expected[bin]);
+            }
+        }
+    }
+}
+
+// Floating point samples are converted to integral levels by truncation;
+// the ones whose integral part doesn't fit the level type are outside of
+// every bin
+TEST(HistogramTests, TestHistogramFloatingSamplesIntegralLevels)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // bins [0, 50), [50, 100), [100, 150), [150, 200) and [200, 250)
+    {
+        const std::vector<double> h_samples
+            = {-0.5, 49.9, 50.0, 249.99, 255.5, 256.0, 300.0, -1.0, 1e30, -1e30, nan, inf, -inf};
+        thrust::device_vector<double> d_samples(h_samples.begin(), h_samples.end());
+
+        thrust::host_vector<unsigned int>   h_counts(5);
+        thrust::device_vector<unsigned int> d_counts(5);
+
+        thrust::histogram_even(h_samples.begin(), h_samples.end(), h_counts.begin(), 6, (unsigned char)0, (unsigned char)250);
+        thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), 6, (unsigned char)0, (unsigned char)250);
+
+        const std::vector<unsigned int> expected = {2, 1, 0, 0, 1};
+        ASSERT_EQ(std::vector<unsigned int>(h_counts.begin(), h_counts.end()), expected);
+        ASSERT_EQ(std::vector<unsigned int>(d_counts.begin(), d_counts.end()), expected);
+    }
+
+    // bins [LLONG_MIN, 0) and [0, LLONG_MAX)
+    {
+        const std::vector<float> h_samples = {-9.3e18f, -9.2e18f, -0.5f, 0.5f, 1e18f, 9.2e18f, 9.3e18f, 1e30f, -1e30f};
+        thrust::device_vector<float> d_samples(h_samples.begin(), h_samples.end());
+
+        const std::vector<long long> h_levels
+            = {std::numeric_limits<long long>::min(), 0, std::numeric_limits<long long>::max()};
+        thrust::device_vector<long long> d_levels(h_levels.begin(), h_levels.end());
+
+        thrust::host_vector<unsigned int>   h_counts(2);
+        thrust::device_vector<unsigned int> d_counts(2);
+
+        thrust::histogram_range(h_samples.begin(), h_samples.end(), h_counts.begin(), h_levels.begin(), h_levels.end());
+        thrust::histogram_range(d_samples.begin(), d_samples.end(), d_counts.begin(), d_levels.begin(), d_levels.end());
+
+        const std::vector<unsigned int> expected = {1, 4};
+        ASSERT_EQ(std::vector<unsigned int>(h_counts.begin(), h_counts.end()), expected);
+        ASSERT_EQ(std::vector<unsigned int>(d_counts.begin(), d_counts.end()), expected);
+    }
+}
@@ -0,0 +1,274 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/merge_join.h>
+#include <thrust/sort.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(MergeJoinTests, FullTestsParams);
+TESTS_DEFINE(MergeJoinPrimitiveTests, NumericalTestsParams);
+
+template <typename Vector>
+Vector make_keys(std::initializer_list<int> keys)
+{
+    using T = typename Vector::value_type;
+
+    Vector result;
+    for(int key : keys)
+    {
+        result.push_back(T(key));
+    }
+    return result;
+}
+
+TYPED_TEST(MergeJoinTests, TestMergeJoinSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys1 = make_keys<Vector>({1, 3, 3, 5, 7});
+    Vector keys2 = make_keys<Vector>({3, 3, 4, 7});
+
+    thrust::device_vector<int> index1(7);
+    thrust::device_vector<int> index2(7);
+
+    auto end = thrust::merge_join(
+        Policy{}, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), index1.begin(), index2.begin());
+
+    ASSERT_EQ(end.first - index1.begin(), 5);
+    ASSERT_EQ(end.second - index2.begin(), 5);
+
+    ASSERT_EQ(index1[0], 1);
+    ASSERT_EQ(index1[1], 1);
+    ASSERT_EQ(index1[2], 2);
+    ASSERT_EQ(index1[3], 2);
+    ASSERT_EQ(index1[4], 4);
+
+    ASSERT_EQ(index2[0], 0);
+    ASSERT_EQ(index2[1], 1);
+    ASSERT_EQ(index2[2], 0);
+    ASSERT_EQ(index2[3], 1);
+    ASSERT_EQ(index2[4], 3);
+
+    // joining with an empty range gives no pairs
+    end = thrust::merge_join(
+        Policy{}, keys1.begin(), keys1.end(), keys2.begin(), keys2.begin(), index1.begin(), index2.begin());
+
+    ASSERT_EQ(end.first - index1.begin(), 0);
+    ASSERT_EQ(end.second - index2.begin(), 0);
+}
+
+TYPED_TEST(MergeJoinTests, TestMergeLeftOuterJoinSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys1 = make_keys<Vector>({1, 3, 3, 5, 7});
+    Vector keys2 = make_keys<Vector>({3, 3, 4, 7});
+
+    thrust::device_vector<int> index1(7);
+    thrust::device_vector<int> index2(7);
+
+    auto end = thrust::merge_left_outer_join(
+        Policy{}, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), index1.begin(), index2.begin());
+
+    ASSERT_EQ(end.first - index1.begin(), 7);
+    ASSERT_EQ(end.second - index2.begin(), 7);
+
+    ASSERT_EQ(index1[0], 0);
+    ASSERT_EQ(index1[1], 1);
+    ASSERT_EQ(index1[2], 1);
+    ASSERT_EQ(index1[3], 2);
+    ASSERT_EQ(index1[4], 2);
+    ASSERT_EQ(index1[5], 3);
+    ASSERT_EQ(index1[6], 4);
+
+    // the 1 and the 5 of keys1 have no match
+    ASSERT_EQ(index2[0], -1);
+    ASSERT_EQ(index2[1], 0);
+    ASSERT_EQ(index2[2], 1);
+    ASSERT_EQ(index2[3], 0);
+    ASSERT_EQ(index2[4], 1);
+    ASSERT_EQ(index2[5], -1);
+    ASSERT_EQ(index2[6], 3);
+}
+
+TYPED_TEST(MergeJoinTests, TestMergeSemiJoinSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys1 = make_keys<Vector>({1, 3, 3, 5, 7});
+    Vector keys2 = make_keys<Vector>({3, 3, 4, 7});
+
+    thrust::device_vector<int> index1(5);
+
+    auto end = thrust::merge_semi_join(
+        Policy{}, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), index1.begin());
+
+    ASSERT_EQ(end - index1.begin(), 3);
+    ASSERT_EQ(index1[0], 1);
+    ASSERT_EQ(index1[1], 2);
+    ASSERT_EQ(index1[2], 4);
+}
+
+TYPED_TEST(MergeJoinTests, TestMergeJoinDescending)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys1 = make_keys<Vector>({7, 5, 3, 3, 1});
+    Vector keys2 = make_keys<Vector>({7, 4, 3, 3});
+
+    thrust::device_vector<int> index1(7);
+    thrust::device_vector<int> index2(7);
+
+    auto end = thrust::merge_join(Policy{},
+                                  keys1.begin(),
+                                  keys1.end(),
+                                  keys2.begin(),
+                                  keys2.end(),
+                                  index1.begin(),
+                                  index2.begin(),
+                                  thrust::greater<T>());
+
+    ASSERT_EQ(end.first - index1.begin(), 5);
+
+    ASSERT_EQ(index1[0], 0);
+    ASSERT_EQ(index1[1], 2);
+    ASSERT_EQ(index1[2], 2);
+    ASSERT_EQ(index1[3], 3);
+    ASSERT_EQ(index1[4], 3);
+
+    ASSERT_EQ(index2[0], 0);
+    ASSERT_EQ(index2[1], 2);
+    ASSERT_EQ(index2[2], 3);
+    ASSERT_EQ(index2[3], 2);
+    ASSERT_EQ(index2[4], 3);
+}
+
+TYPED_TEST(MergeJoinPrimitiveTests, TestMergeJoin)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            // keys repeat, so that keys are joined many-to-many
+            const int num_keys = static_cast<int>(size / 4) + 1;
+
+            thrust::host_vector<int> h_keys1_int = get_random_data<int>(size, 0, num_keys, seed);
+            thrust::host_vector<int> h_keys2_int = get_random_data<int>(size / 2, 0, num_keys, seed + 1);
+
+            thrust::host_vector<T> h_keys1(h_keys1_int.begin(), h_keys1_int.end());
+            thrust::host_vector<T> h_keys2(h_keys2_int.begin(), h_keys2_int.end());
+
+            thrust::sort(h_keys1.begin(), h_keys1.end());
+            thrust::sort(h_keys2.begin(), h_keys2.end());
+
+            thrust::device_vector<T> d_keys1 = h_keys1;
+            thrust::device_vector<T> d_keys2 = h_keys2;
+
+            // size the outputs by a left outer join, which writes the most pairs
+            const size_t num_pairs = thrust::merge_left_outer_join(h_keys1.begin(),
+                                                                   h_keys1.end(),
+                                                                   h_keys2.begin(),
+                                                                   h_keys2.end(),
+                                                                   thrust::make_discard_iterator(),
+                                                                   thrust::make_discard_iterator())
+                                         .first
+                                     - thrust::make_discard_iterator();
+
+            thrust::host_vector<long long>   h_index1(num_pairs);
+            thrust::host_vector<long long>   h_index2(num_pairs);
+            thrust::device_vector<long long> d_index1(num_pairs);
+            thrust::device_vector<long long> d_index2(num_pairs);
+
+            auto h_end = thrust::merge_join(h_keys1.begin(),
+                                            h_keys1.end(),
+                                            h_keys2.begin(),
+                                            h_keys2.end(),
+                                            h_index1.begin(),
+                                            h_index2.begin());
+            auto d_end = thrust::merge_join(d_keys1.begin(),
+                                            d_keys1.end(),
+                                            d_keys2.begin(),
+                                            d_keys2.end(),
+                                            d_index1.begin(),
+                                            d_index2.begin());
+
+            ASSERT_EQ(h_end.first - h_index1.begin(), d_end.first - d_index1.begin());
+            ASSERT_EQ(h_end.second - h_index2.begin(), d_end.second - d_index2.begin());
+
+            test_equality(h_index1, d_index1);
+            test_equality(h_index2, d_index2);
+
+            h_end = thrust::merge_left_outer_join(h_keys1.begin(),
+                                                  h_keys1.end(),
+                                                  h_keys2.begin(),
+                                                  h_keys2.end(),
+                                                  h_index1.begin(),
+                                                  h_index2.begin());
+            d_end = thrust::merge_left_outer_join(d_keys1.begin(),
+                                                  d_keys1.end(),
+                                                  d_keys2.begin(),
+                                                  d_keys2.end(),
+                                                  d_index1.begin(),
+                                                  d_index2.begin());
+
+            ASSERT_EQ(static_cast<size_t>(h_end.first - h_index1.begin()), num_pairs);
+            ASSERT_EQ(static_cast<size_t>(d_end.first - d_index1.begin()), num_pairs);
+
+            test_equality(h_index1, d_index1);
+            test_equality(h_index2, d_index2);
+
+            // every key of keys1 is written at most once by a semi join
+            thrust::host_vector<long long>   h_semi(size);
+            thrust::device_vector<long long> d_semi(size);
+
+            auto h_semi_end = thrust::merge_semi_join(
+                h_keys1.begin(), h_keys1.end(), h_keys2.begin(), h_keys2.end(), h_semi.begin());
+            auto d_semi_end = thrust::merge_semi_join(
+                d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(), d_semi.begin());
+
+            ASSERT_EQ(h_semi_end - h_semi.begin(), d_semi_end - d_semi.begin());
+
+            test_equality(h_semi, d_semi);
+        }
+    }
+}
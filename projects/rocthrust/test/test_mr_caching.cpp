@@ -0,0 +1,176 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/host_vector.h>
+#include <thrust/mr/caching.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/statistics.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include "test_header.hpp"
+
+using stats_resource = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+using cache_resource = thrust::mr::caching_resource<stats_resource>;
+
+TEST(MrCachingTests, TestSizeClasses)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource upstream;
+
+    {
+        cache_resource cache(&upstream);
+
+        // requests are rounded up to a quarter of their power of two, or to the smallest block size
+        void * small = cache.do_allocate(10);
+        void * medium = cache.do_allocate(1100);
+        ASSERT_EQ(upstream.statistics().bytes_in_use, 256u + 1280u);
+
+        cache.do_deallocate(small, 10);
+        cache.do_deallocate(medium, 1100);
+        ASSERT_EQ(cache.cached_bytes(), 256u + 1280u);
+        ASSERT_EQ(upstream.statistics().deallocations, 0u);
+
+        // requests of the same size class are served by the cached blocks
+        ASSERT_EQ(cache.do_allocate(200), small);
+        ASSERT_EQ(cache.do_allocate(1025), medium);
+        ASSERT_EQ(upstream.statistics().allocations, 2u);
+        ASSERT_EQ(cache.cached_bytes(), 0u);
+
+        // but not requests of another one
+        void * larger = cache.do_allocate(1281);
+        ASSERT_NE(larger, medium);
+        ASSERT_EQ(upstream.statistics().allocations, 3u);
+        ASSERT_EQ(upstream.statistics().bytes_in_use, 256u + 1280u + 1536u);
+
+        cache.do_deallocate(small, 200);
+        cache.do_deallocate(medium, 1025);
+        cache.do_deallocate(larger, 1281);
+
+        // alignments stricter than that of the blocks go to upstream directly
+        void * aligned = cache.do_allocate(100, 4096);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(aligned) % 4096, 0u);
+        cache.do_deallocate(aligned, 100, 4096);
+        ASSERT_EQ(upstream.statistics().allocations, 4u);
+        ASSERT_EQ(upstream.statistics().deallocations, 1u);
+    }
+
+    // destruction returns the cached blocks
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 0u);
+}
+
+TEST(MrCachingTests, TestCachedBytesLimit)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource upstream;
+
+    thrust::mr::caching_options options = cache_resource::get_default_options();
+    options.max_cached_bytes = 4096;
+
+    cache_resource cache(&upstream, options);
+
+    void * blocks[3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        blocks[i] = cache.do_allocate(2048);
+    }
+
+    // blocks deallocated while the cache is full go back to upstream
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        cache.do_deallocate(blocks[i], 2048);
+    }
+    ASSERT_EQ(cache.cached_bytes(), 4096u);
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 4096u);
+
+    cache.trim(2048);
+    ASSERT_EQ(cache.cached_bytes(), 2048u);
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 2048u);
+
+    // trim returns the largest blocks first
+    void * small = cache.do_allocate(256);
+    cache.do_deallocate(small, 256);
+    ASSERT_EQ(cache.cached_bytes(), 2048u + 256u);
+
+    cache.trim(1000);
+    ASSERT_EQ(cache.cached_bytes(), 256u);
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 256u);
+
+    cache.set_max_cached_bytes(0);
+    ASSERT_EQ(cache.cached_bytes(), 0u);
+    ASSERT_EQ(cache.options().max_cached_bytes, 0u);
+
+    cache.do_deallocate(cache.do_allocate(256), 256);
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 0u);
+}
+
+TEST(MrCachingTests, TestAlgorithmTemporaries)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource upstream;
+    cache_resource cache(&upstream);
+
+    thrust::host_vector<int> data(10000);
+
+    std::size_t allocations = 0;
+    for (std::size_t r = 0; r < 4; ++r)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<int>((i * 7919 + r) % 10007);
+        }
+
+        thrust::stable_sort(thrust::cpp::par(&cache), data.begin(), data.end());
+        ASSERT_TRUE(thrust::is_sorted(data.begin(), data.end()));
+
+        // the temporaries of every sort after the first come from the cache
+        if (r == 0)
+        {
+            allocations = upstream.statistics().allocations;
+            ASSERT_GT(allocations, 0u);
+        }
+        ASSERT_EQ(upstream.statistics().allocations, allocations);
+    }
+
+    cache.trim();
+    ASSERT_EQ(upstream.statistics().bytes_in_use, 0u);
+}
+
+TEST(MrCachingTests, TestWithCachedTemporaries)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<int> data(10000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>((i * 7919) % 10007);
+    }
+
+    thrust::stable_sort(thrust::cpp::par.with_cached_temporaries(), data.begin(), data.end());
+    ASSERT_TRUE(thrust::is_sorted(data.begin(), data.end()));
+
+    // every policy of the system shares the same cache, which keeps the temporaries of the sort
+    auto & cache = thrust::cpp::par.temporary_cache();
+    ASSERT_EQ(&cache, &thrust::cpp::par.temporary_cache());
+    ASSERT_GT(cache.cached_bytes(), 0u);
+
+    cache.trim();
+    ASSERT_EQ(cache.cached_bytes(), 0u);
+}
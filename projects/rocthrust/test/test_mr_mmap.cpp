@@ -0,0 +1,239 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/equal.h>
+#include <thrust/mapped_vector.h>
+#include <thrust/mr/mmap.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/transform.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "test_header.hpp"
+
+// the path of a file in the temporary directory of the tests, which is removed
+// when the object is destroyed
+class temporary_path
+{
+public:
+    explicit temporary_path(const char * name)
+        : path(testing::TempDir() + "/thrust_mmap_" + std::to_string(::getpid()) + "_" + name)
+    {
+        std::remove(path.c_str());
+    }
+
+    ~temporary_path()
+    {
+        std::remove(path.c_str());
+    }
+
+    const char * c_str() const
+    {
+        return path.c_str();
+    }
+
+private:
+    std::string path;
+};
+
+static void write_file(const char * path, const std::vector<int> & data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(int));
+}
+
+static std::vector<int> read_file(const char * path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    std::vector<int> ret(static_cast<std::size_t>(file.tellg()) / sizeof(int));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(ret.data()), ret.size() * sizeof(int));
+    return ret;
+}
+
+TEST(MrMmapTests, TestAllocation)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.advice = thrust::mr::mmap_advice::random;
+
+    // backed by memory files, and by temporary files in a directory
+    thrust::mr::mmap_resource memory(options);
+    thrust::mr::mmap_resource directory(testing::TempDir().c_str(), options);
+
+    for (thrust::mr::mmap_resource * resource : { &memory, &directory })
+    {
+        const std::size_t sizes[] = { 1, 100, 4096, 3 << 20 };
+        const std::size_t alignments[] = { 1, THRUST_MR_DEFAULT_ALIGNMENT, 4096, 1 << 20 };
+
+        for (std::size_t size : sizes)
+        {
+            for (std::size_t alignment : alignments)
+            {
+                void * p = resource->do_allocate(size, alignment);
+                ASSERT_EQ(reinterpret_cast<std::size_t>(p) % alignment, 0u);
+
+                // the memory is usable, and zeroed like a new file
+                char * bytes = static_cast<char *>(p);
+                ASSERT_EQ(bytes[0], 0);
+                ASSERT_EQ(bytes[size - 1], 0);
+                std::memset(p, 0x5a, size);
+                ASSERT_EQ(bytes[size - 1], 0x5a);
+
+                resource->advise(bytes + 1, size - 1, thrust::mr::mmap_advice::sequential);
+                resource->do_deallocate(p, size, alignment);
+            }
+        }
+    }
+
+    ASSERT_TRUE(memory.is_equal(directory));
+    ASSERT_EQ(memory.file_size(), 0u);
+}
+
+TEST(MrMmapTests, TestMappedVector)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::mapped_vector<int> v(1 << 20);
+    ASSERT_EQ(v[(1 << 20) - 1], 0);
+
+    thrust::sequence(v.begin(), v.end());
+    thrust::transform(v.begin(), v.end(), v.begin(), thrust::negate<int>());
+    thrust::sort(thrust::cpp::par, v.begin(), v.end());
+    ASSERT_EQ(v[0], -((1 << 20) - 1));
+    ASSERT_EQ(thrust::reduce(v.begin(), v.end(), 0LL), -((1LL << 20) - 1) * (1LL << 20) / 2);
+
+    v.resize(3 << 20);
+    ASSERT_EQ(v[(1 << 20) - 1], 0);
+
+    // vectors spilling to temporary files in a directory
+    thrust::mr::mmap_resource directory(testing::TempDir().c_str());
+    thrust::mapped_vector<int> w(v.begin(), v.end(), &directory);
+    ASSERT_TRUE(thrust::is_sorted(w.begin(), w.begin() + (1 << 20)));
+    ASSERT_EQ(w.size(), v.size());
+}
+
+TEST(MrMmapTests, TestFileContents)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    temporary_path path("contents");
+
+    std::vector<int> data(100000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>((i * 7919) % 100003);
+    }
+    write_file(path.c_str(), data);
+
+    // a private mapping sees the file, but doesn't change it
+    {
+        thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+        options.write_back = false;
+        options.advice = thrust::mr::mmap_advice::sequential;
+
+        thrust::mr::mmap_resource file(path.c_str(), options);
+        ASSERT_EQ(file.file_size(), data.size() * sizeof(int));
+
+        thrust::mapped_vector<int> v(data.size(), thrust::no_init, &file);
+        ASSERT_TRUE(thrust::equal(v.begin(), v.end(), data.begin()));
+
+        thrust::sort(thrust::cpp::par, v.begin(), v.end());
+        ASSERT_TRUE(thrust::is_sorted(v.begin(), v.end()));
+
+        // a read-only file can't be extended
+        ASSERT_THROW(thrust::mapped_vector<int>(10, &file), std::bad_alloc);
+    }
+    ASSERT_EQ(read_file(path.c_str()), data);
+
+    // a shared mapping writes the changes back to the file
+    {
+        thrust::mr::mmap_resource file(path.c_str());
+
+        thrust::mapped_vector<int> v(data.size(), thrust::no_init, &file);
+        thrust::sort(thrust::cpp::par, v.begin(), v.end());
+    }
+    std::vector<int> sorted = read_file(path.c_str());
+    ASSERT_EQ(sorted.size(), data.size());
+    ASSERT_TRUE(thrust::is_sorted(sorted.begin(), sorted.end()));
+}
+
+TEST(MrMmapTests, TestFileLayout)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    temporary_path path("layout");
+
+    const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    {
+        // the file is created, and extended by every allocation
+        thrust::mr::mmap_resource file(path.c_str());
+        ASSERT_EQ(file.file_size(), 0u);
+
+        int * a = static_cast<int *>(file.do_allocate(100 * sizeof(int), alignof(int)));
+        ASSERT_EQ(file.file_size(), 100 * sizeof(int));
+
+        // allocations start at page boundaries of the file
+        int * b = static_cast<int *>(file.do_allocate(10 * sizeof(int), alignof(int)));
+        ASSERT_EQ(file.file_size(), page_size + 10 * sizeof(int));
+
+        a[99] = 1;
+        b[0] = 2;
+
+        // the most recent allocation is taken back
+        file.do_deallocate(b, 10 * sizeof(int), alignof(int));
+        int * c = static_cast<int *>(file.do_allocate(10 * sizeof(int), alignof(int)));
+        ASSERT_EQ(c[0], 2);
+        ASSERT_EQ(file.file_size(), page_size + 10 * sizeof(int));
+        c[1] = 3;
+
+        file.do_deallocate(a, 100 * sizeof(int), alignof(int));
+        file.do_deallocate(c, 10 * sizeof(int), alignof(int));
+
+        ASSERT_FALSE(file.is_equal(thrust::mr::mmap_resource()));
+    }
+
+    std::vector<int> contents = read_file(path.c_str());
+    ASSERT_EQ(contents.size(), page_size / sizeof(int) + 10);
+    ASSERT_EQ(contents[99], 1);
+    ASSERT_EQ(contents[page_size / sizeof(int)], 2);
+    ASSERT_EQ(contents[page_size / sizeof(int) + 1], 3);
+}
+
+TEST(MrMmapTests, TestOpenError)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    temporary_path path("missing");
+
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.write_back = false;
+
+    ASSERT_THROW(thrust::mr::mmap_resource(path.c_str(), options), thrust::system_error);
+}
@@ -0,0 +1,171 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/host_vector.h>
+#include <thrust/mr/monotonic_buffer.h>
+#include <thrust/mr/new.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include "test_header.hpp"
+
+// an upstream resource which counts the regions allocated from it
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), live(0)
+    {
+    }
+
+    virtual void * do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        ++allocations;
+        ++live;
+        return upstream.do_allocate(n, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        --live;
+        upstream.do_deallocate(p, n, alignment);
+    }
+
+    std::size_t allocations;
+    std::size_t live;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+using arena_resource = thrust::mr::monotonic_buffer_resource<counting_resource>;
+
+TEST(MrMonotonicBufferTests, TestBumpAllocation)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+
+    {
+        arena_resource arena(&upstream, 1024);
+        ASSERT_EQ(upstream.allocations, 0u);
+
+        // consecutive allocations are adjacent, up to the padding for alignment
+        char * a1 = static_cast<char *>(arena.do_allocate(100, 4));
+        char * a2 = static_cast<char *>(arena.do_allocate(100, 4));
+        ASSERT_EQ(a2, a1 + 100);
+        ASSERT_EQ(upstream.allocations, 1u);
+
+        char * a3 = static_cast<char *>(arena.do_allocate(10, 64));
+        ASSERT_EQ(reinterpret_cast<std::size_t>(a3) % 64, 0u);
+        ASSERT_GE(a3, a2 + 100);
+
+        // deallocation reclaims nothing, except for the most recent allocation
+        arena.do_deallocate(a1, 100, 4);
+        char * a4 = static_cast<char *>(arena.do_allocate(10, 1));
+        ASSERT_EQ(a4, a3 + 10);
+
+        arena.do_deallocate(a4, 10, 1);
+        char * a5 = static_cast<char *>(arena.do_allocate(10, 1));
+        ASSERT_EQ(a5, a4);
+
+        ASSERT_EQ(upstream.allocations, 1u);
+        ASSERT_EQ(arena.capacity(), 1024u);
+
+        // reset rewinds the region without returning it to upstream
+        arena.reset();
+        ASSERT_EQ(arena.do_allocate(100, 4), a1);
+        ASSERT_EQ(upstream.allocations, 1u);
+        ASSERT_EQ(upstream.live, 1u);
+
+        arena.release();
+        ASSERT_EQ(upstream.live, 0u);
+
+        // destruction returns the regions too
+        (void) arena.do_allocate(100);
+        ASSERT_EQ(upstream.live, 1u);
+    }
+
+    ASSERT_EQ(upstream.live, 0u);
+}
+
+TEST(MrMonotonicBufferTests, TestGrowth)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+    arena_resource arena(&upstream, 1024);
+
+    // regions double in size when they are exhausted, and requests larger than that get a region of their own size
+    for (std::size_t i = 0; i < 7; ++i)
+    {
+        (void) arena.do_allocate(1000);
+    }
+    ASSERT_EQ(upstream.allocations, 3u);
+    ASSERT_EQ(arena.capacity(), 1024u + 2048u + 4096u);
+
+    char * large = static_cast<char *>(arena.do_allocate(100000));
+    ASSERT_EQ(upstream.allocations, 4u);
+    ASSERT_EQ(reinterpret_cast<std::size_t>(large) % THRUST_MR_DEFAULT_ALIGNMENT, 0u);
+    ASSERT_EQ(arena.capacity(), 1024u + 2048u + 4096u + 100000u);
+
+    // reset coalesces the regions, so that the same workload fits in a single region afterwards
+    arena.reset();
+    ASSERT_EQ(upstream.allocations, 5u);
+    ASSERT_EQ(upstream.live, 1u);
+    ASSERT_EQ(arena.capacity(), 1024u + 2048u + 4096u + 100000u);
+
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+        for (std::size_t i = 0; i < 7; ++i)
+        {
+            (void) arena.do_allocate(1000);
+        }
+        (void) arena.do_allocate(100000);
+        arena.reset();
+    }
+    ASSERT_EQ(upstream.allocations, 5u);
+    ASSERT_EQ(upstream.live, 1u);
+}
+
+TEST(MrMonotonicBufferTests, TestAlgorithmTemporaries)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+    arena_resource arena(&upstream, 1 << 16);
+
+    thrust::host_vector<int> data(10000);
+
+    for (std::size_t r = 0; r < 4; ++r)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<int>((i * 7919 + r) % 10007);
+        }
+
+        thrust::stable_sort(thrust::cpp::par(&arena), data.begin(), data.end());
+        ASSERT_TRUE(thrust::is_sorted(data.begin(), data.end()));
+
+        arena.reset();
+    }
+
+    // the temporaries of every sort after the first come from the region kept by the previous reset
+    std::size_t allocations = upstream.allocations;
+    thrust::stable_sort(thrust::cpp::par(&arena), data.begin(), data.end());
+    ASSERT_EQ(upstream.allocations, allocations);
+    ASSERT_EQ(upstream.live, 1u);
+}
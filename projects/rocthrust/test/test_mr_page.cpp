@@ -0,0 +1,129 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/page.h>
+#include <thrust/sequence.h>
+
+#include <cstring>
+
+#include "test_header.hpp"
+
+// every combination of the page and placement policies; the policies the
+// system can't honour fall back to ordinary pages and first touch placement
+static std::vector<thrust::mr::page_options> all_options()
+{
+    std::vector<thrust::mr::page_options> ret;
+
+    const thrust::mr::huge_page_policy huge_pages[] = { thrust::mr::huge_page_policy::none,
+                                                        thrust::mr::huge_page_policy::transparent,
+                                                        thrust::mr::huge_page_policy::hugetlb };
+    const thrust::mr::numa_policy placements[] = { thrust::mr::numa_policy::first_touch,
+                                                   thrust::mr::numa_policy::interleave,
+                                                   thrust::mr::numa_policy::bind };
+
+    for (thrust::mr::huge_page_policy huge : huge_pages)
+    {
+        for (thrust::mr::numa_policy placement : placements)
+        {
+            thrust::mr::page_options options = thrust::mr::page_resource::get_default_options();
+            options.huge_pages = huge;
+            options.placement = placement;
+            // node 0 always exists
+            options.numa_nodes = placement == thrust::mr::numa_policy::bind ? 1 : 0;
+            ret.push_back(options);
+        }
+    }
+
+    return ret;
+}
+
+TEST(MrPageTests, TestAllocation)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (const thrust::mr::page_options & options : all_options())
+    {
+        SCOPED_TRACE(testing::Message() << "with huge_pages= " << static_cast<int>(options.huge_pages)
+                                        << ", placement= " << static_cast<int>(options.placement));
+
+        thrust::mr::page_resource resource(options);
+
+        const std::size_t sizes[] = { 1, 100, 4096, 3 << 20, 5 << 20 };
+        const std::size_t alignments[] = { 1, THRUST_MR_DEFAULT_ALIGNMENT, 4096, 4 << 20 };
+
+        for (std::size_t size : sizes)
+        {
+            for (std::size_t alignment : alignments)
+            {
+                void * p = resource.do_allocate(size, alignment);
+                ASSERT_EQ(reinterpret_cast<std::size_t>(p) % alignment, 0u);
+
+                // the memory is usable, and zeroed like all memory fresh from the system
+                char * bytes = static_cast<char *>(p);
+                ASSERT_EQ(bytes[0], 0);
+                ASSERT_EQ(bytes[size - 1], 0);
+                std::memset(p, 0x5a, size);
+                ASSERT_EQ(bytes[size - 1], 0x5a);
+
+                resource.do_deallocate(p, size, alignment);
+            }
+        }
+    }
+}
+
+TEST(MrPageTests, TestHostVector)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    using allocator = thrust::mr::allocator<int, thrust::mr::page_resource>;
+
+    for (const thrust::mr::page_options & options : all_options())
+    {
+        thrust::mr::page_resource resource(options);
+
+        thrust::host_vector<int, allocator> v(1 << 20, &resource);
+        thrust::sequence(v.begin(), v.end());
+        ASSERT_EQ(v[12345], 12345);
+
+        v.resize(3 << 20);
+        ASSERT_EQ(v[(1 << 20) - 1], (1 << 20) - 1);
+    }
+
+    // the resource obtained by get_global_resource uses the default options
+    using global_allocator = thrust::mr::stateless_resource_allocator<int, thrust::mr::page_resource>;
+
+    thrust::host_vector<int, global_allocator> w(1 << 20, 7);
+    ASSERT_EQ(w[(1 << 20) - 1], 7);
+}
+
+TEST(MrPageTests, TestEquality)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::mr::page_options options = thrust::mr::page_resource::get_default_options();
+
+    thrust::mr::page_resource r1(options);
+    options.placement = thrust::mr::numa_policy::interleave;
+    thrust::mr::page_resource r2(options);
+    options.huge_pages = thrust::mr::huge_page_policy::none;
+    thrust::mr::page_resource r3(options);
+
+    ASSERT_TRUE(r1.is_equal(r2));
+    ASSERT_FALSE(r1.is_equal(r3));
+}
@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -17,8 +17,13 @@
 
 #include <thrust/mr/pool.h>
 #include <thrust/mr/sync_pool.h>
+#include <thrust/mr/concurrent_pool.h>
 #include <thrust/mr/new.h>
 
+#include <new>
+#include <thread>
+#include <vector>
+
 
 #include "test_header.hpp"
 
@@ -263,6 +268,13 @@ TEST(MrPoolTests, TestSynchronizedPool)
     TestPool<thrust::mr::synchronized_pool_resource>();
 }
 
+TEST(MrPoolTests, TestConcurrentPool)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPool<thrust::mr::concurrent_pool_resource>();
+}
+
 template<template<typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -344,6 +356,136 @@ TEST(MrPoolTests, TestSynchronizedPoolCachingOversized)
     TestPoolCachingOversized<thrust::mr::synchronized_pool_resource>();
 }
 
+TEST(MrPoolTests, TestConcurrentPoolCachingOversized)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolCachingOversized<thrust::mr::concurrent_pool_resource>();
+}
+
+template<template<typename> class PoolTemplate>
+void TestPoolCachedBuckets()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    using Pool = PoolTemplate<tracked_resource>;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+    opts.cached_size_cutoff_factor = 4;
+    opts.cached_alignment_cutoff_factor = 4;
+
+    Pool pool(&upstream, opts);
+
+    // cache oversized blocks of several sizes and alignments; the cached
+    // blocks are kept in four buckets per power of two of their size
+    upstream.id_to_allocate = 1;
+    tracked_pointer<void> a1 = pool.do_allocate(2048, 32);
+    upstream.id_to_allocate = 2;
+    tracked_pointer<void> a2 = pool.do_allocate(3072, 32);
+    upstream.id_to_allocate = 3;
+    tracked_pointer<void> a3 = pool.do_allocate(3072, 256);
+    upstream.id_to_allocate = 4;
+    tracked_pointer<void> a4 = pool.do_allocate(8192, 32);
+    upstream.id_to_allocate = 5;
+    tracked_pointer<void> a5 = pool.do_allocate(4096, 1024);
+    upstream.id_to_allocate = 6;
+    tracked_pointer<void> a6 = pool.do_allocate(65536, 32);
+
+    pool.do_deallocate(a1, 2048, 32);
+    pool.do_deallocate(a2, 3072, 32);
+    pool.do_deallocate(a3, 3072, 256);
+    pool.do_deallocate(a4, 8192, 32);
+    pool.do_deallocate(a5, 4096, 1024);
+    pool.do_deallocate(a6, 65536, 32);
+
+    // from here on, upstream is only expected to be called where an id is set
+
+    // the block of the request's own bucket is too small, and the most
+    // recently cached block of the next bucket is too aligned, so the other
+    // block of that bucket is used
+    tracked_pointer<void> b1 = pool.do_allocate(2100, 32);
+    ASSERT_EQ(b1.id, 2u);
+
+    // a reused block is cached again by its full size
+    pool.do_deallocate(b1, 2100, 32);
+    tracked_pointer<void> b2 = pool.do_allocate(2600, 32);
+    ASSERT_EQ(b2.id, 2u);
+
+    // an overaligned block is used when its alignment is within the cutoff
+    tracked_pointer<void> b3 = pool.do_allocate(3000, 128);
+    ASSERT_EQ(b3.id, 3u);
+
+    // a block up to the size cutoff larger is used
+    tracked_pointer<void> b4 = pool.do_allocate(1100, 32);
+    ASSERT_EQ(b4.id, 1u);
+
+    // the next bucket only holds a block which is too aligned, and the
+    // blocks of the buckets after it are too large, so a new block is
+    // allocated
+    upstream.id_to_allocate = 7;
+    tracked_pointer<void> b5 = pool.do_allocate(1500, 32);
+    ASSERT_EQ(b5.id, 7u);
+    ASSERT_EQ(upstream.id_to_allocate, 0u);
+
+    // within both cutoffs
+    tracked_pointer<void> b6 = pool.do_allocate(2048, 512);
+    ASSERT_EQ(b6.id, 5u);
+
+    // the only cached block left that is large enough is larger by the size cutoff
+    upstream.id_to_allocate = 8;
+    tracked_pointer<void> b7 = pool.do_allocate(16384, 32);
+    ASSERT_EQ(b7.id, 8u);
+    ASSERT_EQ(upstream.id_to_allocate, 0u);
+
+    tracked_pointer<void> b8 = pool.do_allocate(20000, 32);
+    ASSERT_EQ(b8.id, 6u);
+
+    // the block of the request's own bucket isn't aligned enough
+    upstream.id_to_allocate = 9;
+    tracked_pointer<void> b9 = pool.do_allocate(8192, 64);
+    ASSERT_EQ(b9.id, 9u);
+    ASSERT_EQ(upstream.id_to_allocate, 0u);
+
+    tracked_pointer<void> b10 = pool.do_allocate(8000, 32);
+    ASSERT_EQ(b10.id, 4u);
+
+    // a block of the request's own bucket is used when none of the larger
+    // buckets has one
+    pool.do_deallocate(b5, 1500, 32);
+    tracked_pointer<void> b11 = pool.do_allocate(1400, 32);
+    ASSERT_EQ(b11.id, 7u);
+
+    // every cached block was handed out again
+    upstream.id_to_allocate = 10;
+    tracked_pointer<void> b12 = pool.do_allocate(2048, 32);
+    ASSERT_EQ(b12.id, 10u);
+}
+
+TEST(MrPoolTests, TestUnsynchronizedPoolCachedBuckets)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolCachedBuckets<thrust::mr::unsynchronized_pool_resource>();
+}
+
+TEST(MrPoolTests, TestSynchronizedPoolCachedBuckets)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolCachedBuckets<thrust::mr::synchronized_pool_resource>();
+}
+
+TEST(MrPoolTests, TestConcurrentPoolCachedBuckets)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolCachedBuckets<thrust::mr::concurrent_pool_resource>();
+}
+
 template<template<typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -365,3 +507,151 @@ TEST(MrPoolTests, TestSynchronizedGlobalPool)
 
     TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
+
+TEST(MrPoolTests, TestConcurrentGlobalPool)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestGlobalPool<thrust::mr::concurrent_pool_resource>();
+}
+
+TEST(MrPoolTests, TestConcurrentPoolThreads)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    using Pool = thrust::mr::concurrent_pool_resource<thrust::mr::new_delete_resource>;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.largest_block_size = 1 << 12;
+
+    Pool pool(opts);
+
+    const std::size_t num_threads = 8;
+    const std::size_t blocks_per_thread = 2000;
+
+    struct block
+    {
+        unsigned char * ptr;
+        std::size_t size;
+        unsigned char tag;
+    };
+
+    std::vector<std::vector<block>> blocks(num_threads);
+
+    // every thread allocates blocks of various sizes, including oversized ones, and fills them
+    // with its own tag; blocks are freed and allocated again along the way, so that the caches
+    // exchange batches with the central pools
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            std::vector<block> & mine = blocks[t];
+            for (std::size_t i = 0; i < blocks_per_thread; ++i)
+            {
+                block b;
+                b.size = 1 + (i * 37 + t * 101) % (1 << 13);
+                b.tag = static_cast<unsigned char>(t + 1);
+                b.ptr = static_cast<unsigned char *>(pool.do_allocate(b.size, THRUST_MR_DEFAULT_ALIGNMENT));
+                std::fill(b.ptr, b.ptr + b.size, b.tag);
+                mine.push_back(b);
+
+                if (i % 3 == 2)
+                {
+                    block freed = mine[mine.size() - 2];
+                    mine.erase(mine.end() - 2);
+                    pool.do_deallocate(freed.ptr, freed.size, THRUST_MR_DEFAULT_ALIGNMENT);
+                }
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    // no block was handed out twice, so every block still holds its tag; the blocks are then
+    // returned from a thread other than the one that allocated them
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            std::vector<block> & theirs = blocks[(t + 1) % num_threads];
+            for (const block & b : theirs)
+            {
+                bool intact = std::all_of(b.ptr, b.ptr + b.size, [&](unsigned char c) { return c == b.tag; });
+                EXPECT_EQ(intact, true);
+                pool.do_deallocate(b.ptr, b.size, THRUST_MR_DEFAULT_ALIGNMENT);
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    pool.release();
+}
+
+// an upstream resource that throws std::bad_alloc while failing is set, and
+// counts the allocations that were not returned
+class failing_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    bool failing = false;
+    std::size_t outstanding = 0;
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (failing)
+        {
+            throw std::bad_alloc();
+        }
+
+        void * p = upstream.do_allocate(bytes, alignment);
+        ++outstanding;
+        return p;
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        upstream.do_deallocate(p, bytes, alignment);
+        --outstanding;
+    }
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+TEST(MrPoolTests, TestConcurrentPoolUpstreamFailure)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    using Pool = thrust::mr::concurrent_pool_resource<failing_resource>;
+
+    failing_resource upstream;
+
+    {
+        Pool pool(&upstream);
+
+        void * a = pool.do_allocate(64);
+
+        // refilling the cache of this thread grows a central pool, which fails
+        upstream.failing = true;
+        ASSERT_THROW((void)pool.do_allocate(1024), std::bad_alloc);
+        ASSERT_THROW((void)pool.do_allocate(1 << 30), std::bad_alloc);
+
+        upstream.failing = false;
+        void * b = pool.do_allocate(1024);
+
+        pool.do_deallocate(a, 64);
+        pool.do_deallocate(b, 1024);
+
+        // waits for every cache, so it only returns if none was left claimed
+        pool.release();
+
+        a = pool.do_allocate(64);
+        pool.do_deallocate(a, 64);
+    }
+
+    ASSERT_EQ(upstream.outstanding, 0u);
+}
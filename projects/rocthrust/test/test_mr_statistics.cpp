@@ -0,0 +1,198 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/host_vector.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/statistics.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <thread>
+#include <vector>
+
+#include "test_header.hpp"
+
+using stats_resource = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+
+TEST(MrStatisticsTests, TestCounters)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource resource;
+
+    void * a1 = resource.do_allocate(100);
+    void * a2 = resource.do_allocate(1000);
+    void * a3 = resource.do_allocate(1);
+
+    thrust::mr::allocation_statistics stats = resource.statistics();
+    ASSERT_EQ(stats.allocations, 3u);
+    ASSERT_EQ(stats.deallocations, 0u);
+    ASSERT_EQ(stats.bytes_allocated, 1101u);
+    ASSERT_EQ(stats.bytes_in_use, 1101u);
+    ASSERT_EQ(stats.peak_bytes_in_use, 1101u);
+
+    resource.do_deallocate(a2, 1000);
+    void * a4 = resource.do_allocate(128);
+
+    stats = resource.statistics();
+    ASSERT_EQ(stats.allocations, 4u);
+    ASSERT_EQ(stats.deallocations, 1u);
+    ASSERT_EQ(stats.bytes_allocated, 1229u);
+    ASSERT_EQ(stats.bytes_in_use, 229u);
+    ASSERT_EQ(stats.peak_bytes_in_use, 1101u);
+
+    // 1 byte, 100 bytes in (64, 128], 128 bytes in (64, 128], 1000 bytes in (512, 1024]
+    ASSERT_EQ(stats.size_histogram[0], 1u);
+    ASSERT_EQ(stats.size_histogram[7], 2u);
+    ASSERT_EQ(stats.size_histogram[10], 1u);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < thrust::mr::allocation_statistics::histogram_size; ++i)
+    {
+        total += stats.size_histogram[i];
+    }
+    ASSERT_EQ(total, 4u);
+
+    // the peak can be measured again from the bytes currently in use
+    resource.reset_peak();
+    ASSERT_EQ(resource.statistics().peak_bytes_in_use, 229u);
+
+    resource.do_deallocate(a1, 100);
+    resource.do_deallocate(a3, 1);
+    resource.do_deallocate(a4, 128);
+
+    stats = resource.statistics();
+    ASSERT_EQ(stats.deallocations, 4u);
+    ASSERT_EQ(stats.bytes_in_use, 0u);
+    ASSERT_EQ(stats.peak_bytes_in_use, 229u);
+}
+
+TEST(MrStatisticsTests, TestTags)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource resource;
+
+    void * untagged = resource.do_allocate(64);
+
+    {
+        thrust::mr::statistics_tag outer("outer");
+        void * a1 = resource.do_allocate(100);
+
+        {
+            thrust::mr::statistics_tag inner("inner");
+            resource.do_deallocate(resource.do_allocate(1000), 1000);
+            resource.do_deallocate(resource.do_allocate(500), 500);
+        }
+
+        resource.do_deallocate(a1, 100);
+    }
+
+    resource.do_deallocate(untagged, 64);
+
+    thrust::mr::allocation_statistics outer = resource.tag_statistics("outer");
+    ASSERT_EQ(outer.allocations, 1u);
+    ASSERT_EQ(outer.deallocations, 1u);
+    ASSERT_EQ(outer.bytes_allocated, 100u);
+    ASSERT_EQ(outer.bytes_in_use, 0u);
+    ASSERT_EQ(outer.peak_bytes_in_use, 100u);
+
+    thrust::mr::allocation_statistics inner = resource.tag_statistics("inner");
+    ASSERT_EQ(inner.allocations, 2u);
+    ASSERT_EQ(inner.bytes_allocated, 1500u);
+    ASSERT_EQ(inner.peak_bytes_in_use, 1000u);
+
+    ASSERT_EQ(resource.tag_statistics("unused").allocations, 0u);
+
+    std::vector<std::string> tags = resource.tags();
+    ASSERT_EQ(tags.size(), 2u);
+    ASSERT_EQ(tags[0], "inner");
+    ASSERT_EQ(tags[1], "outer");
+
+    ASSERT_EQ(resource.statistics().allocations, 4u);
+    ASSERT_EQ(resource.statistics().peak_bytes_in_use, 1164u);
+}
+
+TEST(MrStatisticsTests, TestThreads)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource resource;
+
+    const std::size_t num_threads = 8;
+    const std::size_t num_allocations = 1000;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&resource, t]
+        {
+            thrust::mr::statistics_tag tag(t % 2 ? "odd" : "even");
+
+            std::vector<void *> blocks;
+            for (std::size_t i = 0; i < num_allocations; ++i)
+            {
+                blocks.push_back(resource.do_allocate(16));
+            }
+            for (void * block : blocks)
+            {
+                resource.do_deallocate(block, 16);
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    thrust::mr::allocation_statistics stats = resource.statistics();
+    ASSERT_EQ(stats.allocations, num_threads * num_allocations);
+    ASSERT_EQ(stats.deallocations, num_threads * num_allocations);
+    ASSERT_EQ(stats.bytes_in_use, 0u);
+    ASSERT_GE(stats.peak_bytes_in_use, num_allocations * 16);
+    ASSERT_LE(stats.peak_bytes_in_use, num_threads * num_allocations * 16);
+
+    ASSERT_EQ(resource.tag_statistics("odd").allocations, num_threads / 2 * num_allocations);
+    ASSERT_EQ(resource.tag_statistics("even").bytes_in_use, 0u);
+}
+
+TEST(MrStatisticsTests, TestAlgorithmTemporaries)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    stats_resource & resource = *thrust::mr::get_global_resource<stats_resource>();
+    resource.reset_peak();
+
+    thrust::host_vector<int> data(10000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>((i * 7919) % 10007);
+    }
+
+    {
+        thrust::mr::statistics_tag tag("stable_sort");
+        thrust::stable_sort(thrust::cpp::par(&resource), data.begin(), data.end());
+    }
+    ASSERT_TRUE(thrust::is_sorted(data.begin(), data.end()));
+
+    // the temporary storage of the sort was recorded, and has been freed
+    thrust::mr::allocation_statistics stats = resource.tag_statistics("stable_sort");
+    ASSERT_GE(stats.allocations, 1u);
+    ASSERT_EQ(stats.allocations, stats.deallocations);
+    ASSERT_GE(stats.peak_bytes_in_use, data.size() * sizeof(int));
+    ASSERT_EQ(stats.bytes_in_use, 0u);
+}
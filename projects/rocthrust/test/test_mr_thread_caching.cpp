@@ -0,0 +1,285 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/thread_caching.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_header.hpp"
+
+// a thread-safe upstream resource which counts the blocks allocated from it
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), live(0)
+    {
+    }
+
+    virtual void * do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        ++allocations;
+        ++live;
+        return upstream.do_allocate(n, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        --live;
+        upstream.do_deallocate(p, n, alignment);
+    }
+
+    std::atomic<std::size_t> allocations;
+    std::atomic<std::size_t> live;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+using caching_resource = thrust::mr::thread_caching_resource<counting_resource>;
+
+TEST(MrThreadCachingTests, TestReuse)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+
+    {
+        caching_resource resource(&upstream);
+
+        void * a1 = resource.do_allocate(100);
+        ASSERT_EQ(upstream.allocations.load(), 1u);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(a1) % THRUST_MR_DEFAULT_ALIGNMENT, 0u);
+
+        // a deallocated block is cached, and handed out again for a request of the same size class
+        resource.do_deallocate(a1, 100);
+        ASSERT_EQ(resource.cached_bytes(), 128u);
+
+        void * a2 = resource.do_allocate(120);
+        ASSERT_EQ(a1, a2);
+        ASSERT_EQ(upstream.allocations.load(), 1u);
+        ASSERT_EQ(resource.cached_bytes(), 0u);
+
+        // oversized and overaligned requests go to upstream directly
+        void * a3 = resource.do_allocate(caching_resource::get_default_options().largest_block_size * 2);
+        void * a4 = resource.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT * 4);
+        ASSERT_EQ(upstream.allocations.load(), 3u);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(a4) % (THRUST_MR_DEFAULT_ALIGNMENT * 4), 0u);
+
+        resource.do_deallocate(a3, caching_resource::get_default_options().largest_block_size * 2);
+        resource.do_deallocate(a4, 64, THRUST_MR_DEFAULT_ALIGNMENT * 4);
+        ASSERT_EQ(upstream.live.load(), 1u);
+
+        resource.do_deallocate(a2, 120);
+
+        // release returns the cached blocks to upstream
+        resource.release();
+        ASSERT_EQ(upstream.live.load(), 0u);
+        ASSERT_EQ(resource.cached_bytes(), 0u);
+
+        // and destruction does too
+        resource.do_deallocate(resource.do_allocate(16), 16);
+        ASSERT_EQ(upstream.live.load(), 1u);
+    }
+
+    ASSERT_EQ(upstream.live.load(), 0u);
+}
+
+TEST(MrThreadCachingTests, TestBoundedRetention)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+
+    thrust::mr::thread_caching_options opts = caching_resource::get_default_options();
+    opts.max_cached_bytes = 4096;
+
+    caching_resource resource(&upstream, opts);
+
+    std::vector<void *> blocks;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        blocks.push_back(resource.do_allocate(256));
+    }
+
+    // once the cache exceeds its limit, it's trimmed to half of it
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+        resource.do_deallocate(blocks[i], 256);
+        ASSERT_LE(resource.cached_bytes(), opts.max_cached_bytes);
+    }
+    ASSERT_EQ(upstream.live.load() * 256, resource.cached_bytes());
+}
+
+TEST(MrThreadCachingTests, TestRemoteFrees)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+    caching_resource resource(&upstream);
+
+    const std::size_t num_blocks = 1000;
+
+    std::vector<void *> blocks;
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        blocks.push_back(resource.do_allocate(64));
+    }
+    ASSERT_EQ(upstream.allocations.load(), num_blocks);
+
+    // the blocks are freed by another thread; they go back to the cache of this one
+    std::thread consumer([&] {
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            resource.do_deallocate(blocks[i], 64);
+        }
+    });
+    consumer.join();
+
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        blocks[i] = resource.do_allocate(64);
+    }
+    ASSERT_EQ(upstream.allocations.load(), num_blocks);
+
+    // blocks allocated by a thread that has exited are returned to upstream when they are freed
+    std::thread producer([&] {
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            resource.do_deallocate(blocks[i], 64);
+            blocks[i] = resource.do_allocate(32);
+        }
+    });
+    producer.join();
+
+    // the exiting producer returned the blocks it had cached to upstream
+    ASSERT_EQ(upstream.live.load(), 2 * num_blocks);
+
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        resource.do_deallocate(blocks[i], 32);
+    }
+    ASSERT_EQ(upstream.live.load(), num_blocks);
+
+    // the blocks this thread allocated and the producer freed are collected by the next allocation
+    void * a = resource.do_allocate(64);
+    ASSERT_EQ(resource.cached_bytes(), (num_blocks - 1) * 64);
+    ASSERT_EQ(upstream.allocations.load(), 2 * num_blocks);
+
+    resource.do_deallocate(a, 64);
+}
+
+TEST(MrThreadCachingTests, TestProducersAndConsumers)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_resource upstream;
+
+    {
+        thrust::mr::thread_caching_options opts = caching_resource::get_default_options();
+        opts.max_cached_bytes = 1 << 16;
+
+        caching_resource resource(&upstream, opts);
+
+        const std::size_t num_pairs = 4;
+        const std::size_t blocks_per_producer = 20000;
+        const std::size_t queue_size = 256;
+
+        struct block
+        {
+            unsigned char * ptr;
+            std::size_t size;
+        };
+
+        // every producer hands its blocks to a consumer through a single producer, single consumer ring
+        struct ring
+        {
+            std::vector<block> slots;
+            std::atomic<std::size_t> head;
+            std::atomic<std::size_t> tail;
+
+            ring(std::size_t n) : slots(n), head(0), tail(0)
+            {
+            }
+        };
+
+        std::vector<std::unique_ptr<ring>> rings;
+        for (std::size_t p = 0; p < num_pairs; ++p)
+        {
+            rings.emplace_back(new ring(queue_size));
+        }
+
+        std::atomic<std::size_t> corrupted(0);
+
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < num_pairs; ++p)
+        {
+            threads.emplace_back([&, p] {
+                ring & r = *rings[p];
+                for (std::size_t i = 0; i < blocks_per_producer; ++i)
+                {
+                    block b;
+                    b.size = 1 + (i * 131 + p * 17) % 4096;
+                    b.ptr = static_cast<unsigned char *>(resource.do_allocate(b.size));
+                    std::fill(b.ptr, b.ptr + b.size, static_cast<unsigned char>(i));
+
+                    std::size_t head = r.head.load(std::memory_order_relaxed);
+                    while (head - r.tail.load(std::memory_order_acquire) == r.slots.size())
+                    {
+                        std::this_thread::yield();
+                    }
+                    r.slots[head % r.slots.size()] = b;
+                    r.head.store(head + 1, std::memory_order_release);
+                }
+            });
+
+            threads.emplace_back([&, p] {
+                ring & r = *rings[p];
+                for (std::size_t i = 0; i < blocks_per_producer; ++i)
+                {
+                    std::size_t tail = r.tail.load(std::memory_order_relaxed);
+                    while (r.head.load(std::memory_order_acquire) == tail)
+                    {
+                        std::this_thread::yield();
+                    }
+                    block b = r.slots[tail % r.slots.size()];
+                    r.tail.store(tail + 1, std::memory_order_release);
+
+                    if (!std::all_of(b.ptr, b.ptr + b.size, [&](unsigned char c) { return c == static_cast<unsigned char>(i); }))
+                    {
+                        ++corrupted;
+                    }
+                    resource.do_deallocate(b.ptr, b.size);
+                }
+            });
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(corrupted.load(), 0u);
+
+        // all threads have exited, so nothing is cached anymore
+        ASSERT_EQ(upstream.live.load(), 0u);
+    }
+
+    ASSERT_EQ(upstream.live.load(), 0u);
+}
@@ -0,0 +1,239 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <random>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(MultiwayMergePrimitiveTests, NumericalTestsParams);
+
+// Sizes of runs totalling size elements, with a mix of empty, short and long runs
+thrust::host_vector<size_t> get_random_run_sizes(size_t size, int seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> short_length(0, 40);
+
+    thrust::host_vector<size_t> sizes;
+    size_t total = 0;
+    while(total < size)
+    {
+        const size_t length = engine() % 16 == 0 ? size / 4 + 1 : short_length(engine);
+        sizes.push_back((std::min)(size - total, length));
+        total += sizes.back();
+    }
+    return sizes;
+}
+
+// Describes the runs of the given sizes, which are consecutive in the range beginning at first
+template <typename T>
+thrust::host_vector<thrust::pair<T*, T*>> get_runs(T* first, const thrust::host_vector<size_t>& sizes)
+{
+    thrust::host_vector<thrust::pair<T*, T*>> runs(sizes.size());
+    for(size_t i = 0; i < sizes.size(); i++)
+    {
+        runs[i] = thrust::make_pair(first, first + sizes[i]);
+        first += sizes[i];
+    }
+    return runs;
+}
+
+TYPED_TEST(MultiwayMergePrimitiveTests, TestMultiwayMergeSimple)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // runs {0, 2, 4}, {}, {1, 4} and {3}
+    thrust::host_vector<T> h_input(6);
+    h_input[0] = T(0);
+    h_input[1] = T(2);
+    h_input[2] = T(4);
+    h_input[3] = T(1);
+    h_input[4] = T(4);
+    h_input[5] = T(3);
+
+    thrust::host_vector<size_t> sizes(4);
+    sizes[0] = 3;
+    sizes[1] = 0;
+    sizes[2] = 2;
+    sizes[3] = 1;
+
+    thrust::device_vector<T> d_input = h_input;
+    thrust::device_vector<T> d_result(6);
+
+    thrust::device_vector<thrust::pair<T*, T*>> d_runs
+        = get_runs(thrust::raw_pointer_cast(d_input.data()), sizes);
+
+    auto end = thrust::multiway_merge(d_runs.begin(), d_runs.end(), d_result.begin());
+
+    ASSERT_EQ(end - d_result.begin(), 6);
+
+    thrust::host_vector<T> h_result = d_result;
+    ASSERT_EQ(h_result[0], T(0));
+    ASSERT_EQ(h_result[1], T(1));
+    ASSERT_EQ(h_result[2], T(2));
+    ASSERT_EQ(h_result[3], T(3));
+    ASSERT_EQ(h_result[4], T(4));
+    ASSERT_EQ(h_result[5], T(4));
+
+    end = thrust::multiway_merge(d_runs.begin(), d_runs.begin(), d_result.begin());
+
+    ASSERT_EQ(end - d_result.begin(), 0);
+}
+
+TYPED_TEST(MultiwayMergePrimitiveTests, TestMultiwayMerge)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_input = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<size_t> sizes = get_random_run_sizes(size, seed);
+
+            // sort every run in descending order
+            for(auto run : get_runs(thrust::raw_pointer_cast(h_input.data()), sizes))
+            {
+                thrust::sort(run.first, run.second, thrust::greater<T>());
+            }
+
+            thrust::device_vector<T> d_input = h_input;
+
+            thrust::host_vector<thrust::pair<T*, T*>> h_runs
+                = get_runs(thrust::raw_pointer_cast(h_input.data()), sizes);
+            thrust::device_vector<thrust::pair<T*, T*>> d_runs
+                = get_runs(thrust::raw_pointer_cast(d_input.data()), sizes);
+
+            thrust::host_vector<T>   h_result(size);
+            thrust::device_vector<T> d_result(size);
+
+            auto h_end = thrust::multiway_merge(
+                h_runs.begin(), h_runs.end(), h_result.begin(), thrust::greater<T>());
+            auto d_end = thrust::multiway_merge(
+                d_runs.begin(), d_runs.end(), d_result.begin(), thrust::greater<T>());
+
+            ASSERT_EQ(static_cast<size_t>(h_end - h_result.begin()), size);
+            ASSERT_EQ(static_cast<size_t>(d_end - d_result.begin()), size);
+
+            thrust::host_vector<T> h_reference = h_input;
+            thrust::stable_sort(h_reference.begin(), h_reference.end(), thrust::greater<T>());
+
+            test_equality(h_reference, h_result);
+            test_equality(h_reference, d_result);
+        }
+    }
+}
+
+TYPED_TEST(MultiwayMergePrimitiveTests, TestMultiwayMergeByKey)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            // few distinct keys, so that equal keys come from several runs
+            thrust::host_vector<int> h_int_keys = get_random_data<int>(size, 0, 15, seed);
+            thrust::host_vector<T>   h_keys(h_int_keys.begin(), h_int_keys.end());
+            thrust::host_vector<size_t> sizes = get_random_run_sizes(size, seed);
+
+            for(auto run : get_runs(thrust::raw_pointer_cast(h_keys.data()), sizes))
+            {
+                thrust::sort(run.first, run.second);
+            }
+
+            // every value is the position of its key in the input
+            thrust::host_vector<size_t> h_values(size);
+            thrust::sequence(h_values.begin(), h_values.end());
+
+            thrust::device_vector<T>      d_keys   = h_keys;
+            thrust::device_vector<size_t> d_values = h_values;
+
+            thrust::host_vector<thrust::pair<T*, T*>> h_key_runs
+                = get_runs(thrust::raw_pointer_cast(h_keys.data()), sizes);
+            thrust::device_vector<thrust::pair<T*, T*>> d_key_runs
+                = get_runs(thrust::raw_pointer_cast(d_keys.data()), sizes);
+
+            thrust::host_vector<size_t*> h_value_runs(sizes.size());
+            thrust::host_vector<size_t*> d_value_runs_staging(sizes.size());
+
+            size_t offset = 0;
+            for(size_t i = 0; i < sizes.size(); i++)
+            {
+                h_value_runs[i]         = thrust::raw_pointer_cast(h_values.data()) + offset;
+                d_value_runs_staging[i] = thrust::raw_pointer_cast(d_values.data()) + offset;
+                offset += sizes[i];
+            }
+
+            thrust::device_vector<size_t*> d_value_runs = d_value_runs_staging;
+
+            thrust::host_vector<T>        h_keys_result(size);
+            thrust::host_vector<size_t>   h_values_result(size);
+            thrust::device_vector<T>      d_keys_result(size);
+            thrust::device_vector<size_t> d_values_result(size);
+
+            auto h_end = thrust::multiway_merge_by_key(h_key_runs.begin(),
+                                                       h_key_runs.end(),
+                                                       h_value_runs.begin(),
+                                                       h_keys_result.begin(),
+                                                       h_values_result.begin());
+            auto d_end = thrust::multiway_merge_by_key(d_key_runs.begin(),
+                                                       d_key_runs.end(),
+                                                       d_value_runs.begin(),
+                                                       d_keys_result.begin(),
+                                                       d_values_result.begin());
+
+            ASSERT_EQ(static_cast<size_t>(h_end.first - h_keys_result.begin()), size);
+            ASSERT_EQ(static_cast<size_t>(h_end.second - h_values_result.begin()), size);
+            ASSERT_EQ(static_cast<size_t>(d_end.first - d_keys_result.begin()), size);
+            ASSERT_EQ(static_cast<size_t>(d_end.second - d_values_result.begin()), size);
+
+            // the merge is stable, so it matches a stable sort of the concatenated runs
+            thrust::host_vector<T>      h_keys_reference   = h_keys;
+            thrust::host_vector<size_t> h_values_reference = h_values;
+            thrust::stable_sort_by_key(
+                h_keys_reference.begin(), h_keys_reference.end(), h_values_reference.begin());
+
+            test_equality(h_keys_reference, h_keys_result);
+            test_equality(h_values_reference, h_values_result);
+            test_equality(h_keys_reference, d_keys_result);
+            test_equality(h_values_reference, d_values_result);
+        }
+    }
+}
@@ -0,0 +1,303 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/partial_sort.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(PartialSortTests, FullTestsParams);
+TESTS_DEFINE(PartialSortPrimitiveTests, NumericalTestsParams);
+
+template <typename Vector>
+void initialize_partial_sort_input(Vector& v)
+{
+    using T = typename Vector::value_type;
+
+    v.resize(7);
+    v[0] = T(5);
+    v[1] = T(2);
+    v[2] = T(9);
+    v[3] = T(1);
+    v[4] = T(7);
+    v[5] = T(3);
+    v[6] = T(8);
+}
+
+TYPED_TEST(PartialSortTests, TestNthElementSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v;
+    initialize_partial_sort_input(v);
+
+    thrust::nth_element(Policy{}, v.begin(), v.begin() + 3, v.end());
+
+    thrust::host_vector<T> h_v = v;
+    ASSERT_EQ(h_v[3], T(5));
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_LT(h_v[i], T(5));
+    }
+    for(int i = 4; i < 7; i++)
+    {
+        ASSERT_GT(h_v[i], T(5));
+    }
+}
+
+TYPED_TEST(PartialSortTests, TestPartialSortSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v;
+    initialize_partial_sort_input(v);
+
+    thrust::partial_sort(Policy{}, v.begin(), v.begin() + 3, v.end(), thrust::greater<T>());
+
+    ASSERT_EQ(v[0], T(9));
+    ASSERT_EQ(v[1], T(8));
+    ASSERT_EQ(v[2], T(7));
+}
+
+TYPED_TEST(PartialSortTests, TestPartialSortCopySimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v;
+    initialize_partial_sort_input(v);
+
+    Vector result(3);
+    auto end = thrust::partial_sort_copy(Policy{}, v.begin(), v.end(), result.begin(), result.end());
+
+    ASSERT_EQ(end - result.begin(), 3);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(2));
+    ASSERT_EQ(result[2], T(3));
+
+    // the input is left untouched
+    Vector expected;
+    initialize_partial_sort_input(expected);
+    ASSERT_EQ(v, expected);
+}
+
+TYPED_TEST(PartialSortTests, TestTopKSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v;
+    initialize_partial_sort_input(v);
+
+    Vector result(10);
+    auto end = thrust::top_k(Policy{}, v.begin(), v.end(), 3, result.begin());
+
+    ASSERT_EQ(end - result.begin(), 3);
+    ASSERT_EQ(result[0], T(9));
+    ASSERT_EQ(result[1], T(8));
+    ASSERT_EQ(result[2], T(7));
+
+    // k larger than the input selects all of it
+    end = thrust::top_k(Policy{}, v.begin(), v.end(), 10, result.begin(), thrust::less<T>());
+
+    ASSERT_EQ(end - result.begin(), 7);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[6], T(9));
+}
+
+TYPED_TEST(PartialSortTests, TestTopKByKeySimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys;
+    initialize_partial_sort_input(keys);
+
+    Vector values(7);
+    for(int i = 0; i < 7; i++)
+    {
+        values[i] = T(i);
+    }
+
+    Vector keys_result(2);
+    Vector values_result(2);
+    auto ends = thrust::top_k_by_key(
+        Policy{}, keys.begin(), keys.end(), values.begin(), 2, keys_result.begin(), values_result.begin());
+
+    ASSERT_EQ(ends.first - keys_result.begin(), 2);
+    ASSERT_EQ(ends.second - values_result.begin(), 2);
+    ASSERT_EQ(keys_result[0], T(9));
+    ASSERT_EQ(keys_result[1], T(8));
+    ASSERT_EQ(values_result[0], T(2));
+    ASSERT_EQ(values_result[1], T(6));
+}
+
+TYPED_TEST(PartialSortPrimitiveTests, TestNthElement)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        if(size == 0)
+        {
+            continue;
+        }
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::device_vector<T> d_data = h_data;
+
+            std::vector<T> expected(h_data.begin(), h_data.end());
+            std::sort(expected.begin(), expected.end());
+
+            for(size_t nth : {size_t(0), size / 3, size - 1})
+            {
+                SCOPED_TRACE(testing::Message() << "with nth= " << nth);
+
+                thrust::host_vector<T>   h_result = h_data;
+                thrust::device_vector<T> d_result = d_data;
+
+                thrust::nth_element(h_result.begin(), h_result.begin() + nth, h_result.end());
+                thrust::nth_element(d_result.begin(), d_result.begin() + nth, d_result.end());
+
+                thrust::host_vector<T> d_copy = d_result;
+                ASSERT_EQ(h_result[nth], expected[nth]);
+                ASSERT_EQ(d_copy[nth], expected[nth]);
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(i < nth ? !(h_result[nth] < h_result[i]) : !(h_result[i] < h_result[nth]), true);
+                    ASSERT_EQ(i < nth ? !(d_copy[nth] < d_copy[i]) : !(d_copy[i] < d_copy[nth]), true);
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(PartialSortPrimitiveTests, TestPartialSort)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::device_vector<T> d_data = h_data;
+
+            std::vector<T> expected(h_data.begin(), h_data.end());
+            std::sort(expected.begin(), expected.end());
+
+            const size_t middle = (std::min)(size, size_t(100));
+
+            thrust::partial_sort(h_data.begin(), h_data.begin() + middle, h_data.end());
+            thrust::partial_sort(d_data.begin(), d_data.begin() + middle, d_data.end());
+
+            thrust::host_vector<T> d_result = d_data;
+            for(size_t i = 0; i < middle; i++)
+            {
+                ASSERT_EQ(h_data[i], expected[i]);
+                ASSERT_EQ(d_result[i], expected[i]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(PartialSortPrimitiveTests, TestTopK)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::device_vector<T> d_data = h_data;
+
+            std::vector<T> expected(h_data.begin(), h_data.end());
+            std::sort(expected.begin(), expected.end(), std::greater<T>());
+
+            for(size_t k : {size_t(1), size_t(100), size / 2})
+            {
+                SCOPED_TRACE(testing::Message() << "with k= " << k);
+
+                const size_t r = (std::min)(k, size);
+
+                thrust::host_vector<T>   h_result(k);
+                thrust::device_vector<T> d_result(k);
+
+                auto h_end = thrust::top_k(h_data.begin(), h_data.end(), k, h_result.begin());
+                auto d_end = thrust::top_k(d_data.begin(), d_data.end(), k, d_result.begin());
+
+                ASSERT_EQ(static_cast<size_t>(h_end - h_result.begin()), r);
+                ASSERT_EQ(static_cast<size_t>(d_end - d_result.begin()), r);
+
+                thrust::host_vector<T> d_copy = d_result;
+                for(size_t i = 0; i < r; i++)
+                {
+                    ASSERT_EQ(h_result[i], expected[i]);
+                    ASSERT_EQ(d_copy[i], expected[i]);
+                }
+            }
+        }
+    }
+}
@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/partition.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/generic/partition.h>
 
 #include "test_header.hpp"
 
@@ -607,6 +608,69 @@ TYPED_TEST(PartitionIntegerTests, TestStablePartitionCopyStencil)
     }
 };
 
+TYPED_TEST(PartitionIntegerTests, TestStablePartitionCopyGenericTiles)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the generic implementation partitions the input in tiles; use tiny tiles
+    // so that both partitions are appended to across tile boundaries
+    const std::vector<std::ptrdiff_t> tile_sizes = {1, 2, 7, 64};
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<T> h_stencil = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed + seed_value_addition);
+
+            size_t n_true  = thrust::count_if(h_stencil.begin(), h_stencil.end(), is_even<T>());
+            size_t n_false = size - n_true;
+
+            thrust::host_vector<T> h_true_expected(n_true, 0);
+            thrust::host_vector<T> h_false_expected(n_false, 0);
+
+            thrust::stable_partition_copy(thrust::seq,
+                                          h_data.begin(),
+                                          h_data.end(),
+                                          h_stencil.begin(),
+                                          h_true_expected.begin(),
+                                          h_false_expected.begin(),
+                                          is_even<T>());
+
+            for(auto tile_size : tile_sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "with tile_size= " << tile_size);
+
+                thrust::host_vector<T> h_true_results(n_true, 0);
+                thrust::host_vector<T> h_false_results(n_false, 0);
+
+                auto policy = thrust::host;
+                auto h_ends = thrust::system::detail::generic::detail::stable_partition_copy_tiles(policy,
+                                                                                                  h_data.begin(),
+                                                                                                  h_data.end(),
+                                                                                                  h_stencil.begin(),
+                                                                                                  h_true_results.begin(),
+                                                                                                  h_false_results.begin(),
+                                                                                                  is_even<T>(),
+                                                                                                  tile_size);
+
+                ASSERT_EQ(h_ends.first - h_true_results.begin(), n_true);
+                ASSERT_EQ(h_ends.second - h_false_results.begin(), n_false);
+                ASSERT_EQ(h_true_results, h_true_expected);
+                ASSERT_EQ(h_false_results, h_false_expected);
+            }
+        }
+    }
+};
+
 TYPED_TEST(PartitionIntegerTests, TestPartitionCopyToDiscardIterator)
 {
     using T                         = typename TestFixture::input_type;
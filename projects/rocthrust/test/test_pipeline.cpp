@@ -0,0 +1,170 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/pipeline.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(PipelineTests, FullTestsParams);
+TESTS_DEFINE(PipelinePrimitiveTests, IntegerTestsParams);
+
+template <typename T>
+struct pipeline_square
+{
+    THRUST_HIP_FUNCTION
+    T operator()(T x) const
+    {
+        return x * x;
+    }
+};
+
+template <typename T>
+struct pipeline_is_odd
+{
+    THRUST_HIP_FUNCTION
+    bool operator()(T x) const
+    {
+        return (static_cast<long long>(x) % 2) != 0;
+    }
+};
+
+template <typename T>
+struct pipeline_is_small
+{
+    THRUST_HIP_FUNCTION
+    bool operator()(T x) const
+    {
+        return x < T(64);
+    }
+};
+
+TYPED_TEST(PipelineTests, TestPipelineSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v(6);
+    v[0] = 1;
+    v[1] = 2;
+    v[2] = 3;
+    v[3] = 4;
+    v[4] = 5;
+    v[5] = 6;
+
+    T sum = thrust::pipeline(Policy{}, v.begin(), v.end())
+          | thrust::filtered(pipeline_is_odd<T>())
+          | thrust::transformed(pipeline_square<T>())
+          | thrust::reduced(T(0));
+
+    ASSERT_EQ(sum, T(1 + 9 + 25));
+
+    T max = thrust::pipeline(Policy{}, v.begin(), v.end())
+          | thrust::transformed(pipeline_square<T>())
+          | thrust::filtered(pipeline_is_small<T>())
+          | thrust::reduced(T(0), thrust::maximum<T>());
+
+    ASSERT_EQ(max, T(36));
+
+    auto count = thrust::pipeline(v.begin(), v.end())
+               | thrust::transformed(pipeline_square<T>())
+               | thrust::filtered(pipeline_is_odd<T>())
+               | thrust::counted();
+
+    ASSERT_EQ(count, 3);
+
+    Vector result(6, T(0));
+
+    auto result_end = thrust::pipeline(Policy{}, v.begin(), v.end())
+                    | thrust::filtered(pipeline_is_odd<T>())
+                    | thrust::transformed(pipeline_square<T>())
+                    | thrust::copied(result.begin());
+
+    ASSERT_EQ(result_end - result.begin(), 3);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(9));
+    ASSERT_EQ(result[2], T(25));
+
+    // nothing reaches the reduction
+    T empty = thrust::pipeline(Policy{}, v.begin(), v.begin()) | thrust::reduced(T(13));
+
+    ASSERT_EQ(empty, T(13));
+}
+
+TYPED_TEST(PipelinePrimitiveTests, TestPipelineMatchesUnfused)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(size, T(0), T(100), seed);
+            thrust::device_vector<T> d_data = h_data;
+
+            // the same chain as separate algorithm calls with full size intermediates
+            thrust::host_vector<T> h_squares(size);
+            thrust::transform(h_data.begin(), h_data.end(), h_squares.begin(), pipeline_square<T>());
+
+            thrust::host_vector<T> h_odd(size);
+            h_odd.resize(thrust::copy_if(h_squares.begin(), h_squares.end(), h_odd.begin(), pipeline_is_odd<T>())
+                         - h_odd.begin());
+
+            T h_expected = thrust::reduce(h_odd.begin(), h_odd.end(), T(0));
+
+            T h_sum = thrust::pipeline(h_data.begin(), h_data.end())
+                    | thrust::transformed(pipeline_square<T>())
+                    | thrust::filtered(pipeline_is_odd<T>())
+                    | thrust::reduced(T(0));
+            T d_sum = thrust::pipeline(d_data.begin(), d_data.end())
+                    | thrust::transformed(pipeline_square<T>())
+                    | thrust::filtered(pipeline_is_odd<T>())
+                    | thrust::reduced(T(0));
+
+            ASSERT_EQ(h_sum, h_expected);
+            ASSERT_EQ(d_sum, h_expected);
+
+            auto d_count = thrust::pipeline(d_data.begin(), d_data.end())
+                         | thrust::transformed(pipeline_square<T>())
+                         | thrust::filtered(pipeline_is_odd<T>())
+                         | thrust::counted();
+
+            ASSERT_EQ(static_cast<size_t>(d_count), h_odd.size());
+
+            thrust::device_vector<T> d_result(size);
+            auto d_result_end = thrust::pipeline(d_data.begin(), d_data.end())
+                              | thrust::transformed(pipeline_square<T>())
+                              | thrust::filtered(pipeline_is_odd<T>())
+                              | thrust::copied(d_result.begin());
+            d_result.resize(d_result_end - d_result.begin());
+
+            ASSERT_EQ(d_result, h_odd);
+        }
+    }
+}
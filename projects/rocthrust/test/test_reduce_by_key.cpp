@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/generic/reduce_by_key.h>
 #include <thrust/unique.h>
 
 #include "test_header.hpp"
@@ -223,6 +224,76 @@ TYPED_TEST(ReduceByKeysIntegralTests, TestReduceByKey)
     }
 };
 
+TYPED_TEST(ReduceByKeysIntegralTests, TestReduceByKeyGenericTiles)
+{
+    using K = typename TestFixture::input_type; // key type
+    using V = unsigned int; // value type
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the generic implementation reduces the input in tiles; use tiny tiles
+    // so that segments straddle (and span several) tile boundaries
+    const std::vector<std::ptrdiff_t> tile_sizes = {1, 2, 7, 64};
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<K> h_keys = get_random_data<bool>(
+                size,
+                std::numeric_limits<bool>::min(),
+                std::numeric_limits<bool>::max(),
+                seed
+            );
+            thrust::host_vector<V> h_vals = get_random_data<V>(
+                size,
+                get_default_limits<V>::min(),
+                get_default_limits<V>::max(),
+                seed + seed_value_addition
+            );
+
+            thrust::host_vector<K> h_keys_expected(size);
+            thrust::host_vector<V> h_vals_expected(size);
+
+            auto expected_last = thrust::reduce_by_key(thrust::seq,
+                                                       h_keys.begin(),
+                                                       h_keys.end(),
+                                                       h_vals.begin(),
+                                                       h_keys_expected.begin(),
+                                                       h_vals_expected.begin());
+
+            for(auto tile_size : tile_sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "with tile_size= " << tile_size);
+
+                thrust::host_vector<K> h_keys_output(size);
+                thrust::host_vector<V> h_vals_output(size);
+
+                auto policy = thrust::host;
+                auto h_last = thrust::system::detail::generic::detail::reduce_by_key_tiles(policy,
+                                                                                           h_keys.begin(),
+                                                                                           h_keys.end(),
+                                                                                           h_vals.begin(),
+                                                                                           h_keys_output.begin(),
+                                                                                           h_vals_output.begin(),
+                                                                                           thrust::equal_to<K>(),
+                                                                                           thrust::plus<V>(),
+                                                                                           tile_size);
+
+                ASSERT_EQ(h_last.first - h_keys_output.begin(), expected_last.first - h_keys_expected.begin());
+                ASSERT_EQ(h_last.second - h_vals_output.begin(), expected_last.second - h_vals_expected.begin());
+
+                ASSERT_EQ(h_keys_output, h_keys_expected);
+                ASSERT_EQ(h_vals_output, h_vals_expected);
+            }
+        }
+    }
+}
+
 TYPED_TEST(ReduceByKeysIntegralTests, TestReduceByKeyToDiscardIterator)
 {
     using V = typename TestFixture::input_type; // value type
@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/remove.h>
+#include <thrust/system/detail/generic/remove.h>
 
 #include "test_header.hpp"
 
@@ -882,6 +883,85 @@ TYPED_TEST(RemoveVariableTests, TestRemoveCopyIfStencilToDiscardIterator)
     }
 }
 
+TYPED_TEST(RemoveVariableTests, TestRemoveIfGenericTiles)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the generic implementation compacts the range in place one tile at a
+    // time; use tiny tiles so that most tiles are written over the previous ones
+    const std::vector<std::ptrdiff_t> tile_sizes = {1, 2, 7, 64};
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            const thrust::host_vector<T> h_data = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            const thrust::host_vector<bool> h_stencil = get_random_data<bool>(
+                size,
+                std::numeric_limits<bool>::min(),
+                std::numeric_limits<bool>::max(),
+                seed + seed_value_addition
+            );
+
+            thrust::host_vector<T> h_expected = h_data;
+            h_expected.resize(thrust::remove_if(thrust::seq, h_expected.begin(), h_expected.end(), is_true<T>())
+                              - h_expected.begin());
+
+            thrust::host_vector<T> h_expected_stencil = h_data;
+            h_expected_stencil.resize(thrust::remove_if(thrust::seq,
+                                                        h_expected_stencil.begin(),
+                                                        h_expected_stencil.end(),
+                                                        h_stencil.begin(),
+                                                        is_true<bool>())
+                                      - h_expected_stencil.begin());
+
+            for(auto tile_size : tile_sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "with tile_size= " << tile_size);
+
+                auto policy = thrust::host;
+
+                thrust::host_vector<T> h_result = h_data;
+                h_result.resize(thrust::system::detail::generic::detail::remove_if_tiles(
+                                    policy, h_result.begin(), h_result.end(), is_true<T>(), tile_size)
+                                - h_result.begin());
+
+                ASSERT_EQ(h_result, h_expected);
+
+                h_result = h_data;
+                h_result.resize(thrust::system::detail::generic::detail::remove_if_tiles(policy,
+                                                                                         h_result.begin(),
+                                                                                         h_result.end(),
+                                                                                         h_stencil.begin(),
+                                                                                         is_true<bool>(),
+                                                                                         tile_size)
+                                - h_result.begin());
+
+                ASSERT_EQ(h_result, h_expected_stencil);
+
+                h_result = thrust::host_vector<T>(size);
+                h_result.resize(thrust::system::detail::generic::detail::remove_copy_if_tiles(policy,
+                                                                                              h_data.begin(),
+                                                                                              h_data.end(),
+                                                                                              h_stencil.begin(),
+                                                                                              h_result.begin(),
+                                                                                              is_true<bool>(),
+                                                                                              tile_size)
+                                - h_result.begin());
+
+                ASSERT_EQ(h_result, h_expected_stencil);
+            }
+        }
+    }
+}
+
 
 __global__
 THRUST_HIP_LAUNCH_BOUNDS_DEFAULT
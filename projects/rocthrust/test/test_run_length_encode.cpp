@@ -0,0 +1,225 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/run_length_encode.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(RunLengthEncodeTests, FullTestsParams);
+TESTS_DEFINE(RunLengthEncodePrimitiveTests, NumericalTestsParams);
+
+template <typename T>
+struct is_equal_div_2
+{
+    __host__ __device__ bool operator()(const T& x, const T& y) const
+    {
+        return ((int)x / 2) == ((int)y / 2);
+    }
+};
+
+TYPED_TEST(RunLengthEncodeTests, TestRunLengthEncodeSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector input(9);
+    input[0] = T(1);
+    input[1] = T(1);
+    input[2] = T(2);
+    input[3] = T(3);
+    input[4] = T(3);
+    input[5] = T(3);
+    input[6] = T(1);
+    input[7] = T(4);
+    input[8] = T(4);
+
+    Vector                     values(9);
+    thrust::device_vector<int> counts(9);
+
+    auto end = thrust::run_length_encode(Policy{}, input.begin(), input.end(), values.begin(), counts.begin());
+
+    ASSERT_EQ(end.first - values.begin(), 5);
+    ASSERT_EQ(end.second - counts.begin(), 5);
+
+    ASSERT_EQ(values[0], T(1));
+    ASSERT_EQ(values[1], T(2));
+    ASSERT_EQ(values[2], T(3));
+    ASSERT_EQ(values[3], T(1));
+    ASSERT_EQ(values[4], T(4));
+
+    ASSERT_EQ(counts[0], 2);
+    ASSERT_EQ(counts[1], 1);
+    ASSERT_EQ(counts[2], 3);
+    ASSERT_EQ(counts[3], 1);
+    ASSERT_EQ(counts[4], 2);
+
+    end = thrust::run_length_encode(
+        Policy{}, input.begin(), input.end(), values.begin(), counts.begin(), is_equal_div_2<T>());
+
+    // runs {1, 1}, {2, 3, 3, 3}, {1} and {4, 4}
+    ASSERT_EQ(end.first - values.begin(), 4);
+    ASSERT_EQ(values[0], T(1));
+    ASSERT_EQ(values[1], T(2));
+    ASSERT_EQ(values[2], T(1));
+    ASSERT_EQ(values[3], T(4));
+
+    ASSERT_EQ(counts[0], 2);
+    ASSERT_EQ(counts[1], 4);
+    ASSERT_EQ(counts[2], 1);
+    ASSERT_EQ(counts[3], 2);
+}
+
+TYPED_TEST(RunLengthEncodeTests, TestRunLengthDecodeSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(4);
+    values[0] = T(1);
+    values[1] = T(2);
+    values[2] = T(3);
+    values[3] = T(4);
+
+    // the run of 2 is empty
+    thrust::device_vector<int> counts(4);
+    counts[0] = 2;
+    counts[1] = 0;
+    counts[2] = 3;
+    counts[3] = 1;
+
+    Vector result(6);
+
+    auto end = thrust::run_length_decode(Policy{}, values.begin(), values.end(), counts.begin(), result.begin());
+
+    ASSERT_EQ(end - result.begin(), 6);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(1));
+    ASSERT_EQ(result[2], T(3));
+    ASSERT_EQ(result[3], T(3));
+    ASSERT_EQ(result[4], T(3));
+    ASSERT_EQ(result[5], T(4));
+
+    end = thrust::run_length_decode(Policy{}, values.begin(), values.begin(), counts.begin(), result.begin());
+
+    ASSERT_EQ(end - result.begin(), 0);
+}
+
+TYPED_TEST(RunLengthEncodePrimitiveTests, TestRunLengthEncode)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            // few distinct values, so that the input has runs of every length
+            thrust::host_vector<int> h_keys = get_random_data<int>(size, 0, 3, seed);
+
+            thrust::host_vector<T>   h_input(h_keys.begin(), h_keys.end());
+            thrust::device_vector<T> d_input = h_input;
+
+            thrust::host_vector<T>     h_values(size);
+            thrust::host_vector<int>   h_counts(size);
+            thrust::device_vector<T>   d_values(size);
+            thrust::device_vector<int> d_counts(size);
+
+            auto h_end = thrust::run_length_encode(
+                h_input.begin(), h_input.end(), h_values.begin(), h_counts.begin());
+            auto d_end = thrust::run_length_encode(
+                d_input.begin(), d_input.end(), d_values.begin(), d_counts.begin());
+
+            ASSERT_EQ(h_end.first - h_values.begin(), d_end.first - d_values.begin());
+            ASSERT_EQ(h_end.second - h_counts.begin(), d_end.second - d_counts.begin());
+
+            const size_t num_runs = h_end.first - h_values.begin();
+
+            h_values.resize(num_runs);
+            h_counts.resize(num_runs);
+            d_values.resize(num_runs);
+            d_counts.resize(num_runs);
+
+            test_equality(h_values, d_values);
+            test_equality(h_counts, d_counts);
+
+            // decoding the runs gives back the input
+            thrust::device_vector<T> d_result(size);
+
+            auto d_result_end = thrust::run_length_decode(
+                d_values.begin(), d_values.end(), d_counts.begin(), d_result.begin());
+
+            ASSERT_EQ(static_cast<size_t>(d_result_end - d_result.begin()), size);
+            test_equality(h_input, d_result);
+        }
+    }
+}
+
+TYPED_TEST(RunLengthEncodePrimitiveTests, TestRunLengthDecode)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_values = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_counts = get_random_data<int>(size, 0, 4, seed + 1);
+
+            thrust::device_vector<T>   d_values = h_values;
+            thrust::device_vector<int> d_counts = h_counts;
+
+            size_t total = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                total += h_counts[i];
+            }
+
+            thrust::host_vector<T>   h_result(total);
+            thrust::device_vector<T> d_result(total);
+
+            auto h_end = thrust::run_length_decode(
+                h_values.begin(), h_values.end(), h_counts.begin(), h_result.begin());
+            auto d_end = thrust::run_length_decode(
+                d_values.begin(), d_values.end(), d_counts.begin(), d_result.begin());
+
+            ASSERT_EQ(static_cast<size_t>(h_end - h_result.begin()), total);
+            ASSERT_EQ(static_cast<size_t>(d_end - d_result.begin()), total);
+
+            test_equality(h_result, d_result);
+        }
+    }
+}
@@ -0,0 +1,230 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/segmented_reduce.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SegmentedReduceTests, FullTestsParams);
+TESTS_DEFINE(SegmentedReducePrimitiveTests, NumericalTestsParams);
+
+// Offsets of segments covering [0, size), with a mix of empty, short and long segments
+thrust::host_vector<int> get_random_segment_offsets(size_t size, int seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> short_length(0, 40);
+
+    thrust::host_vector<int> offsets(1, 0);
+    while(static_cast<size_t>(offsets.back()) < size)
+    {
+        const int length = engine() % 64 == 0 ? 100000 : short_length(engine);
+        offsets.push_back(static_cast<int>((std::min)(size, static_cast<size_t>(offsets.back()) + length)));
+    }
+    return offsets;
+}
+
+TYPED_TEST(SegmentedReduceTests, TestSegmentedReduceSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(7);
+    values[0] = T(9);
+    values[1] = T(1);
+    values[2] = T(0);
+    values[3] = T(2);
+    values[4] = T(2);
+    values[5] = T(1);
+    values[6] = T(3);
+
+    // segments [1, 3), [3, 3) and [3, 7)
+    thrust::device_vector<int> offsets(4);
+    offsets[0] = 1;
+    offsets[1] = 3;
+    offsets[2] = 3;
+    offsets[3] = 7;
+
+    Vector result(3);
+
+    auto end = thrust::segmented_reduce(Policy{}, values.begin(), offsets.begin(), offsets.end(), result.begin());
+
+    ASSERT_EQ(end - result.begin(), 3);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(0));
+    ASSERT_EQ(result[2], T(8));
+
+    thrust::segmented_reduce(Policy{}, values.begin(), offsets.begin(), offsets.end(), result.begin(), T(1));
+
+    ASSERT_EQ(result[0], T(2));
+    ASSERT_EQ(result[1], T(1));
+    ASSERT_EQ(result[2], T(9));
+
+    thrust::segmented_reduce(
+        Policy{}, values.begin(), offsets.begin(), offsets.end(), result.begin(), T(0), thrust::maximum<T>());
+
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(0));
+    ASSERT_EQ(result[2], T(3));
+}
+
+TYPED_TEST(SegmentedReduceTests, TestSegmentedTransformReduceSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(6);
+    values[0] = T(1);
+    values[1] = T(0);
+    values[2] = T(2);
+    values[3] = T(2);
+    values[4] = T(1);
+    values[5] = T(3);
+
+    thrust::device_vector<int> offsets(3);
+    offsets[0] = 0;
+    offsets[1] = 2;
+    offsets[2] = 6;
+
+    Vector result(2);
+
+    auto end = thrust::segmented_transform_reduce(Policy{},
+                                                  values.begin(),
+                                                  offsets.begin(),
+                                                  offsets.end(),
+                                                  result.begin(),
+                                                  thrust::square<T>(),
+                                                  T(0),
+                                                  thrust::plus<T>());
+
+    ASSERT_EQ(end - result.begin(), 2);
+    ASSERT_EQ(result[0], T(1));
+    ASSERT_EQ(result[1], T(18));
+}
+
+TYPED_TEST(SegmentedReducePrimitiveTests, TestSegmentedReduce)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_values = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_offsets = get_random_segment_offsets(size, seed);
+
+            thrust::device_vector<T>   d_values  = h_values;
+            thrust::device_vector<int> d_offsets = h_offsets;
+
+            const size_t num_segments = h_offsets.size() - 1;
+
+            thrust::host_vector<T>   h_result(num_segments);
+            thrust::device_vector<T> d_result(num_segments);
+
+            const T init = T(13);
+
+            thrust::segmented_reduce(
+                h_values.begin(), h_offsets.begin(), h_offsets.end(), h_result.begin(), init);
+            thrust::segmented_reduce(
+                d_values.begin(), d_offsets.begin(), d_offsets.end(), d_result.begin(), init);
+
+            test_equality(h_result, d_result);
+        }
+    }
+}
+
+TYPED_TEST(SegmentedReducePrimitiveTests, TestSegmentedTransformReduce)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_values = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_offsets = get_random_segment_offsets(size, seed);
+
+            thrust::device_vector<T>   d_values  = h_values;
+            thrust::device_vector<int> d_offsets = h_offsets;
+
+            const size_t num_segments = h_offsets.size() - 1;
+
+            // the largest negated value of every segment, which is exact for every type
+            const T init = get_default_limits<T>::min();
+
+            std::vector<T> expected(num_segments, init);
+            for(size_t i = 0; i < num_segments; i++)
+            {
+                for(int j = h_offsets[i]; j < h_offsets[i + 1]; j++)
+                {
+                    expected[i] = (std::max)(expected[i], T(-h_values[j]));
+                }
+            }
+
+            thrust::host_vector<T>   h_result(num_segments);
+            thrust::device_vector<T> d_result(num_segments);
+
+            thrust::segmented_transform_reduce(h_values.begin(),
+                                               h_offsets.begin(),
+                                               h_offsets.end(),
+                                               h_result.begin(),
+                                               thrust::negate<T>(),
+                                               init,
+                                               thrust::maximum<T>());
+            thrust::segmented_transform_reduce(d_values.begin(),
+                                               d_offsets.begin(),
+                                               d_offsets.end(),
+                                               d_result.begin(),
+                                               thrust::negate<T>(),
+                                               init,
+                                               thrust::maximum<T>());
+
+            thrust::host_vector<T> d_copy = d_result;
+            for(size_t i = 0; i < num_segments; i++)
+            {
+                ASSERT_EQ(h_result[i], expected[i]);
+                ASSERT_EQ(d_copy[i], expected[i]);
+            }
+        }
+    }
+}
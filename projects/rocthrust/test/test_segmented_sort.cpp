@@ -0,0 +1,235 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/segmented_sort.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SegmentedSortTests, FullTestsParams);
+TESTS_DEFINE(SegmentedSortPrimitiveTests, NumericalTestsParams);
+
+// Offsets of segments covering [0, size), with a mix of empty, short and long segments
+thrust::host_vector<int> get_random_segment_offsets(size_t size, int seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> short_length(0, 40);
+
+    thrust::host_vector<int> offsets(1, 0);
+    while(static_cast<size_t>(offsets.back()) < size)
+    {
+        const int length = engine() % 64 == 0 ? 100000 : short_length(engine);
+        offsets.push_back(static_cast<int>((std::min)(size, static_cast<size_t>(offsets.back()) + length)));
+    }
+    return offsets;
+}
+
+TYPED_TEST(SegmentedSortTests, TestSegmentedSortSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(8);
+    keys[0] = T(3);
+    keys[1] = T(1);
+    keys[2] = T(2);
+    keys[3] = T(9);
+    keys[4] = T(7);
+    keys[5] = T(8);
+    keys[6] = T(5);
+    keys[7] = T(4);
+
+    // segments [1, 3), [3, 3) and [3, 7)
+    thrust::device_vector<int> offsets(4);
+    offsets[0] = 1;
+    offsets[1] = 3;
+    offsets[2] = 3;
+    offsets[3] = 7;
+
+    thrust::segmented_sort(Policy{}, keys.begin(), keys.end(), offsets.begin(), offsets.end());
+
+    ASSERT_EQ(keys[0], T(3));
+    ASSERT_EQ(keys[1], T(1));
+    ASSERT_EQ(keys[2], T(2));
+    ASSERT_EQ(keys[3], T(5));
+    ASSERT_EQ(keys[4], T(7));
+    ASSERT_EQ(keys[5], T(8));
+    ASSERT_EQ(keys[6], T(9));
+    ASSERT_EQ(keys[7], T(4));
+}
+
+TYPED_TEST(SegmentedSortTests, TestSegmentedSortByKeySimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(6);
+    keys[0] = T(3);
+    keys[1] = T(1);
+    keys[2] = T(2);
+    keys[3] = T(9);
+    keys[4] = T(4);
+    keys[5] = T(5);
+
+    Vector values(6);
+    values[0] = T(0);
+    values[1] = T(1);
+    values[2] = T(2);
+    values[3] = T(3);
+    values[4] = T(4);
+    values[5] = T(5);
+
+    thrust::device_vector<int> offsets(3);
+    offsets[0] = 0;
+    offsets[1] = 3;
+    offsets[2] = 6;
+
+    thrust::segmented_sort_by_key(Policy{},
+                                  keys.begin(),
+                                  keys.end(),
+                                  values.begin(),
+                                  offsets.begin(),
+                                  offsets.end(),
+                                  thrust::greater<T>());
+
+    ASSERT_EQ(keys[0], T(3));
+    ASSERT_EQ(keys[1], T(2));
+    ASSERT_EQ(keys[2], T(1));
+    ASSERT_EQ(keys[3], T(9));
+    ASSERT_EQ(keys[4], T(5));
+    ASSERT_EQ(keys[5], T(4));
+
+    ASSERT_EQ(values[0], T(0));
+    ASSERT_EQ(values[1], T(2));
+    ASSERT_EQ(values[2], T(1));
+    ASSERT_EQ(values[3], T(3));
+    ASSERT_EQ(values[4], T(5));
+    ASSERT_EQ(values[5], T(4));
+}
+
+TYPED_TEST(SegmentedSortPrimitiveTests, TestSegmentedSort)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_keys = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_offsets = get_random_segment_offsets(size, seed);
+
+            thrust::device_vector<T>   d_keys    = h_keys;
+            thrust::device_vector<int> d_offsets = h_offsets;
+
+            std::vector<T> expected(h_keys.begin(), h_keys.end());
+            for(size_t i = 0; i + 1 < h_offsets.size(); i++)
+            {
+                std::sort(expected.begin() + h_offsets[i], expected.begin() + h_offsets[i + 1]);
+            }
+
+            thrust::segmented_sort(h_keys.begin(), h_keys.end(), h_offsets.begin(), h_offsets.end());
+            thrust::segmented_sort(d_keys.begin(), d_keys.end(), d_offsets.begin(), d_offsets.end());
+
+            thrust::host_vector<T> d_result = d_keys;
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(h_keys[i], expected[i]);
+                ASSERT_EQ(d_result[i], expected[i]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SegmentedSortPrimitiveTests, TestSegmentedSortByKey)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_keys = get_random_data<T>(
+                size, get_default_limits<T>::min(), get_default_limits<T>::max(), seed);
+            thrust::host_vector<int> h_offsets = get_random_segment_offsets(size, seed);
+
+            thrust::host_vector<size_t> h_values(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                h_values[i] = i;
+            }
+
+            thrust::device_vector<T>      d_keys    = h_keys;
+            thrust::device_vector<size_t> d_values  = h_values;
+            thrust::device_vector<int>    d_offsets = h_offsets;
+
+            // stable reference, since the order of equal keys is unspecified
+            std::vector<std::pair<T, size_t>> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = std::make_pair(h_keys[i], i);
+            }
+            for(size_t i = 0; i + 1 < h_offsets.size(); i++)
+            {
+                std::sort(expected.begin() + h_offsets[i], expected.begin() + h_offsets[i + 1]);
+            }
+
+            const thrust::host_vector<T> original_keys = h_keys;
+
+            thrust::segmented_sort_by_key(
+                h_keys.begin(), h_keys.end(), h_values.begin(), h_offsets.begin(), h_offsets.end());
+            thrust::segmented_sort_by_key(
+                d_keys.begin(), d_keys.end(), d_values.begin(), d_offsets.begin(), d_offsets.end());
+
+            thrust::host_vector<T>      d_result_keys   = d_keys;
+            thrust::host_vector<size_t> d_result_values = d_values;
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(h_keys[i], expected[i].first);
+                ASSERT_EQ(d_result_keys[i], expected[i].first);
+
+                // every value still travels with its key
+                ASSERT_EQ(original_keys[h_values[i]], h_keys[i]);
+                ASSERT_EQ(original_keys[d_result_values[i]], d_result_keys[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,169 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort_strings.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_header.hpp"
+
+// Strings of up to max_length characters drawn from alphabet, all starting
+// with prefix, so that they share long prefixes and repeat.
+std::vector<std::string> get_random_strings(
+    size_t size, const std::string& prefix, const std::string& alphabet, size_t max_length, seed_type seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> length(0, max_length);
+    std::uniform_int_distribution<size_t> character(0, alphabet.size() - 1);
+
+    std::vector<std::string> strings(size, prefix);
+    for(auto& s : strings)
+    {
+        for(size_t n = length(engine); n > 0; n--)
+        {
+            s.push_back(alphabet[character(engine)]);
+        }
+    }
+    return strings;
+}
+
+// Checks sort_strings on the host and on the device against a stable sort of the strings
+void test_sort_strings(const std::vector<std::string>& strings)
+{
+    thrust::host_vector<char> h_chars;
+    thrust::host_vector<int>  h_offsets(1, 0);
+    for(const auto& s : strings)
+    {
+        h_chars.insert(h_chars.end(), s.begin(), s.end());
+        h_offsets.push_back(static_cast<int>(h_chars.size()));
+    }
+
+    thrust::device_vector<char> d_chars   = h_chars;
+    thrust::device_vector<int>  d_offsets = h_offsets;
+
+    thrust::host_vector<int>   h_permutation(strings.size());
+    thrust::device_vector<int> d_permutation(strings.size());
+
+    auto h_end = thrust::sort_strings(
+        h_chars.begin(), h_offsets.begin(), h_offsets.end(), h_permutation.begin());
+    auto d_end = thrust::sort_strings(
+        d_chars.begin(), d_offsets.begin(), d_offsets.end(), d_permutation.begin());
+
+    ASSERT_EQ(static_cast<size_t>(h_end - h_permutation.begin()), strings.size());
+    ASSERT_EQ(static_cast<size_t>(d_end - d_permutation.begin()), strings.size());
+
+    // std::string compares its characters as unsigned char
+    thrust::host_vector<int> reference(strings.size());
+    std::iota(reference.begin(), reference.end(), 0);
+    std::stable_sort(reference.begin(),
+                     reference.end(),
+                     [&](int a, int b) { return strings[a] < strings[b]; });
+
+    test_equality(reference, h_permutation);
+    test_equality(reference, d_permutation);
+}
+
+TEST(SortStringsTests, TestSortStringsSimple)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::string chars = "pearapplepeachapple";
+
+    thrust::device_vector<char> d_chars(chars.begin(), chars.end());
+    thrust::device_vector<int>  d_offsets(5);
+    d_offsets[0] = 0;
+    d_offsets[1] = 4;
+    d_offsets[2] = 9;
+    d_offsets[3] = 14;
+    d_offsets[4] = 19;
+
+    thrust::device_vector<int> d_permutation(4);
+
+    auto end = thrust::sort_strings(
+        d_chars.begin(), d_offsets.begin(), d_offsets.end(), d_permutation.begin());
+
+    ASSERT_EQ(end - d_permutation.begin(), 4);
+
+    // the equal strings keep the order of their indices
+    ASSERT_EQ(d_permutation[0], 1);
+    ASSERT_EQ(d_permutation[1], 3);
+    ASSERT_EQ(d_permutation[2], 2);
+    ASSERT_EQ(d_permutation[3], 0);
+
+    end = thrust::sort_strings(
+        d_chars.begin(), d_offsets.begin(), d_offsets.begin() + 1, d_permutation.begin());
+
+    ASSERT_EQ(end - d_permutation.begin(), 0);
+}
+
+TEST(SortStringsTests, TestSortStringsPrefixes)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // a string sorts before the longer strings it's a prefix of, '\0' included
+    std::vector<std::string> strings = {std::string("ab\0", 3),
+                                        "abcdefgh",
+                                        "",
+                                        "abcdefg",
+                                        "ab",
+                                        std::string("ab\0\0", 4),
+                                        "\xff",
+                                        "abcdefgh",
+                                        "a"};
+
+    test_sort_strings(strings);
+}
+
+TEST(SortStringsTests, TestSortStrings)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            test_sort_strings(get_random_strings(size, "", std::string("ab\0c\xff", 5), 24, seed));
+        }
+    }
+}
+
+TEST(SortStringsTests, TestSortStringsCommonPrefix)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            test_sort_strings(get_random_strings(size, "https://www.example.com/", "abc/", 40, seed));
+        }
+    }
+}
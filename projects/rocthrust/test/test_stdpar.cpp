@@ -0,0 +1,239 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/partial_sort.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/stdpar/execution_policy.h>
+#include <thrust/transform_scan.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "test_header.hpp"
+
+// Sizes large enough for the standard library to split the work between
+// threads, and a few small ones
+static const std::size_t stdpar_sizes[] = { 0, 1, 7, 1000, 1 << 16, (1 << 20) + 3 };
+
+static std::vector<int> random_ints(std::size_t n, int max_value, unsigned int seed)
+{
+    std::default_random_engine         engine(seed);
+    std::uniform_int_distribution<int> distribution(0, max_value);
+
+    std::vector<int> ret(n);
+    for (int& x : ret)
+    {
+        x = distribution(engine);
+    }
+    return ret;
+}
+
+struct stdpar_square
+{
+    long long operator()(int x) const
+    {
+        return static_cast<long long>(x) * x;
+    }
+};
+
+TEST(StdparTests, TestReduce)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        const std::vector<int> h = random_ints(n, 1000, 1);
+        thrust::host_vector<int> d(h.begin(), h.end());
+
+        ASSERT_EQ(thrust::reduce(thrust::stdpar::par, d.begin(), d.end(), 0LL),
+                  std::accumulate(h.begin(), h.end(), 0LL));
+        ASSERT_EQ(thrust::reduce(thrust::stdpar::par, d.begin(), d.end(), -1, thrust::maximum<int>()),
+                  h.empty() ? -1 : *std::max_element(h.begin(), h.end()));
+
+        // iterators without storage
+        ASSERT_EQ(thrust::reduce(thrust::stdpar::par,
+                                 thrust::counting_iterator<long long>(0),
+                                 thrust::counting_iterator<long long>(n)),
+                  static_cast<long long>(n) * (static_cast<long long>(n) - 1) / 2);
+    }
+}
+
+TEST(StdparTests, TestScan)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        const std::vector<int> h = random_ints(n, 1000, 2);
+
+        std::vector<long long> inclusive(n);
+        std::vector<long long> exclusive(n);
+        long long sum = 10;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            exclusive[i] = sum;
+            sum += h[i];
+            inclusive[i] = sum - 10;
+        }
+
+        const thrust::host_vector<long long> input(h.begin(), h.end());
+        thrust::host_vector<long long> output(n);
+
+        thrust::inclusive_scan(thrust::stdpar::par, input.begin(), input.end(), output.begin());
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), inclusive);
+
+        thrust::exclusive_scan(thrust::stdpar::par, input.begin(), input.end(), output.begin(), 10LL);
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), exclusive);
+
+        // in place
+        output = input;
+        thrust::inclusive_scan(thrust::stdpar::par, output.begin(), output.end(), output.begin());
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), inclusive);
+
+        output = input;
+        thrust::exclusive_scan(thrust::stdpar::par, output.begin(), output.end(), output.begin(), 10LL);
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), exclusive);
+    }
+}
+
+TEST(StdparTests, TestTransformScan)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        const std::vector<int> h = random_ints(n, 1000, 3);
+
+        std::vector<long long> inclusive(n);
+        std::vector<long long> exclusive(n);
+        long long sum = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            exclusive[i] = sum;
+            sum += stdpar_square()(h[i]);
+            inclusive[i] = sum;
+        }
+
+        thrust::host_vector<long long> output(h.begin(), h.end());
+        thrust::transform_inclusive_scan(
+            thrust::stdpar::par, output.begin(), output.end(), output.begin(), stdpar_square(), thrust::plus<long long>());
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), inclusive);
+
+        output = thrust::host_vector<long long>(h.begin(), h.end());
+        thrust::transform_exclusive_scan(
+            thrust::stdpar::par, output.begin(), output.end(), output.begin(), stdpar_square(), 0LL, thrust::plus<long long>());
+        ASSERT_EQ(std::vector<long long>(output.begin(), output.end()), exclusive);
+    }
+}
+
+TEST(StdparTests, TestSort)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        std::vector<int> h = random_ints(n, 1 << 30, 4);
+        thrust::host_vector<int> d(h.begin(), h.end());
+
+        thrust::sort(thrust::stdpar::par, d.begin(), d.end());
+        std::sort(h.begin(), h.end());
+        ASSERT_EQ(std::vector<int>(d.begin(), d.end()), h);
+
+        thrust::sort(thrust::stdpar::par, d.begin(), d.end(), thrust::greater<int>());
+        std::reverse(h.begin(), h.end());
+        ASSERT_EQ(std::vector<int>(d.begin(), d.end()), h);
+    }
+}
+
+TEST(StdparTests, TestStableSortByKey)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        // few distinct keys, so that the order of equal keys is checked
+        const std::vector<int> keys = random_ints(n, 15, 5);
+
+        std::vector<std::size_t> order(n);
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return keys[a] < keys[b];
+        });
+
+        thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+        thrust::host_vector<std::size_t> d_values(n);
+        thrust::sequence(d_values.begin(), d_values.end());
+
+        thrust::stable_sort_by_key(thrust::stdpar::par, d_keys.begin(), d_keys.end(), d_values.begin());
+
+        ASSERT_EQ(std::vector<std::size_t>(d_values.begin(), d_values.end()), order);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(d_keys[i], keys[order[i]]);
+        }
+    }
+}
+
+TEST(StdparTests, TestPartialSort)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (std::size_t n : stdpar_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << n);
+
+        const std::vector<int> h = random_ints(n, 1 << 30, 6);
+
+        std::vector<int> sorted(h);
+        std::sort(sorted.begin(), sorted.end());
+
+        for (std::size_t middle : { n / 3, n })
+        {
+            SCOPED_TRACE(testing::Message() << "with middle= " << middle);
+
+            thrust::host_vector<int> d(h.begin(), h.end());
+            thrust::partial_sort(thrust::stdpar::par, d.begin(), d.begin() + middle, d.end());
+            ASSERT_TRUE(std::equal(d.begin(), d.begin() + middle, sorted.begin()));
+
+            d = thrust::host_vector<int>(h.begin(), h.end());
+            thrust::nth_element(thrust::stdpar::par, d.begin(), d.begin() + middle, d.end());
+            if (middle < n)
+            {
+                ASSERT_EQ(d[middle], sorted[middle]);
+            }
+        }
+    }
+}
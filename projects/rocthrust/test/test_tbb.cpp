@@ -0,0 +1,812 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/batch_copy.h>
+#include <thrust/functional.h>
+#include <thrust/hash_reduce_by_key.h>
+#include <thrust/histogram.h>
+#include <thrust/host_vector.h>
+#include <thrust/merge_join.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
+#include <thrust/partial_sort.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/sort_strings.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_header.hpp"
+
+// A comparator which can only be called through a non-const object
+struct non_const_less
+{
+    bool operator()(int a, int b)
+    {
+        return a < b;
+    }
+};
+
+// keys with few distinct values, so that the order of equal keys is checked
+static std::vector<int> few_distinct_keys(std::size_t n)
+{
+    std::vector<int> keys(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        keys[i] = static_cast<int>((i * 7919) % 1000);
+    }
+    return keys;
+}
+
+TEST(TbbTests, TestStableSortNonConstComparator)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t      n    = 1 << 20;
+    const std::vector<int> keys = few_distinct_keys(n);
+
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return keys[a] < keys[b]; });
+
+    thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+    thrust::stable_sort(thrust::tbb::par, d_keys.begin(), d_keys.end(), non_const_less());
+    ASSERT_TRUE(thrust::is_sorted(d_keys.begin(), d_keys.end()));
+
+    d_keys = thrust::host_vector<int>(keys.begin(), keys.end());
+    thrust::host_vector<int> d_values(n);
+    thrust::sequence(d_values.begin(), d_values.end());
+    thrust::stable_sort_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(), non_const_less());
+    ASSERT_EQ(std::vector<int>(d_values.begin(), d_values.end()), order);
+}
+
+TEST(TbbTests, TestMultiwayMergeNonConstComparator)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t num_runs = 8;
+
+    // runs of different sizes, one of them empty
+    std::vector<int>         input;
+    std::vector<std::size_t> offsets(1, 0);
+    for (std::size_t i = 0; i < num_runs; i++)
+    {
+        const std::vector<int> run_keys = few_distinct_keys(i * (1 << 16) + 100 * i);
+        input.insert(input.end(), run_keys.begin(), run_keys.end());
+        std::sort(input.begin() + offsets.back(), input.end());
+        offsets.push_back(input.size());
+    }
+
+    thrust::host_vector<thrust::pair<const int*, const int*>> runs(num_runs);
+    for (std::size_t i = 0; i < num_runs; i++)
+    {
+        runs[i] = thrust::make_pair(input.data() + offsets[i], input.data() + offsets[i + 1]);
+    }
+
+    thrust::host_vector<int> result(input.size());
+    thrust::host_vector<int>::iterator end
+        = thrust::multiway_merge(thrust::tbb::par, runs.begin(), runs.end(), result.begin(), non_const_less());
+    ASSERT_EQ(static_cast<std::size_t>(end - result.begin()), input.size());
+
+    std::sort(input.begin(), input.end());
+    ASSERT_EQ(std::vector<int>(result.begin(), result.end()), input);
+}
+
+TEST(TbbTests, TestTopKByKey)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t      n    = 1 << 20;
+    const std::size_t      k    = 5000;
+    const std::vector<int> keys = few_distinct_keys(n);
+
+    const thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+    thrust::host_vector<int>       d_values(n);
+    thrust::sequence(d_values.begin(), d_values.end());
+
+    thrust::host_vector<int> keys_result(k);
+    thrust::host_vector<int> values_result(k);
+
+    // the greatest keys with the default comparator, and the first ones in the
+    // order of a comparator which can only be called through a non-const object
+    for (bool nc : { false, true })
+    {
+        SCOPED_TRACE(testing::Message() << "with non-const comparator= " << nc);
+
+        std::vector<int> expected(keys);
+        if (nc)
+        {
+            std::sort(expected.begin(), expected.end());
+        }
+        else
+        {
+            std::sort(expected.begin(), expected.end(), std::greater<int>());
+        }
+        expected.resize(k);
+
+        if (nc)
+        {
+            thrust::top_k_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(), k,
+                                 keys_result.begin(), values_result.begin(), non_const_less());
+        }
+        else
+        {
+            thrust::top_k_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(), k,
+                                 keys_result.begin(), values_result.begin());
+        }
+
+        ASSERT_EQ(std::vector<int>(keys_result.begin(), keys_result.end()), expected);
+        for (std::size_t i = 0; i < k; i++)
+        {
+            ASSERT_EQ(keys[values_result[i]], keys_result[i]);
+        }
+    }
+}
+
+// the sizes and selected ranks of the selection tests; the large inputs are
+// narrowed by sample select partitions before the rest is sorted
+static std::vector<std::pair<std::size_t, std::size_t>> selection_cases()
+{
+    return { {17, 16}, {1000, 0}, {1000, 333}, {1000, 999}, {1000, 1000},
+             {300000, 100000}, {300000, 299999}, {300000, 300000} };
+}
+
+static std::vector<int> random_keys(std::size_t n, int max_value, unsigned int seed)
+{
+    std::default_random_engine         engine(seed);
+    std::uniform_int_distribution<int> distribution(0, max_value);
+
+    std::vector<int> keys(n);
+    for (int& x : keys)
+    {
+        x = distribution(engine);
+    }
+    return keys;
+}
+
+TEST(TbbTests, TestNthElement)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (const auto& c : selection_cases())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << c.first << " and nth= " << c.second);
+
+        // many distinct keys, and many duplicates
+        for (int max_value : { 1 << 30, 10 })
+        {
+            SCOPED_TRACE(testing::Message() << "with max_value= " << max_value);
+
+            std::vector<int> keys = random_keys(c.first, max_value, static_cast<unsigned int>(c.first + c.second));
+
+            std::vector<int> sorted(keys);
+            std::sort(sorted.begin(), sorted.end());
+
+            thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+            thrust::nth_element(thrust::tbb::par, d_keys.begin(), d_keys.begin() + c.second, d_keys.end());
+
+            std::vector<int> result(d_keys.begin(), d_keys.end());
+            if (c.second < c.first)
+            {
+                ASSERT_EQ(result[c.second], sorted[c.second]);
+                for (std::size_t i = 0; i < c.first; i++)
+                {
+                    ASSERT_TRUE(i < c.second ? result[i] <= sorted[c.second] : result[i] >= sorted[c.second]);
+                }
+            }
+
+            // and it is still a permutation
+            std::sort(result.begin(), result.end());
+            ASSERT_EQ(result, sorted);
+        }
+    }
+
+    // an input which is left unsorted when the sequential selection sorts in parallel
+    const std::vector<int> keys = { 411, 814, 767, 885, 6, 70, 792, 233, 88, 404, 879, 750, 211, 312, 318, 288, 423 };
+
+    thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+    thrust::nth_element(thrust::tbb::par, d_keys.begin(), d_keys.begin() + 8, d_keys.end(), thrust::greater<int>());
+
+    std::vector<int> sorted(keys);
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    ASSERT_EQ(d_keys[8], sorted[8]);
+}
+
+TEST(TbbTests, TestPartialSort)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for (const auto& c : selection_cases())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << c.first << " and middle= " << c.second);
+
+        for (int max_value : { 1 << 30, 10 })
+        {
+            SCOPED_TRACE(testing::Message() << "with max_value= " << max_value);
+
+            std::vector<int> keys = random_keys(c.first, max_value, static_cast<unsigned int>(c.first * 3 + c.second));
+
+            std::vector<int> sorted(keys);
+            std::sort(sorted.begin(), sorted.end());
+
+            thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+            thrust::partial_sort(thrust::tbb::par, d_keys.begin(), d_keys.begin() + c.second, d_keys.end());
+
+            std::vector<int> result(d_keys.begin(), d_keys.end());
+            ASSERT_TRUE(std::equal(result.begin(), result.begin() + c.second, sorted.begin()));
+
+            std::sort(result.begin(), result.end());
+            ASSERT_EQ(result, sorted);
+
+            // with a comparator, into a copy
+            std::vector<int> expected(sorted.rbegin(), sorted.rbegin() + c.second);
+
+            thrust::host_vector<int> d_result(c.second);
+            d_keys = thrust::host_vector<int>(keys.begin(), keys.end());
+            thrust::partial_sort_copy(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_result.begin(), d_result.end(), thrust::greater<int>());
+            ASSERT_EQ(std::vector<int>(d_result.begin(), d_result.end()), expected);
+        }
+    }
+
+    const std::vector<int> keys = { 411, 814, 767, 885, 6, 70, 792, 233, 88, 404, 879, 750, 211, 312, 318, 288, 423 };
+
+    thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+    thrust::partial_sort(thrust::tbb::par, d_keys.begin(), d_keys.begin() + 16, d_keys.end());
+
+    std::vector<int> sorted(keys);
+    std::sort(sorted.begin(), sorted.end());
+    ASSERT_TRUE(std::equal(d_keys.begin(), d_keys.begin() + 16, sorted.begin()));
+}
+
+// Few bins are counted in private histograms per thread, and many bins in a
+// shared one
+TEST(TbbTests, TestHistogram)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t n = 1 << 20;
+
+    // some of the samples are below the lowest and above the highest level
+    std::vector<int> samples = random_keys(n, (1 << 20) + 200, 31);
+    for (int& x : samples)
+    {
+        x -= 100;
+    }
+    const thrust::host_vector<int> d_samples(samples.begin(), samples.end());
+
+    for (int num_bins : { 100, 1 << 17 })
+    {
+        SCOPED_TRACE(testing::Message() << "with num_bins= " << num_bins);
+
+        // bins of the same width
+        std::vector<unsigned int> expected(num_bins, 0);
+        for (int x : samples)
+        {
+            if (x >= 0 && x < (1 << 20))
+            {
+                expected[static_cast<long long>(x) * num_bins >> 20]++;
+            }
+        }
+
+        thrust::host_vector<unsigned int> d_counts(num_bins);
+        auto end = thrust::histogram_even(thrust::tbb::par, d_samples.begin(), d_samples.end(), d_counts.begin(),
+                                          num_bins + 1, 0, 1 << 20);
+        ASSERT_EQ(end - d_counts.begin(), num_bins);
+        ASSERT_EQ(std::vector<unsigned int>(d_counts.begin(), d_counts.end()), expected);
+
+        // and bins between custom levels
+        std::vector<int> levels = random_keys(num_bins + 1, 1 << 20, 32);
+        std::sort(levels.begin(), levels.end());
+
+        std::fill(expected.begin(), expected.end(), 0u);
+        for (int x : samples)
+        {
+            if (x >= levels.front() && x < levels.back())
+            {
+                expected[std::upper_bound(levels.begin(), levels.end(), x) - levels.begin() - 1]++;
+            }
+        }
+
+        const thrust::host_vector<int> d_levels(levels.begin(), levels.end());
+        end = thrust::histogram_range(thrust::tbb::par, d_samples.begin(), d_samples.end(), d_counts.begin(),
+                                      d_levels.begin(), d_levels.end());
+        ASSERT_EQ(end - d_counts.begin(), num_bins);
+        ASSERT_EQ(std::vector<unsigned int>(d_counts.begin(), d_counts.end()), expected);
+    }
+}
+
+// Large segments are sorted in parallel one after the other, and the runs of
+// short segments between them are sorted sequentially in parallel
+TEST(TbbTests, TestSegmentedSort)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // empty, short and large segments, and keys before and after all of them
+    std::vector<int> offsets = { 5, 5, 6 };
+    for (std::size_t i = 0; i < 3000; i++)
+    {
+        offsets.push_back(offsets.back() + static_cast<int>((i * 7919) % 97));
+        if (i % 1000 == 500)
+        {
+            offsets.push_back(offsets.back() + (1 << 17) + static_cast<int>(i));
+        }
+    }
+    const std::size_t n = offsets.back() + 5;
+
+    const std::vector<int> keys = random_keys(n, 1000, 32);
+
+    std::vector<int> expected(keys);
+    for (std::size_t i = 0; i + 1 < offsets.size(); i++)
+    {
+        std::sort(expected.begin() + offsets[i], expected.begin() + offsets[i + 1]);
+    }
+
+    const thrust::host_vector<int> d_offsets(offsets.begin(), offsets.end());
+
+    thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+    thrust::segmented_sort(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_offsets.begin(), d_offsets.end());
+    ASSERT_EQ(std::vector<int>(d_keys.begin(), d_keys.end()), expected);
+
+    // in descending order, with every value still next to its key
+    for (std::size_t i = 0; i + 1 < offsets.size(); i++)
+    {
+        std::reverse(expected.begin() + offsets[i], expected.begin() + offsets[i + 1]);
+    }
+
+    d_keys = thrust::host_vector<int>(keys.begin(), keys.end());
+    thrust::host_vector<int> d_values(n);
+    thrust::transform(d_keys.begin(), d_keys.end(), d_values.begin(), thrust::negate<int>());
+    thrust::segmented_sort_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(),
+                                  d_offsets.begin(), d_offsets.end(), thrust::greater<int>());
+    ASSERT_EQ(std::vector<int>(d_keys.begin(), d_keys.end()), expected);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(d_values[i], -d_keys[i]);
+    }
+}
+
+// An associative function which is not commutative
+struct take_last
+{
+    int operator()(int, int b) const
+    {
+        return b;
+    }
+};
+
+// The values and segment ends are split evenly over the threads, so long
+// segments are reduced by several threads and short ones are batched
+TEST(TbbTests, TestSegmentedReduce)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    std::vector<int> offsets = { 3, 3 };
+    for (std::size_t i = 0; i < 20000; i++)
+    {
+        offsets.push_back(offsets.back() + static_cast<int>((i * 7919) % 13));
+        if (i % 5000 == 2500)
+        {
+            offsets.push_back(offsets.back() + (1 << 18) + static_cast<int>(i));
+        }
+    }
+    const std::size_t num_segments = offsets.size() - 1;
+
+    const std::vector<int> values = random_keys(offsets.back(), 1000, 34);
+
+    const thrust::host_vector<int> d_values(values.begin(), values.end());
+    const thrust::host_vector<int> d_offsets(offsets.begin(), offsets.end());
+
+    thrust::host_vector<long long> d_sums(num_segments);
+    auto end = thrust::segmented_reduce(thrust::tbb::par, d_values.begin(), d_offsets.begin(), d_offsets.end(),
+                                        d_sums.begin(), 7ll, thrust::plus<long long>());
+    ASSERT_EQ(end - d_sums.begin(), static_cast<std::ptrdiff_t>(num_segments));
+
+    thrust::host_vector<int> d_last(num_segments);
+    thrust::segmented_reduce(thrust::tbb::par, d_values.begin(), d_offsets.begin(), d_offsets.end(),
+                             d_last.begin(), -1, take_last());
+
+    thrust::host_vector<long long> d_squares(num_segments);
+    thrust::segmented_transform_reduce(thrust::tbb::par, d_values.begin(), d_offsets.begin(), d_offsets.end(),
+                                       d_squares.begin(), thrust::square<long long>(), 0ll,
+                                       thrust::plus<long long>());
+
+    for (std::size_t i = 0; i < num_segments; i++)
+    {
+        long long sum    = 7;
+        long long square = 0;
+        for (int j = offsets[i]; j < offsets[i + 1]; j++)
+        {
+            sum += values[j];
+            square += static_cast<long long>(values[j]) * values[j];
+        }
+
+        ASSERT_EQ(d_sums[i], sum) << "for segment " << i;
+        ASSERT_EQ(d_last[i], offsets[i] < offsets[i + 1] ? values[offsets[i + 1] - 1] : -1) << "for segment " << i;
+        ASSERT_EQ(d_squares[i], square) << "for segment " << i;
+    }
+}
+
+// The elements of all of the buffers are split evenly over the threads, so a
+// buffer may be copied by several threads and a thread may copy many buffers
+TEST(TbbTests, TestBatchCopy)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t num_buffers = 5000;
+
+    std::vector<std::size_t> sizes(num_buffers);
+    for (std::size_t i = 0; i < num_buffers; i++)
+    {
+        sizes[i] = (i * 7919) % 200;
+    }
+    sizes[num_buffers / 2] = 1 << 20;
+
+    const std::size_t n = std::accumulate(sizes.begin(), sizes.end(), std::size_t(0));
+
+    const std::vector<int>   values = random_keys(n, 1 << 30, 35);
+    thrust::host_vector<int> src(values.begin(), values.end());
+    thrust::host_vector<int> dst(n, -1);
+
+    // the buffers are gathered from the source and packed in reverse order
+    std::vector<const int*> src_ptrs(num_buffers);
+    std::vector<int*>       dst_ptrs(num_buffers);
+    std::vector<int>        expected(n);
+    for (std::size_t i = 0, src_offset = 0, dst_offset = n; i < num_buffers; i++)
+    {
+        dst_offset -= sizes[i];
+        src_ptrs[i] = thrust::raw_pointer_cast(src.data()) + src_offset;
+        dst_ptrs[i] = thrust::raw_pointer_cast(dst.data()) + dst_offset;
+        std::copy(values.begin() + src_offset, values.begin() + src_offset + sizes[i], expected.begin() + dst_offset);
+        src_offset += sizes[i];
+    }
+
+    thrust::batch_copy(thrust::tbb::par, src_ptrs.begin(), dst_ptrs.begin(), sizes.begin(), num_buffers);
+    ASSERT_EQ(std::vector<int>(dst.begin(), dst.end()), expected);
+}
+
+// An equivalence relation which is coarser than equality
+struct same_tens
+{
+    bool operator()(int a, int b) const
+    {
+        return a / 10 == b / 10;
+    }
+};
+
+// The input is split into chunks for the threads, and the runs which cross
+// the chunk boundaries are joined
+TEST(TbbTests, TestRunLengthEncode)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // short runs, and a long one which spans several chunks
+    const std::vector<int> lengths = random_keys(100000, 20, 36);
+    const std::vector<int> digits  = random_keys(lengths.size(), 40, 37);
+
+    std::vector<int> input;
+    for (std::size_t i = 0; i < lengths.size(); i++)
+    {
+        input.insert(input.end(), i == lengths.size() / 2 ? 100000 : lengths[i] + 1, digits[i]);
+    }
+    const thrust::host_vector<int> d_input(input.begin(), input.end());
+
+    for (bool pred : { false, true })
+    {
+        SCOPED_TRACE(testing::Message() << "with binary_pred= " << pred);
+
+        std::vector<int> expected_values;
+        std::vector<int> expected_counts;
+        for (std::size_t i = 0; i < input.size(); i++)
+        {
+            if (i == 0 || (pred ? !same_tens()(input[i - 1], input[i]) : input[i - 1] != input[i]))
+            {
+                expected_values.push_back(input[i]);
+                expected_counts.push_back(0);
+            }
+            expected_counts.back()++;
+        }
+
+        thrust::host_vector<int> d_values(input.size());
+        thrust::host_vector<int> d_counts(input.size());
+
+        thrust::pair<thrust::host_vector<int>::iterator, thrust::host_vector<int>::iterator> ends;
+        if (pred)
+        {
+            ends = thrust::run_length_encode(thrust::tbb::par, d_input.begin(), d_input.end(),
+                                             d_values.begin(), d_counts.begin(), same_tens());
+        }
+        else
+        {
+            ends = thrust::run_length_encode(thrust::tbb::par, d_input.begin(), d_input.end(),
+                                             d_values.begin(), d_counts.begin());
+        }
+
+        ASSERT_EQ(std::vector<int>(d_values.begin(), ends.first), expected_values);
+        ASSERT_EQ(std::vector<int>(d_counts.begin(), ends.second), expected_counts);
+
+        // and the runs are expanded again
+        thrust::host_vector<int> d_decoded(input.size());
+        auto end = thrust::run_length_decode(thrust::tbb::par, d_values.begin(), ends.first, d_counts.begin(), d_decoded.begin());
+        ASSERT_EQ(end, d_decoded.end());
+
+        std::vector<int> expected_decoded;
+        for (std::size_t i = 0; i < expected_values.size(); i++)
+        {
+            expected_decoded.insert(expected_decoded.end(), expected_counts[i], expected_values[i]);
+        }
+        ASSERT_EQ(std::vector<int>(d_decoded.begin(), d_decoded.end()), expected_decoded);
+    }
+}
+
+// The strings are sorted by their first characters in parallel, and then the
+// groups of strings sharing those characters are sorted concurrently
+TEST(TbbTests, TestSortStrings)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t n = 100000;
+
+    // a large group with a long common prefix, duplicates, empty strings, and
+    // characters which are negative as a char
+    const std::vector<int> lengths    = random_keys(n, 12, 38);
+    const std::vector<int> characters = random_keys(n * 12, 6, 39);
+
+    std::vector<std::string> strings(n);
+    for (std::size_t i = 0, c = 0; i < n; i++)
+    {
+        if (i % 3 == 0)
+        {
+            strings[i] = "a long common prefix ";
+        }
+        for (int j = 0; j < lengths[i]; j++, c++)
+        {
+            const char alphabet[] = { '\0', 'a', 'b', 'c', 'z', '\x80', '\xff' };
+            strings[i] += alphabet[characters[c]];
+        }
+    }
+
+    std::vector<char> chars;
+    std::vector<int>  offsets = { 0 };
+    for (const std::string& s : strings)
+    {
+        chars.insert(chars.end(), s.begin(), s.end());
+        offsets.push_back(static_cast<int>(chars.size()));
+    }
+
+    // equal strings stay in the order of their indices
+    std::vector<int> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) { return strings[a] < strings[b]; });
+
+    const thrust::host_vector<char> d_chars(chars.begin(), chars.end());
+    const thrust::host_vector<int>  d_offsets(offsets.begin(), offsets.end());
+    thrust::host_vector<int>        d_permutation(n);
+
+    auto end = thrust::sort_strings(thrust::tbb::par, d_chars.begin(), d_offsets.begin(), d_offsets.end(), d_permutation.begin());
+    ASSERT_EQ(end, d_permutation.end());
+    ASSERT_EQ(std::vector<int>(d_permutation.begin(), d_permutation.end()), expected);
+}
+
+// The ranges are split along the merge path at key boundaries, and the
+// chunks are written in parallel at the offsets of their output
+TEST(TbbTests, TestMergeJoin)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // sparse matches, and a key with many matches on both sides
+    std::vector<int> keys1 = random_keys(200000, 100000, 40);
+    std::vector<int> keys2 = random_keys(150000, 100000, 41);
+    keys1.insert(keys1.end(), 500, 77777);
+    keys2.insert(keys2.end(), 400, 77777);
+
+    for (bool descending : { false, true })
+    {
+        SCOPED_TRACE(testing::Message() << "with greater= " << descending);
+
+        std::sort(keys1.begin(), keys1.end());
+        std::sort(keys2.begin(), keys2.end());
+        if (descending)
+        {
+            std::reverse(keys1.begin(), keys1.end());
+            std::reverse(keys2.begin(), keys2.end());
+        }
+
+        std::vector<long long> expected_inner1, expected_inner2;
+        std::vector<long long> expected_outer1, expected_outer2;
+        std::vector<long long> expected_semi;
+        for (std::size_t i = 0; i < keys1.size(); i++)
+        {
+            const auto range = descending
+                               ? std::equal_range(keys2.begin(), keys2.end(), keys1[i], std::greater<int>())
+                               : std::equal_range(keys2.begin(), keys2.end(), keys1[i]);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                expected_inner1.push_back(i);
+                expected_inner2.push_back(it - keys2.begin());
+            }
+            if (range.first == range.second)
+            {
+                expected_outer1.push_back(i);
+                expected_outer2.push_back(-1);
+            }
+            else
+            {
+                expected_outer1.insert(expected_outer1.end(), expected_inner1.end() - (range.second - range.first), expected_inner1.end());
+                expected_outer2.insert(expected_outer2.end(), expected_inner2.end() - (range.second - range.first), expected_inner2.end());
+                expected_semi.push_back(i);
+            }
+        }
+
+        const thrust::host_vector<int> d_keys1(keys1.begin(), keys1.end());
+        const thrust::host_vector<int> d_keys2(keys2.begin(), keys2.end());
+        thrust::host_vector<long long> d_index1(expected_outer1.size());
+        thrust::host_vector<long long> d_index2(expected_outer1.size());
+
+        using iterator = thrust::host_vector<long long>::iterator;
+        thrust::pair<iterator, iterator> ends;
+        iterator                         semi_end;
+        if (descending)
+        {
+            ends = thrust::merge_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                      d_index1.begin(), d_index2.begin(), thrust::greater<int>());
+        }
+        else
+        {
+            ends = thrust::merge_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                      d_index1.begin(), d_index2.begin());
+        }
+        ASSERT_EQ(std::vector<long long>(d_index1.begin(), ends.first), expected_inner1);
+        ASSERT_EQ(std::vector<long long>(d_index2.begin(), ends.second), expected_inner2);
+
+        if (descending)
+        {
+            ends = thrust::merge_left_outer_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                                 d_index1.begin(), d_index2.begin(), thrust::greater<int>());
+        }
+        else
+        {
+            ends = thrust::merge_left_outer_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                                 d_index1.begin(), d_index2.begin());
+        }
+        ASSERT_EQ(std::vector<long long>(d_index1.begin(), ends.first), expected_outer1);
+        ASSERT_EQ(std::vector<long long>(d_index2.begin(), ends.second), expected_outer2);
+
+        if (descending)
+        {
+            semi_end = thrust::merge_semi_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                               d_index1.begin(), thrust::greater<int>());
+        }
+        else
+        {
+            semi_end = thrust::merge_semi_join(thrust::tbb::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(), d_keys2.end(),
+                                               d_index1.begin());
+        }
+        ASSERT_EQ(std::vector<long long>(d_index1.begin(), semi_end), expected_semi);
+    }
+}
+
+// Keys which are equal when they have the same last three digits
+struct same_last_digits
+{
+    bool operator()(int a, int b) const
+    {
+        return a % 1000 == b % 1000;
+    }
+};
+
+struct last_digits_hash
+{
+    unsigned long long operator()(int x) const
+    {
+        return static_cast<unsigned long long>(x % 1000);
+    }
+};
+
+// Every thread aggregates its share of the input in a table of its own, and
+// the tables are merged in parallel by partitions of the hash space
+TEST(TbbTests, TestHashReduceByKey)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const std::size_t n = 1 << 20;
+
+    const std::vector<int>         values = random_keys(n, 1000, 42);
+    const thrust::host_vector<int> d_values(values.begin(), values.end());
+
+    // few distinct keys, and mostly distinct ones
+    for (int max_key : { 1000, 1 << 30 })
+    {
+        SCOPED_TRACE(testing::Message() << "with max_key= " << max_key);
+
+        const std::vector<int>         keys = random_keys(n, max_key, 43);
+        const thrust::host_vector<int> d_keys(keys.begin(), keys.end());
+
+        std::vector<std::pair<int, long long>> pairs(n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            pairs[i] = std::make_pair(keys[i], static_cast<long long>(values[i]));
+        }
+        std::sort(pairs.begin(), pairs.end());
+
+        std::vector<std::pair<int, long long>> expected;
+        for (const auto& p : pairs)
+        {
+            if (expected.empty() || expected.back().first != p.first)
+            {
+                expected.push_back(std::make_pair(p.first, 0ll));
+            }
+            expected.back().second += p.second;
+        }
+
+        thrust::host_vector<int>       d_keys_output(n);
+        thrust::host_vector<long long> d_values_output(n);
+
+        auto ends = thrust::hash_reduce_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(),
+                                               d_keys_output.begin(), d_values_output.begin());
+        ASSERT_EQ(static_cast<std::size_t>(ends.first - d_keys_output.begin()), expected.size());
+        ASSERT_EQ(ends.second - d_values_output.begin(), ends.first - d_keys_output.begin());
+
+        // in any order
+        std::vector<std::pair<int, long long>> result(expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++)
+        {
+            result[i] = std::make_pair(d_keys_output[i], d_values_output[i]);
+        }
+        std::sort(result.begin(), result.end());
+        ASSERT_EQ(result, expected);
+
+        // with a predicate, a function and a hash which put many keys in one group
+        std::map<int, int> expected_max;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            const auto it = expected_max.emplace(keys[i] % 1000, values[i]).first;
+            it->second    = (std::max)(it->second, values[i]);
+        }
+
+        thrust::host_vector<int> d_max_output(n);
+
+        auto max_ends = thrust::hash_reduce_by_key(thrust::tbb::par, d_keys.begin(), d_keys.end(), d_values.begin(),
+                                                   d_keys_output.begin(), d_max_output.begin(),
+                                                   same_last_digits(), thrust::maximum<int>(), last_digits_hash());
+        ASSERT_EQ(static_cast<std::size_t>(max_ends.first - d_keys_output.begin()), expected_max.size());
+
+        std::vector<int> sorted_keys(keys);
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+
+        std::map<int, int> result_max;
+        for (std::size_t i = 0; i < expected_max.size(); i++)
+        {
+            // the key written is one of the group
+            ASSERT_TRUE(std::binary_search(sorted_keys.begin(), sorted_keys.end(), d_keys_output[i]));
+            ASSERT_TRUE(result_max.emplace(d_keys_output[i] % 1000, d_max_output[i]).second);
+        }
+        ASSERT_EQ(result_max, expected_max);
+    }
+}
@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/system/detail/generic/unique.h>
 #include <thrust/unique.h>
 
 #include "test_header.hpp"
@@ -186,6 +187,66 @@ TYPED_TEST(UniqueIntegralTests, TestUnique)
     }
 }
 
+TYPED_TEST(UniqueIntegralTests, TestUniqueGenericTiles)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the generic implementation compacts the range in place one tile at a
+    // time, comparing the first element of a tile with the last one of the
+    // previous tile; use tiny tiles so that runs of equal elements cross them
+    const std::vector<std::ptrdiff_t> tile_sizes = {1, 2, 7, 64};
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            // few distinct values, so that there are long runs
+            const thrust::host_vector<T> h_data = get_random_data<T>(size, T(0), T(3), seed);
+
+            std::vector<T> expected(h_data.begin(), h_data.end());
+            expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+            // equal under is_equal_div_10_unique, but told apart by their position
+            std::vector<T> expected_div_10(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_div_10[i] = T(h_data[i] * 10 + i % 10);
+            }
+            thrust::host_vector<T> h_data_div_10(expected_div_10.begin(), expected_div_10.end());
+            expected_div_10.erase(std::unique(expected_div_10.begin(), expected_div_10.end(), is_equal_div_10_unique<T>()),
+                                  expected_div_10.end());
+
+            for(auto tile_size : tile_sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "with tile_size= " << tile_size);
+
+                auto policy = thrust::host;
+
+                thrust::host_vector<T> h_result = h_data;
+                h_result.resize(thrust::system::detail::generic::detail::unique_tiles(
+                                    policy, h_result.begin(), h_result.end(), thrust::equal_to<T>(), tile_size)
+                                - h_result.begin());
+
+                ASSERT_EQ(std::vector<T>(h_result.begin(), h_result.end()), expected);
+
+                // the first element of every run is kept
+                h_result = h_data_div_10;
+                h_result.resize(thrust::system::detail::generic::detail::unique_tiles(
+                                    policy, h_result.begin(), h_result.end(), is_equal_div_10_unique<T>(), tile_size)
+                                - h_result.begin());
+
+                ASSERT_EQ(std::vector<T>(h_result.begin(), h_result.end()), expected_div_10);
+            }
+        }
+    }
+}
+
 TYPED_TEST(UniqueTests, TestUniqueCopySimple)
 {
     using Vector = typename TestFixture::input_type;
@@ -19,6 +19,7 @@
 #include <thrust/device_vector.h>
 #include <thrust/memory.h>
 #include <thrust/sequence.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include "test_header.hpp"
 
@@ -774,6 +775,61 @@ TYPED_TEST(VectorTests, TestVectorResizing)
     ASSERT_EQ(v.size(), 0);
 }
 
+TYPED_TEST(VectorTests, TestVectorNoInit)
+{
+    using Vector = typename TestFixture::input_type;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v(3, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 3);
+
+    v[0] = T(0);
+    v[1] = T(1);
+    v[2] = T(2);
+
+    // growing without initialization keeps the existing elements
+    v.resize(100, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 100);
+
+    ASSERT_EQ(v[0], T(0));
+    ASSERT_EQ(v[1], T(1));
+    ASSERT_EQ(v[2], T(2));
+
+    v[99] = T(99);
+    ASSERT_EQ(v[99], T(99));
+
+    v.resize(2, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 2);
+    ASSERT_EQ(v[1], T(1));
+
+    Vector w(0, thrust::no_init, v.get_allocator());
+    ASSERT_EQ(w.size(), 0);
+}
+
+struct non_trivial_element
+{
+    int value;
+
+    THRUST_HOST_DEVICE non_trivial_element() : value(42) {}
+};
+
+TEST(VectorTests, TestVectorNoInitNonTrivial)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // elements whose default constructor does something are still default constructed
+    thrust::host_vector<non_trivial_element> v(10, thrust::no_init);
+    ASSERT_EQ(v[9].value, 42);
+
+    v.resize(1000, thrust::no_init);
+    ASSERT_EQ(v[999].value, 42);
+}
+
 TYPED_TEST(VectorTests, TestVectorReserving)
 {
     using Vector = typename TestFixture::input_type;
@@ -793,6 +849,135 @@ TYPED_TEST(VectorTests, TestVectorReserving)
     ASSERT_EQ(v.capacity(), old_capacity);
 }
 
+// copying and destroying are counted, to check that relocating the elements
+// by copying their bytes does neither
+struct relocatable_element
+{
+    static int copies;
+    static int destructions;
+
+    int value;
+
+    relocatable_element(int v = 0) : value(v) {}
+    relocatable_element(const relocatable_element& other) : value(other.value) { ++copies; }
+    relocatable_element& operator=(const relocatable_element& other)
+    {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    ~relocatable_element() { ++destructions; }
+};
+
+int relocatable_element::copies       = 0;
+int relocatable_element::destructions = 0;
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(relocatable_element)
+
+TEST(VectorTests, TestVectorTriviallyRelocatable)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<relocatable_element> v;
+    for(int i = 0; i < 100; i++)
+        v.push_back(relocatable_element(i));
+
+    for(int i = 0; i < 100; i++)
+        ASSERT_EQ(v[i].value, i);
+
+    // growth neither copies nor destroys
+    relocatable_element::copies       = 0;
+    relocatable_element::destructions = 0;
+
+    v.reserve(1000);
+    ASSERT_EQ(relocatable_element::copies, 0);
+    ASSERT_EQ(relocatable_element::destructions, 0);
+
+    // insertion into the existing storage
+    v.insert(v.begin() + 10, 3, relocatable_element(-1));
+    ASSERT_EQ(v.size(), 103);
+    ASSERT_EQ(v[9].value, 9);
+    ASSERT_EQ(v[10].value, -1);
+    ASSERT_EQ(v[12].value, -1);
+    ASSERT_EQ(v[13].value, 10);
+    ASSERT_EQ(v[102].value, 99);
+
+    // insertion of an element of the vector itself, which is displaced
+    v.insert(v.begin(), v[20]);
+    ASSERT_EQ(v[0].value, 17);
+    ASSERT_EQ(v[21].value, 17);
+
+    std::vector<relocatable_element> range(5, relocatable_element(-2));
+    v.insert(v.begin() + 50, range.begin(), range.end());
+    ASSERT_EQ(v.size(), 109);
+    ASSERT_EQ(v[49].value, 45);
+    ASSERT_EQ(v[50].value, -2);
+    ASSERT_EQ(v[55].value, 46);
+
+    // erasure only destroys the erased elements
+    relocatable_element::copies       = 0;
+    relocatable_element::destructions = 0;
+
+    v.erase(v.begin() + 50, v.begin() + 55);
+    v.erase(v.begin() + 11, v.begin() + 14);
+    v.erase(v.begin());
+    ASSERT_EQ(relocatable_element::copies, 0);
+    ASSERT_EQ(relocatable_element::destructions, 9);
+
+    ASSERT_EQ(v.size(), 100);
+    for(int i = 0; i < 100; i++)
+        ASSERT_EQ(v[i].value, i);
+
+    // growth on insertion
+    v.shrink_to_fit();
+    v.insert(v.begin() + 50, 100, relocatable_element(-3));
+    ASSERT_EQ(v.size(), 200);
+    ASSERT_EQ(v[49].value, 49);
+    ASSERT_EQ(v[50].value, -3);
+    ASSERT_EQ(v[150].value, 50);
+    ASSERT_EQ(v[199].value, 99);
+}
+
+struct move_counted_element
+{
+    static int copies;
+
+    int value;
+
+    move_counted_element(int v = 0) : value(v) {}
+    move_counted_element(const move_counted_element& other) : value(other.value) { ++copies; }
+    move_counted_element(move_counted_element&& other) noexcept : value(other.value) { other.value = -1; }
+    move_counted_element& operator=(const move_counted_element& other) = default;
+};
+
+int move_counted_element::copies = 0;
+
+TEST(VectorTests, TestVectorGrowthMoves)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<move_counted_element> v(10);
+    for(int i = 0; i < 10; i++)
+        v[i].value = i;
+
+    // elements with a move constructor which doesn't throw are moved, not
+    // copied, into new storage
+    move_counted_element::copies = 0;
+    v.reserve(100);
+    ASSERT_EQ(move_counted_element::copies, 0);
+
+    v.insert(v.begin() + 5, 200, move_counted_element(-2));
+
+    move_counted_element::copies = 0;
+    v.resize(1000);
+    ASSERT_EQ(move_counted_element::copies, 0);
+
+    ASSERT_EQ(v[4].value, 4);
+    ASSERT_EQ(v[5].value, -2);
+    ASSERT_EQ(v[205].value, 5);
+    ASSERT_EQ(v[209].value, 9);
+}
+
 TEST(VectorTests, TestVectorUninitialisedCopy)
 {
     SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
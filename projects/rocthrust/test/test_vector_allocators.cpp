@@ -17,6 +17,10 @@
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
+#include <thrust/uninitialized_allocator.h>
+#include <thrust/universal_vector.h>
+
+#include <cstring>
 
 #include "test_header.hpp"
 
@@ -274,3 +278,91 @@ TEST(VectorAllocatorTests, TestVectorAllocatorPropagateOnSwapDevice)
     
     TestVectorAllocatorPropagateOnSwap<device_vector_nsp>();
 }
+
+// an allocator which fills the memory it allocates with a pattern, so that
+// elements left uninitialized can be told apart
+template<typename T>
+class pattern_allocator : public std::allocator<T>
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = pattern_allocator<U>;
+    };
+
+    pattern_allocator() = default;
+
+    template<typename U>
+    pattern_allocator(const pattern_allocator<U> &)
+    {
+    }
+
+    T * allocate(std::size_t n)
+    {
+        T * ret = std::allocator<T>::allocate(n);
+        std::memset(static_cast<void *>(ret), 0x5a, n * sizeof(T));
+        return ret;
+    }
+};
+
+TEST(VectorAllocatorTests, TestUninitializedAllocator)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    using Alloc = thrust::uninitialized_allocator<int, pattern_allocator<int>>;
+
+    int pattern;
+    std::memset(&pattern, 0x5a, sizeof(pattern));
+
+    // default construction and resizing without a value leave the elements uninitialized
+    thrust::host_vector<int, Alloc> v(10);
+    ASSERT_EQ(v[0], pattern);
+    ASSERT_EQ(v[9], pattern);
+
+    v[0] = 1;
+    v.resize(1000);
+    ASSERT_EQ(v[0], 1);
+    ASSERT_EQ(v[999], pattern);
+
+    // elements given a value are initialized
+    v.resize(2000, 7);
+    ASSERT_EQ(v[1000], 7);
+    ASSERT_EQ(v[1999], 7);
+
+    thrust::host_vector<int, Alloc> w(5, 3);
+    ASSERT_EQ(w[4], 3);
+
+    // copies are initialized
+    thrust::host_vector<int, Alloc> x(v);
+    ASSERT_EQ(x[0], 1);
+    ASSERT_EQ(x[1999], 7);
+
+    // rebinding keeps the adaptor, and rebinds the adapted allocator
+    using Rebound = typename thrust::detail::allocator_traits<Alloc>::template rebind_alloc<char>;
+    ASSERT_TRUE((std::is_same<typename Rebound::value_type, char>::value));
+    ASSERT_TRUE((std::is_base_of<pattern_allocator<char>, Rebound>::value));
+
+    Rebound rebound(v.get_allocator());
+    char * c = rebound.allocate(4);
+    ASSERT_EQ(c[3], 0x5a);
+    rebound.deallocate(c, 4);
+}
+
+TEST(VectorAllocatorTests, TestUninitializedVectors)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::uninitialized_host_vector<float> h(1000);
+    h.resize(2000);
+    h[1999] = 1.0f;
+    ASSERT_EQ(h[1999], 1.0f);
+
+    thrust::uninitialized_universal_vector<float> u(1000);
+    u.resize(2000, 2.0f);
+    u[0] = 1.0f;
+    ASSERT_EQ(u[0], 1.0f);
+    ASSERT_EQ(u[1999], 2.0f);
+}
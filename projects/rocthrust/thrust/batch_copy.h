@@ -0,0 +1,168 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file batch_copy.h
+ *  \brief Functions for copying many buffers at once
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup copying
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p batch_copy copies \p num_buffers independent buffers in a single call: buffer \c i of
+ *  <tt>sizes[i]</tt> elements is copied from the range beginning at <tt>src_ptrs[i]</tt> to the range
+ *  beginning at <tt>dst_ptrs[i]</tt>. That is, it performs the same assignments as calling \p copy_n
+ *  once per buffer,
+ *
+ *  \code
+ *  for(Size i = 0; i < num_buffers; ++i)
+ *    thrust::copy_n(src_ptrs[i], sizes[i], dst_ptrs[i]);
+ *  \endcode
+ *
+ *  but dispatches and launches only once, however many buffers there are. On the host systems
+ *  the elements of all of the buffers are split evenly over the threads, so a large buffer is
+ *  copied by several threads and many small ones by a single thread, and buffers of trivially
+ *  copyable elements are copied with \c memcpy.
+ *
+ *  The order in which the buffers are copied is unspecified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param src_ptrs The beginning of the sequence of iterators to the source buffers.
+ *  \param dst_ptrs The beginning of the sequence of iterators to the destination buffers.
+ *  \param sizes The beginning of the sequence of buffer sizes, in elements.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is assignable from the \c value_type of \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre No destination buffer shall overlap a source buffer or another destination buffer.
+ *
+ *  The following code snippet demonstrates how to use \p batch_copy to pack three buffers of
+ *  different sizes into one array using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/batch_copy.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int a[2] = {1, 2};
+ *  int b[1] = {3};
+ *  int c[3] = {4, 5, 6};
+ *  int packed[6];
+ *
+ *  const int *src_ptrs[3] = {a, b, c};
+ *  int       *dst_ptrs[3] = {packed, packed + 2, packed + 3};
+ *  int        sizes[3]    = {2, 1, 3};
+ *
+ *  thrust::batch_copy(thrust::host, src_ptrs, dst_ptrs, sizes, 3);
+ *
+ *  // packed is now {1, 2, 3, 4, 5, 6}
+ *  \endcode
+ *
+ *  \see \p copy_n
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+THRUST_HOST_DEVICE
+  void batch_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers);
+
+
+/*! \p batch_copy copies \p num_buffers independent buffers in a single call: buffer \c i of
+ *  <tt>sizes[i]</tt> elements is copied from the range beginning at <tt>src_ptrs[i]</tt> to the range
+ *  beginning at <tt>dst_ptrs[i]</tt>. That is, it performs the same assignments as calling \p copy_n
+ *  once per buffer, but dispatches and launches only once, however many buffers there are.
+ *
+ *  The order in which the buffers are copied is unspecified.
+ *
+ *  \param src_ptrs The beginning of the sequence of iterators to the source buffers.
+ *  \param dst_ptrs The beginning of the sequence of iterators to the destination buffers.
+ *  \param sizes The beginning of the sequence of buffer sizes, in elements.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is assignable from the \c value_type of \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre No destination buffer shall overlap a source buffer or another destination buffer.
+ *
+ *  The following code snippet demonstrates how to use \p batch_copy to pack three buffers of
+ *  different sizes into one array:
+ *
+ *  \code
+ *  #include <thrust/batch_copy.h>
+ *  ...
+ *  int a[2] = {1, 2};
+ *  int b[1] = {3};
+ *  int c[3] = {4, 5, 6};
+ *  int packed[6];
+ *
+ *  const int *src_ptrs[3] = {a, b, c};
+ *  int       *dst_ptrs[3] = {packed, packed + 2, packed + 3};
+ *  int        sizes[3]    = {2, 1, 3};
+ *
+ *  thrust::batch_copy(src_ptrs, dst_ptrs, sizes, 3);
+ *
+ *  // packed is now {1, 2, 3, 4, 5, 6}
+ *  \endcode
+ *
+ *  \see \p copy_n
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+  void batch_copy(RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers);
+
+
+/*! \} // end copying
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/batch_copy.inl>
@@ -64,6 +64,7 @@
 # thrust_is_tbb_system_found(<var_name>)
 # thrust_is_omp_system_found(<var_name>)
 # thrust_is_cpp_system_found(<var_name>)
+# thrust_is_stdpar_system_found(<var_name>)
 #
 # # Define / update THRUST_${system}_FOUND flags in current scope
 # thrust_update_system_found_flags()
@@ -86,7 +87,7 @@ set(thrust_libcudacxx_version "${Thrust_VERSION}")
 
 # Advertise system options:
 set(THRUST_HOST_SYSTEM_OPTIONS
-  CPP OMP TBB
+  CPP OMP TBB STDPAR
   CACHE INTERNAL "Valid Thrust host systems."
   FORCE
 )
@@ -262,6 +263,11 @@ function(thrust_is_omp_system_found var_name)
   set(${var_name} ${${var_name}} PARENT_SCOPE)
 endfunction()
 
+function(thrust_is_stdpar_system_found var_name)
+  thrust_is_system_found(STDPAR ${var_name})
+  set(${var_name} ${${var_name}} PARENT_SCOPE)
+endfunction()
+
 # Since components are loaded lazily, this will refresh the
 # THRUST_${component}_FOUND flags in the current scope.
 # Alternatively, check system states individually using the
@@ -272,6 +278,7 @@ macro(thrust_update_system_found_flags)
   thrust_is_system_found(CUDA THRUST_CUDA_FOUND)
   thrust_is_system_found(TBB  THRUST_TBB_FOUND)
   thrust_is_system_found(OMP  THRUST_OMP_FOUND)
+  thrust_is_system_found(STDPAR THRUST_STDPAR_FOUND)
 endmacro()
 
 function(thrust_debug msg)
@@ -359,6 +366,8 @@ function(thrust_debug_internal_targets)
   _thrust_debug_backend_targets(TBB "${THRUST_TBB_VERSION}")
   thrust_debug_target(TBB::tbb "${THRUST_TBB_VERSION}")
 
+  _thrust_debug_backend_targets(STDPAR "Thrust ${THRUST_VERSION}")
+
   _thrust_debug_backend_targets(CUDA "CUB ${THRUST_CUB_VERSION}")
   thrust_debug_target(CUB::CUB "${THRUST_CUB_VERSION}")
   thrust_debug_target(libcudacxx::libcudacxx "${THRUST_libcudacxx_VERSION}")
@@ -645,6 +654,27 @@ macro(_thrust_find_OMP required)
   endif()
 endmacro()
 
+# The STDPAR backend forwards to the C++17 parallel algorithms of the standard
+# library. libstdc++ implements them on top of TBB, so TBB is linked when it is
+# available; without it the standard algorithms run sequentially.
+macro(_thrust_find_STDPAR required)
+  if (NOT TARGET Thrust::STDPAR)
+    thrust_debug("Generating STDPAR targets." internal)
+    if (NOT TARGET TBB::tbb)
+      find_package(TBB CONFIG QUIET)
+    endif()
+
+    _thrust_declare_interface_alias(Thrust::STDPAR _Thrust_STDPAR)
+    target_link_libraries(_Thrust_STDPAR INTERFACE Thrust::Thrust)
+    target_compile_features(_Thrust_STDPAR INTERFACE cxx_std_17)
+    if (TARGET TBB::tbb)
+      target_link_libraries(_Thrust_STDPAR INTERFACE TBB::tbb)
+    endif()
+    thrust_debug_target(Thrust::STDPAR "Thrust ${THRUST_VERSION}" internal)
+    _thrust_setup_system(STDPAR)
+  endif()
+endmacro()
+
 # This must be a macro instead of a function to ensure that backends passed to
 # find_package(Thrust COMPONENTS [...]) have their full configuration loaded
 # into the current scope. This provides at least some remedy for CMake issue
@@ -661,6 +691,8 @@ macro(_thrust_find_backend backend required)
     _thrust_find_TBB("${required}")
   elseif ("${backend}" STREQUAL "OMP")
     _thrust_find_OMP("${required}")
+  elseif ("${backend}" STREQUAL "STDPAR")
+    _thrust_find_STDPAR("${required}")
   else()
     message(FATAL_ERROR "_thrust_find_backend: Invalid system: ${backend}")
   endif()
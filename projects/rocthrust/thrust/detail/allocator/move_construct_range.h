@@ -0,0 +1,98 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/destroy_range.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <memory>
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+template<typename Allocator, typename T>
+  struct has_effectful_member_move_construct
+    : has_member_constructN<Allocator,T,T>
+{};
+
+// std::allocator::construct's only effect is to invoke T's constructor
+template<typename U, typename T>
+  struct has_effectful_member_move_construct<std::allocator<U>, T>
+    : thrust::detail::false_type
+{};
+
+} // end allocator_traits_detail
+
+
+// the elements of an allocator may be moved on the host without involving the
+// allocator if the host accesses them through raw pointers, and neither
+// constructing nor destroying them through the allocator has other effects
+template<typename Allocator>
+  struct is_host_movable_with_allocator
+    : integral_constant<
+        bool,
+        std::is_pointer<typename allocator_traits<Allocator>::pointer>::value &&
+        !allocator_traits_detail::has_effectful_member_move_construct<
+          Allocator,
+          typename allocator_traits<Allocator>::value_type
+        >::value &&
+        !allocator_traits_detail::has_effectful_member_destroy<
+          Allocator,
+          typename allocator_traits<Allocator>::value_type
+        >::value
+      >
+{};
+
+// trivially relocatable elements which may be moved on the host are moved by
+// copying their bytes, after which the source is not destroyed
+template<typename Allocator>
+  struct is_trivially_relocatable_with_allocator
+    : integral_constant<
+        bool,
+        is_host_movable_with_allocator<Allocator>::value &&
+        is_trivially_relocatable<
+          typename allocator_traits<Allocator>::value_type
+        >::value
+      >
+{};
+
+// constructs the elements of [result, result + n) from those of
+// [first, first + n), moving them unless moving may throw and copying is
+// possible; requires is_host_movable_with_allocator
+template<typename Allocator, typename Pointer, typename Size>
+  inline Pointer move_construct_range(Allocator &a, Pointer first, Size n, Pointer result);
+
+// ends the lifetime of either side of a move by move_construct_range
+template<typename Allocator, typename Pointer, typename Size>
+  inline void destroy_moved_range(Allocator &a, Pointer p, Size n);
+
+// moves the elements of [first, first + n) to the possibly overlapping range
+// at result by copying their bytes; requires
+// is_trivially_relocatable_with_allocator
+template<typename Pointer, typename Size>
+  inline void relocate_range(Pointer first, Size n, Pointer result);
+
+} // end detail
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/allocator/move_construct_range.inl>
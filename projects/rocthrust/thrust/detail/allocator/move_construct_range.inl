@@ -0,0 +1,133 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/move_construct_range.h>
+
+#include <cstring>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+
+// move_construct_range has two cases:
+// 1. if the elements are trivially relocatable, copy their bytes
+// 2. else move construct each element, or copy construct it if its move
+//    constructor may throw, so that the source is intact if a constructor
+//    throws
+
+// case 1: trivially relocatable elements
+template<typename Allocator, typename Pointer, typename Size>
+  typename enable_if<
+    is_trivially_relocatable_with_allocator<Allocator>::value,
+    Pointer
+  >::type
+    move_construct_range(Allocator &, Pointer first, Size n, Pointer result)
+{
+  if(n > 0)
+  {
+    std::memcpy(static_cast<void*>(result), static_cast<const void*>(first), n * sizeof(*first));
+  }
+
+  return result + n;
+}
+
+
+// case 2: other elements
+template<typename Allocator, typename Pointer, typename Size>
+  typename disable_if<
+    is_trivially_relocatable_with_allocator<Allocator>::value,
+    Pointer
+  >::type
+    move_construct_range(Allocator &a, Pointer first, Size n, Pointer result)
+{
+  using T = typename allocator_traits<Allocator>::value_type;
+
+  Size i = 0;
+
+  try
+  {
+    for(; i < n; ++i)
+    {
+      ::new(static_cast<void*>(result + i)) T(std::move_if_noexcept(first[i]));
+    }
+  }
+  catch(...)
+  {
+    destroy_range(a, result, i);
+    throw;
+  }
+
+  return result + n;
+}
+
+
+// a move by copying bytes leaves a single object, so neither side is destroyed
+template<typename Allocator, typename Pointer, typename Size>
+  typename enable_if<
+    is_trivially_relocatable_with_allocator<Allocator>::value
+  >::type
+    destroy_moved_range(Allocator &, Pointer, Size)
+{
+  // no op
+}
+
+
+template<typename Allocator, typename Pointer, typename Size>
+  typename disable_if<
+    is_trivially_relocatable_with_allocator<Allocator>::value
+  >::type
+    destroy_moved_range(Allocator &a, Pointer p, Size n)
+{
+  destroy_range(a, p, n);
+}
+
+
+} // end allocator_traits_detail
+
+
+template<typename Allocator, typename Pointer, typename Size>
+  Pointer move_construct_range(Allocator &a, Pointer first, Size n, Pointer result)
+{
+  return allocator_traits_detail::move_construct_range(a, first, n, result);
+}
+
+
+template<typename Allocator, typename Pointer, typename Size>
+  void destroy_moved_range(Allocator &a, Pointer p, Size n)
+{
+  allocator_traits_detail::destroy_moved_range(a, p, n);
+}
+
+
+template<typename Pointer, typename Size>
+  void relocate_range(Pointer first, Size n, Pointer result)
+{
+  if(n > 0)
+  {
+    std::memmove(static_cast<void*>(result), static_cast<const void*>(first), n * sizeof(*first));
+  }
+}
+
+
+} // end detail
+THRUST_NAMESPACE_END
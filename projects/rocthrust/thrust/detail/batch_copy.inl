@@ -0,0 +1,70 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/batch_copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/batch_copy.h>
+#include <thrust/system/detail/adl/batch_copy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+THRUST_HOST_DEVICE
+  void batch_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers)
+{
+  using thrust::system::detail::generic::batch_copy;
+  return batch_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), src_ptrs, dst_ptrs, sizes, num_buffers);
+} // end batch_copy()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+  void batch_copy(RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::batch_copy(select_system(system1,system2,system3), src_ptrs, dst_ptrs, sizes, num_buffers);
+} // end batch_copy()
+
+
+THRUST_NAMESPACE_END
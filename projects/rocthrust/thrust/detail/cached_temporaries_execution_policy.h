@@ -0,0 +1,61 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/caching.h>
+#include <thrust/mr/new.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+// gives the execution policies of host systems a cache of the temporary
+// storage of algorithms, shared by all uses of the policies of one system
+template<template <typename> class ExecutionPolicyCRTPBase>
+struct cached_temporaries_execution_policy
+{
+  using temporary_cache_type = thrust::mr::caching_resource<thrust::mr::new_delete_resource>;
+
+  using execute_with_cached_temporaries_type =
+    typename allocator_aware_execution_policy<ExecutionPolicyCRTPBase>::template
+      execute_with_memory_resource_type<temporary_cache_type>::type;
+
+  // the cache of the system, which can be trimmed or bounded through its
+  // trim and set_max_cached_bytes members
+  static temporary_cache_type & temporary_cache()
+  {
+    static temporary_cache_type cache;
+    return cache;
+  }
+
+  // returns a policy of the system which obtains the temporary storage of
+  // algorithms from the cache, so that calling an algorithm repeatedly with
+  // the same sizes allocates memory only the first time
+  execute_with_cached_temporaries_type with_cached_temporaries() const
+  {
+    return execute_with_cached_temporaries_type(&temporary_cache());
+  }
+};
+
+} // end namespace detail
+
+THRUST_NAMESPACE_END
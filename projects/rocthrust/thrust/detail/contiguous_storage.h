@@ -19,6 +19,7 @@
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/detail/execution_policy.h>
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/move_construct_range.h>
 #include <thrust/detail/config.h>
 #include <thrust/sequence_access.h>
 
@@ -143,6 +144,23 @@ template<typename T, typename Alloc>
     THRUST_HOST_DEVICE
     void destroy(iterator first, iterator last);
 
+    // moves [first,last) into the uninitialized storage at result; on the
+    // host, elements are moved rather than copied, and trivially relocatable
+    // elements are moved by copying their bytes. One of the two ranges must
+    // then be passed to destroy_moved
+    iterator uninitialized_move(iterator first, iterator last, iterator result);
+
+    // ends the lifetime of either range of a call to uninitialized_move
+    void destroy_moved(iterator first, iterator last);
+
+    // moves [first,last) to the possibly overlapping uninitialized storage at
+    // result by copying their bytes, leaving [first,last) uninitialized;
+    // only available when relocates_trivially is true
+    void relocate(iterator first, iterator last, iterator result);
+
+    // whether relocate is available
+    using relocates_trivially = is_trivially_relocatable_with_allocator<Alloc>;
+
     THRUST_HOST_DEVICE
     void deallocate_on_allocator_mismatch(const contiguous_storage &other);
 
@@ -207,6 +225,14 @@ template<typename T, typename Alloc>
     void destroy_on_allocator_mismatch_dispatch(false_type, const contiguous_storage &other,
         iterator first, iterator last);
 
+    iterator uninitialized_move_dispatch(true_type, iterator first, iterator last, iterator result);
+
+    iterator uninitialized_move_dispatch(false_type, iterator first, iterator last, iterator result);
+
+    void destroy_moved_dispatch(true_type, iterator first, iterator last);
+
+    void destroy_moved_dispatch(false_type, iterator first, iterator last);
+
     THRUST_HOST_DEVICE
     void propagate_allocator_dispatch(true_type, const contiguous_storage &other);
 
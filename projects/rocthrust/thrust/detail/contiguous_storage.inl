@@ -319,6 +319,30 @@ THRUST_HOST_DEVICE
   destroy_range(m_allocator, first.base(), last - first);
 } // end contiguous_storage::destroy()
 
+template<typename T, typename Alloc>
+  typename contiguous_storage<T,Alloc>::iterator
+    contiguous_storage<T,Alloc>
+      ::uninitialized_move(iterator first, iterator last, iterator result)
+{
+  return uninitialized_move_dispatch(is_host_movable_with_allocator<Alloc>(), first, last, result);
+} // end contiguous_storage::uninitialized_move()
+
+template<typename T, typename Alloc>
+  void contiguous_storage<T,Alloc>
+    ::destroy_moved(iterator first, iterator last)
+{
+  destroy_moved_dispatch(is_host_movable_with_allocator<Alloc>(), first, last);
+} // end contiguous_storage::destroy_moved()
+
+template<typename T, typename Alloc>
+  void contiguous_storage<T,Alloc>
+    ::relocate(iterator first, iterator last, iterator result)
+{
+  static_assert(relocates_trivially::value, "the elements cannot be relocated by copying their bytes");
+
+  relocate_range(first.base(), last - first, result.base());
+} // end contiguous_storage::relocate()
+
 template<typename T, typename Alloc>
 THRUST_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -502,6 +526,38 @@ THRUST_HOST_DEVICE
 {
 } // end contiguous_storage::destroy_on_allocator_mismatch()
 
+template<typename T, typename Alloc>
+  typename contiguous_storage<T,Alloc>::iterator
+    contiguous_storage<T,Alloc>
+      ::uninitialized_move_dispatch(true_type, iterator first, iterator last, iterator result)
+{
+  return iterator(move_construct_range(m_allocator, first.base(), last - first, result.base()));
+} // end contiguous_storage::uninitialized_move_dispatch()
+
+template<typename T, typename Alloc>
+  typename contiguous_storage<T,Alloc>::iterator
+    contiguous_storage<T,Alloc>
+      ::uninitialized_move_dispatch(false_type, iterator first, iterator last, iterator result)
+{
+  // elements which the host cannot access, or which are constructed through
+  // the allocator, are copied as before
+  return uninitialized_copy(first, last, result);
+} // end contiguous_storage::uninitialized_move_dispatch()
+
+template<typename T, typename Alloc>
+  void contiguous_storage<T,Alloc>
+    ::destroy_moved_dispatch(true_type, iterator first, iterator last)
+{
+  destroy_moved_range(m_allocator, first.base(), last - first);
+} // end contiguous_storage::destroy_moved_dispatch()
+
+template<typename T, typename Alloc>
+  void contiguous_storage<T,Alloc>
+    ::destroy_moved_dispatch(false_type, iterator first, iterator last)
+{
+  destroy(first, last);
+} // end contiguous_storage::destroy_moved_dispatch()
+
 THRUST_EXEC_CHECK_DISABLE
 template<typename T, typename Alloc>
 THRUST_HOST_DEVICE
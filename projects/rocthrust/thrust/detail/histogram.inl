@@ -0,0 +1,112 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/adl/histogram.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+THRUST_HOST_DEVICE
+  RandomAccessIterator histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level)
+{
+  using thrust::system::detail::generic::histogram_even;
+  return histogram_even(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator1 histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last)
+{
+  using thrust::system::detail::generic::histogram_range;
+  return histogram_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+  RandomAccessIterator histogram_even(InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_even(select_system(system1, system2), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+
+template<typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator1 histogram_range(InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::histogram_range(select_system(system1, system2, system3), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,319 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/merge_join.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/merge_join.h>
+#include <thrust/system/detail/adl/merge_join.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output)
+{
+  using thrust::system::detail::generic::merge_join;
+  return merge_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output);
+} // end merge_join()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::merge_join;
+  return merge_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_join()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output)
+{
+  using thrust::system::detail::generic::merge_left_outer_join;
+  return merge_left_outer_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output);
+} // end merge_left_outer_join()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::merge_left_outer_join;
+  return merge_left_outer_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_left_outer_join()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output)
+{
+  using thrust::system::detail::generic::merge_semi_join;
+  return merge_semi_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output);
+} // end merge_semi_join()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::merge_semi_join;
+  return merge_semi_join(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, comp);
+} // end merge_semi_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::merge_join(select_system(system1,system2,system3,system4), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output);
+} // end merge_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::merge_join(select_system(system1,system2,system3,system4), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::merge_left_outer_join(select_system(system1,system2,system3,system4), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output);
+} // end merge_left_outer_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::merge_left_outer_join(select_system(system1,system2,system3,system4), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_left_outer_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+  OutputIterator1 merge_semi_join(InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::merge_semi_join(select_system(system1,system2,system3), keys1_first, keys1_last, keys2_first, keys2_last, index1_output);
+} // end merge_semi_join()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+  OutputIterator1 merge_semi_join(InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::merge_semi_join(select_system(system1,system2,system3), keys1_first, keys1_last, keys2_first, keys2_last, index1_output, comp);
+} // end merge_semi_join()
+
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,198 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/system/detail/adl/multiway_merge.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result)
+{
+  using thrust::system::detail::generic::multiway_merge;
+  return multiway_merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), runs_first, runs_last, result);
+} // end multiway_merge()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::multiway_merge;
+  return multiway_merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), runs_first, runs_last, result, comp);
+} // end multiway_merge()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result)
+{
+  using thrust::system::detail::generic::multiway_merge_by_key;
+  return multiway_merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), key_runs_first, key_runs_last, value_runs_first, keys_result, values_result);
+} // end multiway_merge_by_key()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::multiway_merge_by_key;
+  return multiway_merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), key_runs_first, key_runs_last, value_runs_first, keys_result, values_result, comp);
+} // end multiway_merge_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator2 multiway_merge(RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multiway_merge(select_system(system1,system2), runs_first, runs_last, result);
+} // end multiway_merge()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+  RandomAccessIterator2 multiway_merge(RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multiway_merge(select_system(system1,system2), runs_first, runs_last, result, comp);
+} // end multiway_merge()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+  using System4 = typename thrust::iterator_system<RandomAccessIterator4>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::multiway_merge_by_key(select_system(system1,system2,system3,system4), key_runs_first, key_runs_last, value_runs_first, keys_result, values_result);
+} // end multiway_merge_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+  using System4 = typename thrust::iterator_system<RandomAccessIterator4>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::multiway_merge_by_key(select_system(system1,system2,system3,system4), key_runs_first, key_runs_last, value_runs_first, keys_result, values_result, comp);
+} // end multiway_merge_by_key()
+
+
+THRUST_NAMESPACE_END
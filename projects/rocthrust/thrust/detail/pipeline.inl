@@ -0,0 +1,415 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/pipeline.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/detail/type_traits.h>
+
+#include <cstddef>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+// An element flowing through a pipeline; valid is cleared once a filter drops it
+template<typename T>
+struct pipeline_element
+{
+  bool valid;
+  T    value;
+
+  THRUST_HOST_DEVICE
+  pipeline_element() : valid(false), value() {}
+
+  THRUST_HOST_DEVICE
+  pipeline_element(bool valid, const T &value) : valid(valid), value(value) {}
+};
+
+
+struct pipeline_identity_stage
+{
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  pipeline_element<T> operator()(const T &x) const
+  {
+    return pipeline_element<T>(true, x);
+  }
+};
+
+
+template<typename Stage, typename Function>
+struct pipeline_transform_stage
+{
+  Stage            stage;
+  mutable Function f;
+
+  THRUST_HOST_DEVICE
+  pipeline_transform_stage(Stage stage, Function f) : stage(stage), f(f) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  auto operator()(const T &x) const
+    -> pipeline_element<typename std::decay<decltype(std::declval<Function &>()(std::declval<const Stage &>()(x).value))>::type>
+  {
+    using U = typename std::decay<decltype(std::declval<Function &>()(std::declval<const Stage &>()(x).value))>::type;
+
+    auto e = stage(x);
+
+    // dropped elements never reach f
+    return e.valid ? pipeline_element<U>(true, f(e.value)) : pipeline_element<U>();
+  }
+};
+
+
+template<typename Stage, typename Predicate>
+struct pipeline_filter_stage
+{
+  Stage             stage;
+  mutable Predicate pred;
+
+  THRUST_HOST_DEVICE
+  pipeline_filter_stage(Stage stage, Predicate pred) : stage(stage), pred(pred) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  auto operator()(const T &x) const -> decltype(std::declval<const Stage &>()(x))
+  {
+    auto e = stage(x);
+
+    if(e.valid && !pred(e.value))
+    {
+      e.valid = false;
+    }
+
+    return e;
+  }
+};
+
+
+// convert the elements of a pipeline to the type of the reduction
+template<typename Stage, typename T>
+struct pipeline_convert_stage
+{
+  Stage stage;
+
+  THRUST_HOST_DEVICE
+  pipeline_convert_stage(Stage stage) : stage(stage) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename U>
+  THRUST_HOST_DEVICE
+  pipeline_element<T> operator()(const U &x) const
+  {
+    auto e = stage(x);
+
+    return e.valid ? pipeline_element<T>(true, static_cast<T>(e.value)) : pipeline_element<T>();
+  }
+};
+
+
+template<typename Stage>
+struct pipeline_valid_stage
+{
+  Stage stage;
+
+  THRUST_HOST_DEVICE
+  pipeline_valid_stage(Stage stage) : stage(stage) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  bool operator()(const T &x) const
+  {
+    return stage(x).valid;
+  }
+};
+
+
+template<typename Stage>
+struct pipeline_value_stage
+{
+  Stage stage;
+
+  THRUST_HOST_DEVICE
+  pipeline_value_stage(Stage stage) : stage(stage) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  auto operator()(const T &x) const -> decltype(std::declval<const Stage &>()(x).value)
+  {
+    return stage(x).value;
+  }
+};
+
+
+template<typename Stage, typename Size>
+struct pipeline_count_stage
+{
+  Stage stage;
+
+  THRUST_HOST_DEVICE
+  pipeline_count_stage(Stage stage) : stage(stage) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename T>
+  THRUST_HOST_DEVICE
+  Size operator()(const T &x) const
+  {
+    return stage(x).valid ? Size(1) : Size(0);
+  }
+};
+
+
+// combines two partial reductions; a dropped element acts as the identity
+template<typename T, typename BinaryFunction>
+struct pipeline_reduce_op
+{
+  mutable BinaryFunction binary_op;
+
+  THRUST_HOST_DEVICE
+  pipeline_reduce_op(BinaryFunction binary_op) : binary_op(binary_op) {}
+
+  THRUST_EXEC_CHECK_DISABLE
+  THRUST_HOST_DEVICE
+  pipeline_element<T> operator()(const pipeline_element<T> &a, const pipeline_element<T> &b) const
+  {
+    if(!a.valid)
+      return b;
+
+    if(!b.valid)
+      return a;
+
+    return pipeline_element<T>(true, binary_op(a.value, b.value));
+  }
+};
+
+
+template<typename Function>
+struct pipeline_transformed
+{
+  Function f;
+};
+
+
+template<typename Predicate>
+struct pipeline_filtered
+{
+  Predicate pred;
+};
+
+
+template<typename T, typename BinaryFunction>
+struct pipeline_reduced
+{
+  T              init;
+  BinaryFunction binary_op;
+};
+
+
+struct pipeline_counted
+{
+};
+
+
+template<typename OutputIterator>
+struct pipeline_copied
+{
+  OutputIterator result;
+};
+
+
+template<typename Policy, typename Iterator, typename Stage>
+class pipeline_range
+{
+  public:
+    pipeline_range(const Policy &policy, Iterator first, Iterator last, Stage stage)
+      : m_policy(policy), m_first(first), m_last(last), m_stage(stage)
+    {}
+
+    Policy &policy() { return m_policy; }
+
+    Iterator begin() const { return m_first; }
+
+    Iterator end() const { return m_last; }
+
+    const Stage &stage() const { return m_stage; }
+
+  private:
+    Policy   m_policy;
+    Iterator m_first;
+    Iterator m_last;
+    Stage    m_stage;
+};
+
+
+template<typename Policy, typename Iterator, typename Stage, typename Function>
+  pipeline_range<Policy, Iterator, pipeline_transform_stage<Stage, Function>>
+    operator|(pipeline_range<Policy, Iterator, Stage> range, pipeline_transformed<Function> op)
+{
+  using NewStage = pipeline_transform_stage<Stage, Function>;
+
+  return pipeline_range<Policy, Iterator, NewStage>(range.policy(), range.begin(), range.end(), NewStage(range.stage(), op.f));
+}
+
+
+template<typename Policy, typename Iterator, typename Stage, typename Predicate>
+  pipeline_range<Policy, Iterator, pipeline_filter_stage<Stage, Predicate>>
+    operator|(pipeline_range<Policy, Iterator, Stage> range, pipeline_filtered<Predicate> op)
+{
+  using NewStage = pipeline_filter_stage<Stage, Predicate>;
+
+  return pipeline_range<Policy, Iterator, NewStage>(range.policy(), range.begin(), range.end(), NewStage(range.stage(), op.pred));
+}
+
+
+template<typename Policy, typename Iterator, typename Stage, typename T, typename BinaryFunction>
+  T operator|(pipeline_range<Policy, Iterator, Stage> range, pipeline_reduced<T, BinaryFunction> op)
+{
+  // every stage runs inside the unary function of a single transform_reduce
+  pipeline_element<T> result = thrust::transform_reduce(range.policy(),
+                                                        range.begin(),
+                                                        range.end(),
+                                                        pipeline_convert_stage<Stage, T>(range.stage()),
+                                                        pipeline_element<T>(),
+                                                        pipeline_reduce_op<T, BinaryFunction>(op.binary_op));
+
+  return result.valid ? op.binary_op(op.init, result.value) : op.init;
+}
+
+
+template<typename Policy, typename Iterator, typename Stage>
+  typename thrust::iterator_difference<Iterator>::type
+    operator|(pipeline_range<Policy, Iterator, Stage> range, pipeline_counted)
+{
+  using Size = typename thrust::iterator_difference<Iterator>::type;
+
+  return thrust::transform_reduce(range.policy(),
+                                  range.begin(),
+                                  range.end(),
+                                  pipeline_count_stage<Stage, Size>(range.stage()),
+                                  Size(0),
+                                  thrust::plus<Size>());
+}
+
+
+template<typename Policy, typename Iterator, typename Stage, typename OutputIterator>
+  OutputIterator operator|(pipeline_range<Policy, Iterator, Stage> range, pipeline_copied<OutputIterator> op)
+{
+  // a compaction cannot be fused into a single pass, so lower onto copy_if
+  // with the stages evaluated on the fly for both the values and the flags
+  auto values  = thrust::make_transform_iterator(range.begin(), pipeline_value_stage<Stage>(range.stage()));
+  auto stencil = thrust::make_transform_iterator(range.begin(), pipeline_valid_stage<Stage>(range.stage()));
+
+  return thrust::copy_if(range.policy(),
+                         values,
+                         values + thrust::distance(range.begin(), range.end()),
+                         stencil,
+                         op.result,
+                         thrust::identity<bool>());
+}
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy, typename InputIterator>
+  thrust::detail::pipeline_range<DerivedPolicy, InputIterator, thrust::detail::pipeline_identity_stage>
+    pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+             InputIterator first,
+             InputIterator last)
+{
+  using Range = thrust::detail::pipeline_range<DerivedPolicy, InputIterator, thrust::detail::pipeline_identity_stage>;
+
+  return Range(thrust::detail::derived_cast(exec), first, last, thrust::detail::pipeline_identity_stage());
+} // end pipeline()
+
+
+template<typename InputIterator>
+  thrust::detail::pipeline_range<typename thrust::iterator_system<InputIterator>::type,
+                                 InputIterator,
+                                 thrust::detail::pipeline_identity_stage>
+    pipeline(InputIterator first,
+             InputIterator last)
+{
+  using System = typename thrust::iterator_system<InputIterator>::type;
+  using Range  = thrust::detail::pipeline_range<System, InputIterator, thrust::detail::pipeline_identity_stage>;
+
+  return Range(System(), first, last, thrust::detail::pipeline_identity_stage());
+} // end pipeline()
+
+
+template<typename UnaryFunction>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_transformed<UnaryFunction> transformed(UnaryFunction op)
+{
+  return thrust::detail::pipeline_transformed<UnaryFunction>{op};
+} // end transformed()
+
+
+template<typename Predicate>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_filtered<Predicate> filtered(Predicate pred)
+{
+  return thrust::detail::pipeline_filtered<Predicate>{pred};
+} // end filtered()
+
+
+template<typename T, typename BinaryFunction>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_reduced<T, BinaryFunction> reduced(T init, BinaryFunction binary_op)
+{
+  return thrust::detail::pipeline_reduced<T, BinaryFunction>{init, binary_op};
+} // end reduced()
+
+
+template<typename T>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_reduced<T, thrust::plus<T>> reduced(T init)
+{
+  return thrust::reduced(init, thrust::plus<T>());
+} // end reduced()
+
+
+THRUST_HOST_DEVICE
+  inline thrust::detail::pipeline_counted counted()
+{
+  return thrust::detail::pipeline_counted();
+} // end counted()
+
+
+template<typename OutputIterator>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_copied<OutputIterator> copied(OutputIterator result)
+{
+  return thrust::detail::pipeline_copied<OutputIterator>{result};
+} // end copied()
+
+
+THRUST_NAMESPACE_END
+
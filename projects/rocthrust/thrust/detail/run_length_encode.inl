@@ -0,0 +1,155 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/adl/run_length_encode.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output)
+{
+  using thrust::system::detail::generic::run_length_encode;
+  return run_length_encode(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_output, counts_output);
+} // end run_length_encode()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::run_length_encode;
+  return run_length_encode(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_output, counts_output, binary_pred);
+} // end run_length_encode()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 run_length_decode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result)
+{
+  using thrust::system::detail::generic::run_length_decode;
+  return run_length_decode(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, values_last, counts_first, result);
+} // end run_length_decode()
+
+
+template<typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode(select_system(system1,system2,system3), first, last, values_output, counts_output);
+} // end run_length_encode()
+
+
+template<typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode(select_system(system1,system2,system3), first, last, values_output, counts_output, binary_pred);
+} // end run_length_encode()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 run_length_decode(RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_decode(select_system(system1,system2,system3), values_first, values_last, counts_first, result);
+} // end run_length_decode()
+
+
+THRUST_NAMESPACE_END
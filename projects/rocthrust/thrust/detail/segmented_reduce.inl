@@ -0,0 +1,226 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/adl/segmented_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, offsets_first, offsets_last, result);
+} // end segmented_reduce()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, offsets_first, offsets_last, result, init);
+} // end segmented_reduce()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, offsets_first, offsets_last, result, init, binary_op);
+} // end segmented_reduce()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_transform_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::segmented_transform_reduce;
+  return segmented_transform_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, offsets_first, offsets_last, result, unary_op, init, binary_op);
+} // end segmented_transform_reduce()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(select_system(system1,system2,system3), values_first, offsets_first, offsets_last, result);
+} // end segmented_reduce()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result,
+                     T init)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(select_system(system1,system2,system3), values_first, offsets_first, offsets_last, result, init);
+} // end segmented_reduce()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result,
+                     T init,
+                     BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(select_system(system1,system2,system3), values_first, offsets_first, offsets_last, result, init, binary_op);
+} // end segmented_reduce()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_transform_reduce(RandomAccessIterator1 values_first,
+                               RandomAccessIterator2 offsets_first,
+                               RandomAccessIterator2 offsets_last,
+                               OutputIterator result,
+                               UnaryFunction unary_op,
+                               T init,
+                               BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_transform_reduce(select_system(system1,system2,system3), values_first, offsets_first, offsets_last, result, unary_op, init, binary_op);
+} // end segmented_transform_reduce()
+
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,190 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/adl/segmented_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, offsets_first, offsets_last);
+} // end segmented_sort()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, offsets_first, offsets_last, comp);
+} // end segmented_sort()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, offsets_first, offsets_last);
+} // end segmented_sort_by_key()
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, offsets_first, offsets_last, comp);
+} // end segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void segmented_sort(RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort(select_system(system1,system2), keys_first, keys_last, offsets_first, offsets_last);
+} // end segmented_sort()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void segmented_sort(RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort(select_system(system1,system2), keys_first, keys_last, offsets_first, offsets_last, comp);
+} // end segmented_sort()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort_by_key(select_system(system1,system2,system3), keys_first, keys_last, values_first, offsets_first, offsets_last);
+} // end segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort_by_key(select_system(system1,system2,system3), keys_first, keys_last, values_first, offsets_first, offsets_last, comp);
+} // end segmented_sort_by_key()
+
+
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2020 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -23,6 +24,7 @@
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
 
 THRUST_NAMESPACE_BEGIN
 
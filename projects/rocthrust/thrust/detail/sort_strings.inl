@@ -0,0 +1,68 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/sort_strings.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/sort_strings.h>
+#include <thrust/system/detail/adl/sort_strings.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 sort_strings(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                     RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out)
+{
+  using thrust::system::detail::generic::sort_strings;
+  return sort_strings(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), chars_first, offsets_first, offsets_last, permutation_out);
+} // end sort_strings()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 sort_strings(RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::sort_strings(select_system(system1,system2,system3), chars_first, offsets_first, offsets_last, permutation_out);
+} // end sort_strings()
+
+
+THRUST_NAMESPACE_END
@@ -29,6 +29,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/detail/contiguous_storage.h>
 #include <thrust/sequence_access.h>
+#include <thrust/uninitialized_allocator.h>
 
 #include <initializer_list>
 #include <vector>
@@ -83,6 +84,21 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const Alloc &alloc);
 
+    /*! This constructor creates a vector_base with uninitialized elements,
+     *  if their type is trivially default constructible, and with
+     *  default-constructed elements otherwise.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, no_init_t);
+
+    /*! This constructor creates a vector_base with uninitialized elements,
+     *  if their type is trivially default constructible, and with
+     *  default-constructed elements otherwise.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     */
+    vector_base(size_type n, no_init_t, const Alloc &alloc);
+
     /*! This constructor creates a vector_base with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -219,6 +235,18 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are left uninitialized, if their type is
+     *  trivially default constructible, and default constructed otherwise.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     THRUST_HOST_DEVICE
@@ -516,6 +544,9 @@ template<typename T, typename Alloc>
 
     void default_init(size_type n);
 
+    // default constructs the elements only if that does anything
+    void no_init_init(size_type n);
+
     void fill_init(size_type n, const T &x);
 
     // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -526,8 +557,9 @@ template<typename T, typename Alloc>
     template<typename InputIteratorOrIntegralType>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-    // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    // this method appends n elements at the end, default-constructed unless
+    // construct is false, in which case they are left uninitialized
+    void append(size_type n, bool construct = true);
 
     // this method performs insertion from a fill value
     void fill_insert(iterator position, size_type n, const T &x);
@@ -536,6 +568,30 @@ template<typename T, typename Alloc>
     template<typename InputIterator>
       void copy_insert(iterator position, InputIterator first, InputIterator last);
 
+    // these methods insert into the existing storage by relocating the
+    // elements after position, if that can be done by copying their bytes,
+    // and return whether they did
+    template<typename ForwardIterator>
+      bool relocating_copy_insert(iterator position, ForwardIterator first, ForwardIterator last, size_type n, true_type);
+
+    template<typename ForwardIterator>
+      bool relocating_copy_insert(iterator position, ForwardIterator first, ForwardIterator last, size_type n, false_type);
+
+    bool relocating_fill_insert(iterator position, size_type n, const T &x, true_type);
+
+    bool relocating_fill_insert(iterator position, size_type n, const T &x, false_type);
+
+    // this method moves the elements into new storage, around the elements
+    // [new_position, new_last) already constructed there in place of the
+    // position of the old storage, and then adopts the new storage
+    void move_to_storage(storage_type &new_storage, iterator position, iterator new_position, iterator new_last);
+
+    // these methods erase by relocating the elements after the erased range
+    // if that can be done by copying their bytes, and by assignment otherwise
+    void erase_dispatch(iterator first, iterator last, true_type);
+
+    void erase_dispatch(iterator first, iterator last, false_type);
+
     // these methods resolve the ambiguity of the assign() template of form (InputIterator, InputIterator)
     template<typename InputIterator>
       void assign_dispatch(InputIterator first, InputIterator last, false_type);
@@ -29,6 +29,7 @@
 #include <thrust/detail/temporary_array.h>
 
 #include <stdexcept>
+#include <functional>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -71,6 +72,24 @@ template<typename T, typename Alloc>
   default_init(n);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  no_init_init(n);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  no_init_init(n);
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(size_type n, const value_type &value)
@@ -242,6 +261,22 @@ template<typename T, typename Alloc>
   } // end if
 } // end vector_base::default_init()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::no_init_init(size_type n)
+{
+  if(n > 0)
+  {
+    m_storage.allocate(n);
+    m_size = n;
+
+    if(!has_trivial_constructor<T>::value)
+    {
+      m_storage.default_construct_n(begin(), size());
+    } // end if
+  } // end if
+} // end vector_base::no_init_init()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::fill_init(size_type n, const T &x)
@@ -362,6 +397,22 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, no_init_t)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), !has_trivial_constructor<T>::value);
+  } // end else
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   THRUST_HOST_DEVICE
   typename vector_base<T,Alloc>::size_type
@@ -395,29 +446,9 @@ template<typename T, typename Alloc>
     // create new storage
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-    // record how many constructors we invoke in the try block below
-    iterator new_end = new_storage.begin();
-
-    try
-    {
-      // construct copy all elements into the newly allocated storage
-      new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
-    } // end try
-    catch(...)
-    {
-      // something went wrong, so destroy & deallocate the new storage
-      new_storage.destroy(new_storage.begin(), new_end);
-      new_storage.deallocate();
-
-      // rethrow
-      throw;
-    } // end catch
-
-    // call destructors on the elements in the old storage
-    m_storage.destroy(begin(), end());
-
-    // record the vector's new state
-    m_storage.swap(new_storage);
+    // move all elements into the newly allocated storage
+    iterator new_end = new_storage.begin() + size();
+    move_to_storage(new_storage, end(), new_end, new_end);
   } // end if
 } // end vector_base::reserve()
 
@@ -680,6 +711,31 @@ template<typename T, typename Alloc>
 template<typename T, typename Alloc>
   typename vector_base<T,Alloc>::iterator vector_base<T,Alloc>
     ::erase(iterator first, iterator last)
+{
+  erase_dispatch(first, last, typename storage_type::relocates_trivially());
+
+  // return an iterator pointing to the position of the first element
+  // following the erased range
+  return first;
+} // end vector_base::erase()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::erase_dispatch(iterator first, iterator last, true_type)
+{
+  // destroy the erased elements
+  m_storage.destroy(first, last);
+
+  // relocate the range [last,end()) to first
+  m_storage.relocate(last, end(), first);
+
+  // modify our size
+  m_size -= (last - first);
+} // end vector_base::erase_dispatch()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::erase_dispatch(iterator first, iterator last, false_type)
 {
   // overlap copy the range [last,end()) to first
   // XXX this copy only potentially overlaps
@@ -690,11 +746,7 @@ template<typename T, typename Alloc>
 
   // modify our size
   m_size -= (last - first);
-
-  // return an iterator pointing to the position of the first element
-  // following the erased range
-  return first;
-} // end vector_base::erase()
+} // end vector_base::erase_dispatch()
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
@@ -817,7 +869,11 @@ template<typename T, typename Alloc>
       const size_type num_displaced_elements = end() - position;
       iterator old_end = end();
 
-      if(num_displaced_elements > num_new_elements)
+      if(relocating_copy_insert(position, first, last, num_new_elements, typename storage_type::relocates_trivially()))
+      {
+        // done
+      } // end if
+      else if(num_displaced_elements > num_new_elements)
       {
         // construct copy n displaced elements to new elements
         // following the insertion
@@ -875,37 +931,30 @@ template<typename T, typename Alloc>
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
+      // the elements to insert are constructed first, so that nothing has
+      // been moved out of the old storage if that throws
+      iterator new_position = new_storage.begin() + (position - begin());
+
       // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      iterator new_last = new_position;
 
       try
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
         // construct copy elements to insert
-        new_end = m_storage.uninitialized_copy(first, last, new_end);
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        new_last = m_storage.uninitialized_copy(first, last, new_position);
       } // end try
       catch(...)
       {
         // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
+        new_storage.destroy(new_position, new_last);
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
-
-      // record the vector's new state
-      m_storage.swap(new_storage);
+      // move the elements before and after the insertion around them
+      move_to_storage(new_storage, position, new_position, new_last);
       m_size = old_size + num_new_elements;
     } // end else
   } // end if
@@ -913,7 +962,7 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::append(size_type n)
+    ::append(size_type n, bool construct)
 {
   if(n != 0)
   {
@@ -922,7 +971,10 @@ template<typename T, typename Alloc>
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      if(construct)
+      {
+        m_storage.default_construct_n(end(), n);
+      } // end if
 
       // extend the size
       m_size += n;
@@ -943,33 +995,29 @@ template<typename T, typename Alloc>
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      // the new elements are constructed first, so that nothing has been
+      // moved out of the old storage if that throws
+      iterator new_position = new_storage.begin() + old_size;
 
       try
       {
-        // construct copy all elements into the newly allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
-
         // construct new elements to insert
-        new_storage.default_construct_n(new_end, n);
-        new_end += n;
+        if(construct)
+        {
+          new_storage.default_construct_n(new_position, n);
+        } // end if
       } // end try
       catch(...)
       {
-        // something went wrong, so destroy & deallocate the new storage
-        new_storage.destroy(new_storage.begin(), new_end);
+        // something went wrong, so deallocate the new storage
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
-
-      // record the vector's new state
-      m_storage.swap(new_storage);
+      // move all elements in front of them
+      move_to_storage(new_storage, end(), new_position, new_position + n);
       m_size    = old_size + n;
     } // end else
   } // end if
@@ -988,7 +1036,11 @@ template<typename T, typename Alloc>
       const size_type num_displaced_elements = end() - position;
       iterator old_end = end();
 
-      if(num_displaced_elements > n)
+      if(relocating_fill_insert(position, n, x, typename storage_type::relocates_trivially()))
+      {
+        // done
+      } // end if
+      else if(num_displaced_elements > n)
       {
         // construct copy n displaced elements to new elements
         // following the insertion
@@ -1043,43 +1095,154 @@ template<typename T, typename Alloc>
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
+      // the elements to insert are constructed first, so that nothing has
+      // been moved out of the old storage if that throws, and x is still
+      // valid if it refers to an element of this vector
+      iterator new_position = new_storage.begin() + (position - begin());
 
       try
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
         // construct new elements to insert
-        m_storage.uninitialized_fill_n(new_end, n, x);
-        new_end += n;
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        m_storage.uninitialized_fill_n(new_position, n, x);
       } // end try
       catch(...)
       {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
+        // something went wrong, so deallocate the new storage
         new_storage.deallocate();
 
         // rethrow
         throw;
       } // end catch
 
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
-
-      // record the vector's new state
-      m_storage.swap(new_storage);
+      // move the elements before and after the insertion around them
+      move_to_storage(new_storage, position, new_position, new_position + n);
       m_size    = old_size + n;
     } // end else
   } // end if
 } // end vector_base::fill_insert()
 
+template<typename T, typename Alloc>
+  template<typename ForwardIterator>
+    bool vector_base<T,Alloc>
+      ::relocating_copy_insert(iterator position,
+                               ForwardIterator first,
+                               ForwardIterator last,
+                               size_type n,
+                               true_type)
+{
+  iterator old_end = end();
+
+  // open a gap of n elements at position
+  m_storage.relocate(position, old_end, position + n);
+
+  try
+  {
+    // construct copy the range into the gap
+    m_storage.uninitialized_copy(first, last, position);
+  } // end try
+  catch(...)
+  {
+    // something went wrong, so close the gap again
+    m_storage.relocate(position + n, old_end + n, position);
+
+    // rethrow
+    throw;
+  } // end catch
+
+  m_size += n;
+
+  return true;
+} // end vector_base::relocating_copy_insert()
+
+template<typename T, typename Alloc>
+  template<typename ForwardIterator>
+    bool vector_base<T,Alloc>
+      ::relocating_copy_insert(iterator, ForwardIterator, ForwardIterator, size_type, false_type)
+{
+  return false;
+} // end vector_base::relocating_copy_insert()
+
+template<typename T, typename Alloc>
+  bool vector_base<T,Alloc>
+    ::relocating_fill_insert(iterator position, size_type n, const T &x, true_type)
+{
+  iterator old_end = end();
+
+  // x moves along with the displaced elements if it is one of them
+  const T *value = &x;
+  if(!std::less<const T *>()(value, position.base()) && std::less<const T *>()(value, old_end.base()))
+  {
+    value += n;
+  } // end if
+
+  // open a gap of n elements at position
+  m_storage.relocate(position, old_end, position + n);
+
+  try
+  {
+    // construct the new elements in the gap
+    m_storage.uninitialized_fill_n(position, n, *value);
+  } // end try
+  catch(...)
+  {
+    // something went wrong, so close the gap again
+    m_storage.relocate(position + n, old_end + n, position);
+
+    // rethrow
+    throw;
+  } // end catch
+
+  m_size += n;
+
+  return true;
+} // end vector_base::relocating_fill_insert()
+
+template<typename T, typename Alloc>
+  bool vector_base<T,Alloc>
+    ::relocating_fill_insert(iterator, size_type, const T &, false_type)
+{
+  return false;
+} // end vector_base::relocating_fill_insert()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::move_to_storage(storage_type &new_storage, iterator position, iterator new_position, iterator new_last)
+{
+  try
+  {
+    // move the elements before position to the beginning of the new storage
+    m_storage.uninitialized_move(begin(), position, new_storage.begin());
+
+    try
+    {
+      // move the displaced elements after the ones already constructed
+      // remember [position, end()) refers to the old storage
+      m_storage.uninitialized_move(position, end(), new_last);
+    } // end try
+    catch(...)
+    {
+      new_storage.destroy_moved(new_storage.begin(), new_position);
+
+      throw;
+    } // end catch
+  } // end try
+  catch(...)
+  {
+    // something went wrong, so destroy & deallocate the new storage
+    new_storage.destroy(new_position, new_last);
+    new_storage.deallocate();
+
+    // rethrow
+    throw;
+  } // end catch
+
+  // end the lifetime of the elements in the old storage
+  m_storage.destroy_moved(begin(), end());
+
+  // record the vector's new state
+  m_storage.swap(new_storage);
+} // end vector_base::move_to_storage()
+
 template<typename T, typename Alloc>
   template<typename InputIterator>
     void vector_base<T,Alloc>
@@ -0,0 +1,698 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file hash_reduce_by_key.h
+ *  \brief Functions for reducing the values of unsorted keys
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c equal_to to test keys for
+ *  equality, \c plus to reduce values with equal keys and a hash of the object representation of
+ *  the keys, so the key type shall be an arithmetic, enumeration or pointer type.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(thrust::host, A, A + N, B, C, D);
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c plus to reduce values with equal keys and a hash of the object representation of
+ *  the keys, so the key type shall be an arithmetic, enumeration or pointer type, and keys equal
+ *  under \c binary_pred shall have the same object representation.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(thrust::host, A, A + N, B, C, D, thrust::equal_to<int>());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c binary_op to reduce values with equal keys and a hash of the object representation
+ *  of the keys, so the key type shall be an arithmetic, enumeration or pointer type, and keys equal
+ *  under \c binary_pred shall have the same object representation.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(thrust::host, A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c binary_op to reduce values with equal keys and the function object \c hash to hash
+ *  the keys.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \param hash The function object used to hash keys.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam Hash is a function object which takes \p InputIterator1's \c value_type and returns a value
+ *          convertible to \c std::uint64_t, and which returns the same value for keys equal under \c binary_pred.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  struct int_hash
+ *  {
+ *    __host__ __device__
+ *    unsigned long long operator()(int x) const
+ *    {
+ *      return static_cast<unsigned int>(x);
+ *    }
+ *  };
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(thrust::host, A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>(), int_hash());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       Hash hash);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c equal_to to test keys for
+ *  equality, \c plus to reduce values with equal keys and a hash of the object representation of
+ *  the keys, so the key type shall be an arithmetic, enumeration or pointer type.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs.
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(A, A + N, B, C, D);
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c plus to reduce values with equal keys and a hash of the object representation of
+ *  the keys, so the key type shall be an arithmetic, enumeration or pointer type, and keys equal
+ *  under \c binary_pred shall have the same object representation.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs.
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(A, A + N, B, C, D, thrust::equal_to<int>());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c binary_op to reduce values with equal keys and a hash of the object representation
+ *  of the keys, so the key type shall be an arithmetic, enumeration or pointer type, and keys equal
+ *  under \c binary_pred shall have the same object representation.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs.
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op);
+
+
+/*! \p hash_reduce_by_key is a generalization of \p reduce to key-value pairs whose keys are
+ *  not sorted. For each group of keys in the range <tt>[keys_first, keys_last)</tt> that are equal,
+ *  wherever they occur, \p hash_reduce_by_key copies one element of the group to \c keys_output and
+ *  reduces the corresponding values to a single value copied to \c values_output. Unlike
+ *  \p reduce_by_key, the keys don't need to be sorted, so aggregating unsorted keys doesn't take a
+ *  \p sort_by_key first. The groups are written in an unspecified order, and the values of a group
+ *  are reduced in an unspecified order, so \c binary_op shall be associative and commutative.
+ *
+ *  This version of \p hash_reduce_by_key uses the function object \c binary_pred to test keys for
+ *  equality, \c binary_op to reduce values with equal keys and the function object \c hash to hash
+ *  the keys.
+ *
+ *  The CPP system aggregates the keys in a single open addressing hash table. The OpenMP and TBB
+ *  systems aggregate every thread's share of the input in a hash table of its own, then merge the
+ *  tables in parallel, every thread merging the keys whose hashes fall in one partition of the hash
+ *  space, so that inputs with many distinct keys are merged without synchronization. Other systems
+ *  sort the hashes of the keys and reduce the keys with equal hashes.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \param hash The function object used to hash keys.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output, values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam Hash is a function object which takes \p InputIterator1's \c value_type and returns a value
+ *          convertible to \c std::uint64_t, and which returns the same value for keys equal under \c binary_pred.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p hash_reduce_by_key to
+ *  sum the values of every distinct key of an unsorted sequence of key/value pairs.
+ *
+ *  \code
+ *  #include <thrust/hash_reduce_by_key.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  struct int_hash
+ *  {
+ *    __host__ __device__
+ *    unsigned long long operator()(int x) const
+ *    {
+ *      return static_cast<unsigned int>(x);
+ *    }
+ *  };
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::hash_reduce_by_key(A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>(), int_hash());
+ *
+ *  // new_end.first - C is 3, the first three keys in C are {1, 3, 2} in some order,
+ *  // and the first three values in D are the sums {12, 21, 9} in the same order.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       Hash hash);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/hash_reduce_by_key.inl>
@@ -0,0 +1,240 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file histogram.h
+ *  \brief Counts the samples of a range falling into each of a set of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt> falling into each
+ *  of <tt>num_levels - 1</tt> bins of equal width which evenly divide <tt>[lower_level, upper_level)</tt>.
+ *  The count of bin \c i is written to <tt>*(histogram + i)</tt>; samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  On the host systems the samples are counted in a single pass over the input. Up to a
+ *  threshold number of bins, every thread counts into a private copy of the histogram and the
+ *  copies are summed at the end; larger histograms are counted into a shared copy with atomic
+ *  increments.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output sequence of <tt>num_levels - 1</tt> counts.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower sample value bound (inclusive) of the lowest bin.
+ *  \param upper_level The upper sample value bound (exclusive) of the highest bin.
+ *  \return The end of the output sequence, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to \p LevelType.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and integers are convertible to \c RandomAccessIterator's \c value_type.
+ *  \tparam LevelType is an arithmetic type.
+ *
+ *  \pre \p num_levels shall be at least \c 2, and \p lower_level shall be less than \p upper_level.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count samples into
+ *  four bins using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[8] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.0f};
+ *  int   counts[4];
+ *
+ *  // bins [0, 2), [2, 4), [4, 6) and [6, 8)
+ *  thrust::histogram_even(thrust::host, samples, samples + 8, counts, 5, 0.0f, 8.0f);
+ *
+ *  // counts is now {1, 5, 0, 2}
+ *  \endcode
+ *
+ *  \see histogram_range
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+THRUST_HOST_DEVICE
+  RandomAccessIterator histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level);
+
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt> falling into each
+ *  of <tt>num_levels - 1</tt> bins of equal width which evenly divide <tt>[lower_level, upper_level)</tt>.
+ *  The count of bin \c i is written to <tt>*(histogram + i)</tt>; samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output sequence of <tt>num_levels - 1</tt> counts.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower sample value bound (inclusive) of the lowest bin.
+ *  \param upper_level The upper sample value bound (exclusive) of the highest bin.
+ *  \return The end of the output sequence, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to \p LevelType.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and integers are convertible to \c RandomAccessIterator's \c value_type.
+ *  \tparam LevelType is an arithmetic type.
+ *
+ *  \pre \p num_levels shall be at least \c 2, and \p lower_level shall be less than \p upper_level.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<float> latencies = ...;
+ *  thrust::device_vector<unsigned int> counts(100);
+ *
+ *  // 100 bins of 10 microseconds each
+ *  thrust::histogram_even(latencies.begin(), latencies.end(), counts.begin(), 101, 0.0f, 1000.0f);
+ *  \endcode
+ *
+ *  \see histogram_range
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+  RandomAccessIterator histogram_even(InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level);
+
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt> falling into each
+ *  of the bins delimited by the sorted sequence of boundaries <tt>[levels_first, levels_last)</tt>.
+ *  Bin \c i is the half-open interval <tt>[levels_first[i], levels_first[i + 1])</tt> and its count
+ *  is written to <tt>*(histogram + i)</tt>; samples outside of all the bins are not counted.
+ *
+ *  On the host systems the samples are counted in a single pass over the input, with the
+ *  same privatization of the bins as \p histogram_even.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output sequence of <tt>(levels_last - levels_first) - 1</tt> counts.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to \c RandomAccessIterator2's \c value_type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and integers are convertible to \c RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator2's \c value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order and contain at least two boundaries.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count samples into
+ *  bins of varying width using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int samples[8] = {1, 7, 12, 3, 40, 100, 5, 18};
+ *  int levels[4]  = {0, 5, 20, 50};
+ *  int counts[3];
+ *
+ *  // bins [0, 5), [5, 20) and [20, 50)
+ *  thrust::histogram_range(thrust::host, samples, samples + 8, counts, levels, levels + 4);
+ *
+ *  // counts is now {2, 4, 1}
+ *  \endcode
+ *
+ *  \see histogram_even
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator1 histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last);
+
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt> falling into each
+ *  of the bins delimited by the sorted sequence of boundaries <tt>[levels_first, levels_last)</tt>.
+ *  Bin \c i is the half-open interval <tt>[levels_first[i], levels_first[i + 1])</tt> and its count
+ *  is written to <tt>*(histogram + i)</tt>; samples outside of all the bins are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output sequence of <tt>(levels_last - levels_first) - 1</tt> counts.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to \c RandomAccessIterator2's \c value_type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and integers are convertible to \c RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator2's \c value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order and contain at least two boundaries.
+ *
+ *  \see histogram_even
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator1 histogram_range(InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
+
@@ -0,0 +1,135 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file mapped_vector.h
+ *  \brief A host vector whose elements live in memory mapped files.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/mmap.h>
+#include <thrust/uninitialized_allocator.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup allocators Allocators
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! \brief An allocator which allocates memory from a \p thrust::mr::mmap_resource.
+ *         A default constructed \p mapped_allocator uses the global instance of
+ *         \p mmap_resource, which backs allocations with anonymous memory files;
+ *         one constructed from the address of a resource allocates from it.
+ *
+ *  \tparam T the type that will be allocated by this allocator.
+ *
+ *  \see mapped_vector
+ */
+template <typename T>
+class mapped_allocator : public thrust::mr::allocator<T, thrust::mr::mmap_resource>
+{
+  using base = thrust::mr::allocator<T, thrust::mr::mmap_resource>;
+
+public:
+  /*! The \p rebind metafunction provides the type of a \p mapped_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U the other type to use for instantiation.
+   */
+  template <typename U>
+  struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p mapped_allocator.
+     */
+    using other = mapped_allocator<U>;
+  };
+
+  /*! Default constructor. Allocates from the global instance of
+   *  \p mmap_resource.
+   */
+  THRUST_HOST
+  mapped_allocator()
+    : base(thrust::mr::get_global_resource<thrust::mr::mmap_resource>())
+  {}
+
+  /*! Constructor.
+   *
+   *  \param resource the resource to allocate memory from.
+   */
+  THRUST_HOST
+  mapped_allocator(thrust::mr::mmap_resource *resource)
+    : base(resource)
+  {}
+
+  /*! Copy constructor. Copies the resource pointer. */
+  THRUST_HOST
+  mapped_allocator(const mapped_allocator &other)
+    : base(other)
+  {}
+
+  /*! Conversion constructor from an allocator of a different type. Copies the
+   *  resource pointer.
+   */
+  template <typename U>
+  THRUST_HOST
+  mapped_allocator(const mapped_allocator<U> &other)
+    : base(other)
+  {}
+
+  /*! Default copy assignment operator. */
+  mapped_allocator &operator=(const mapped_allocator &) = default;
+};
+
+/*! \} // allocators
+ */
+
+/*! \addtogroup container_classes Container Classes
+ *  \addtogroup host_containers Host Containers
+ *  \ingroup container_classes
+ *  \{
+ */
+
+/*! A \p host_vector whose elements live in memory mapped files of a
+ *  \p thrust::mr::mmap_resource, so that it can hold more data than fits in
+ *  memory, or the contents of a file without reading it. It can be used with
+ *  the algorithms of every host system.
+ *
+ *  \code
+ *  #include <thrust/mapped_vector.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  // the data of an existing file, read as the elements are accessed
+ *  thrust::mr::mmap_resource column("keys.bin");
+ *  thrust::mapped_vector<int> keys(column.file_size() / sizeof(int), thrust::no_init, &column);
+ *
+ *  // sorted in place, and written back to the file
+ *  thrust::sort(thrust::omp::par, keys.begin(), keys.end());
+ *  \endcode
+ *
+ *  \see mapped_allocator
+ *  \see thrust::mr::mmap_resource
+ */
+template <typename T>
+using mapped_vector = host_vector<T, mapped_allocator<T>>;
+
+/*! \}
+ */
+
+THRUST_NAMESPACE_END
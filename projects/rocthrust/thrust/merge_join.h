@@ -0,0 +1,939 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file merge_join.h
+ *  \brief Functions for joining sorted ranges of keys
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup merging
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p merge_join joins two sorted ranges of keys on their equivalent keys, like the inner
+ *  join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt> and
+ *  an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of the
+ *  first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output. The pairs are written in ascending order of the position in the first range, then
+ *  of the position in the second range, so a key occurring \c m times in the first range and \c n
+ *  times in the second range produces <tt>m * n</tt> pairs.
+ *
+ *  This version of \p merge_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1, index2);
+ *
+ *  // index1 is now {1, 1, 2, 2, 4} and index2 is now {0, 1, 0, 1, 3}:
+ *  // the 3s of keys1 are each joined with both 3s of keys2, and the 7 with the 7.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_left_outer_join
+ *  \see \p merge_semi_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output);
+
+
+/*! \p merge_join joins two sorted ranges of keys on their equivalent keys, like the inner
+ *  join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt> and
+ *  an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of the
+ *  first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output. The pairs are written in ascending order of the position in the first range, then
+ *  of the position in the second range, so a key occurring \c m times in the first range and \c n
+ *  times in the second range produces <tt>m * n</tt> pairs.
+ *
+ *  This version of \p merge_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \param comp Comparison operator.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1, index2, thrust::less<int>());
+ *
+ *  // index1 is now {1, 1, 2, 2, 4} and index2 is now {0, 1, 0, 1, 3}:
+ *  // the 3s of keys1 are each joined with both 3s of keys2, and the 7 with the 7.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_left_outer_join
+ *  \see \p merge_semi_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp);
+
+
+/*! \p merge_join joins two sorted ranges of keys on their equivalent keys, like the inner
+ *  join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt> and
+ *  an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of the
+ *  first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output. The pairs are written in ascending order of the position in the first range, then
+ *  of the position in the second range, so a key occurring \c m times in the first range and \c n
+ *  times in the second range produces <tt>m * n</tt> pairs.
+ *
+ *  This version of \p merge_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_join(keys1, keys1 + 5, keys2, keys2 + 4, index1, index2);
+ *
+ *  // index1 is now {1, 1, 2, 2, 4} and index2 is now {0, 1, 0, 1, 3}:
+ *  // the 3s of keys1 are each joined with both 3s of keys2, and the 7 with the 7.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_left_outer_join
+ *  \see \p merge_semi_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output);
+
+
+/*! \p merge_join joins two sorted ranges of keys on their equivalent keys, like the inner
+ *  join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt> and
+ *  an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of the
+ *  first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output. The pairs are written in ascending order of the position in the first range, then
+ *  of the position in the second range, so a key occurring \c m times in the first range and \c n
+ *  times in the second range produces <tt>m * n</tt> pairs.
+ *
+ *  This version of \p merge_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \param comp Comparison operator.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_join(keys1, keys1 + 5, keys2, keys2 + 4, index1, index2, thrust::less<int>());
+ *
+ *  // index1 is now {1, 1, 2, 2, 4} and index2 is now {0, 1, 0, 1, 3}:
+ *  // the 3s of keys1 are each joined with both 3s of keys2, and the 7 with the 7.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_left_outer_join
+ *  \see \p merge_semi_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp);
+
+
+/*! \p merge_left_outer_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  left outer join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt>
+ *  and an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of
+ *  the first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output, and for every element of the first range without an equivalent element in the
+ *  second range, it writes its position to \p index1_output and \c -1 to \p index2_output. The pairs
+ *  are written in ascending order of the position in the first range, then of the position in the
+ *  second range.
+ *
+ *  This version of \p merge_left_outer_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_left_outer_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_left_outer_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1, index2);
+ *
+ *  // index1 is now {0, 1, 1, 2, 2, 3, 4} and index2 is now {-1, 0, 1, 0, 1, -1, 3}:
+ *  // 1 and 5 have no match in keys2.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_semi_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output);
+
+
+/*! \p merge_left_outer_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  left outer join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt>
+ *  and an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of
+ *  the first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output, and for every element of the first range without an equivalent element in the
+ *  second range, it writes its position to \p index1_output and \c -1 to \p index2_output. The pairs
+ *  are written in ascending order of the position in the first range, then of the position in the
+ *  second range.
+ *
+ *  This version of \p merge_left_outer_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \param comp Comparison operator.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_left_outer_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_left_outer_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1, index2, thrust::less<int>());
+ *
+ *  // index1 is now {0, 1, 1, 2, 2, 3, 4} and index2 is now {-1, 0, 1, 0, 1, -1, 3}:
+ *  // 1 and 5 have no match in keys2.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_semi_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp);
+
+
+/*! \p merge_left_outer_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  left outer join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt>
+ *  and an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of
+ *  the first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output, and for every element of the first range without an equivalent element in the
+ *  second range, it writes its position to \p index1_output and \c -1 to \p index2_output. The pairs
+ *  are written in ascending order of the position in the first range, then of the position in the
+ *  second range.
+ *
+ *  This version of \p merge_left_outer_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_left_outer_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_left_outer_join(keys1, keys1 + 5, keys2, keys2 + 4, index1, index2);
+ *
+ *  // index1 is now {0, 1, 1, 2, 2, 3, 4} and index2 is now {-1, 0, 1, 0, 1, -1, 3}:
+ *  // 1 and 5 have no match in keys2.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_semi_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output);
+
+
+/*! \p merge_left_outer_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  left outer join of two sorted key columns: for every pair of an element of <tt>[keys1_first, keys1_last)</tt>
+ *  and an element of <tt>[keys2_first, keys2_last)</tt> which are equivalent, it writes the position of
+ *  the first in its range to \p index1_output and the position of the second in its range to
+ *  \p index2_output, and for every element of the first range without an equivalent element in the
+ *  second range, it writes its position to \p index1_output and \c -1 to \p index2_output. The pairs
+ *  are written in ascending order of the position in the first range, then of the position in the
+ *  second range.
+ *
+ *  This version of \p merge_left_outer_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param index2_output The beginning of the output sequence of positions in the second range.
+ *  \param comp Comparison operator.
+ *  \return A pair of iterators at the ends of the output sequences.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator2's \c difference_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_left_outer_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[7];
+ *  int index2[7];
+ *
+ *  thrust::pair<int*,int*> end =
+ *    thrust::merge_left_outer_join(keys1, keys1 + 5, keys2, keys2 + 4, index1, index2, thrust::less<int>());
+ *
+ *  // index1 is now {0, 1, 1, 2, 2, 3, 4} and index2 is now {-1, 0, 1, 0, 1, -1, 3}:
+ *  // 1 and 5 have no match in keys2.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_semi_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp);
+
+
+/*! \p merge_semi_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  semi join of two sorted key columns: it writes the position of every element of
+ *  <tt>[keys1_first, keys1_last)</tt> which has at least one equivalent element in
+ *  <tt>[keys2_first, keys2_last)</tt> to \p index1_output, once, in ascending order.
+ *
+ *  This version of \p merge_semi_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_semi_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[5];
+ *
+ *  int *end = thrust::merge_semi_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1);
+ *
+ *  // index1 is now {1, 2, 4}.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_left_outer_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output);
+
+
+/*! \p merge_semi_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  semi join of two sorted key columns: it writes the position of every element of
+ *  <tt>[keys1_first, keys1_last)</tt> which has at least one equivalent element in
+ *  <tt>[keys2_first, keys2_last)</tt> to \p index1_output, once, in ascending order.
+ *
+ *  This version of \p merge_semi_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param comp Comparison operator.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_semi_join to join two columns of keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[5];
+ *
+ *  int *end = thrust::merge_semi_join(thrust::host, keys1, keys1 + 5, keys2, keys2 + 4, index1, thrust::less<int>());
+ *
+ *  // index1 is now {1, 2, 4}.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_left_outer_join
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp);
+
+
+/*! \p merge_semi_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  semi join of two sorted key columns: it writes the position of every element of
+ *  <tt>[keys1_first, keys1_last)</tt> which has at least one equivalent element in
+ *  <tt>[keys2_first, keys2_last)</tt> to \p index1_output, once, in ascending order.
+ *
+ *  This version of \p merge_semi_join compares keys with \c operator<.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>
+ *          with \c InputIterator2's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_semi_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[5];
+ *
+ *  int *end = thrust::merge_semi_join(keys1, keys1 + 5, keys2, keys2 + 4, index1);
+ *
+ *  // index1 is now {1, 2, 4}.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_left_outer_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+  OutputIterator1 merge_semi_join(InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output);
+
+
+/*! \p merge_semi_join joins two sorted ranges of keys on their equivalent keys, like the
+ *  semi join of two sorted key columns: it writes the position of every element of
+ *  <tt>[keys1_first, keys1_last)</tt> which has at least one equivalent element in
+ *  <tt>[keys2_first, keys2_last)</tt> to \p index1_output, once, in ascending order.
+ *
+ *  This version of \p merge_semi_join compares keys with the function object \p comp.
+ *
+ *  This does the work of a \p lower_bound and an \p upper_bound per key, a scan of the numbers of
+ *  matches and an expansion of the matches in a single call. The CPP system joins the ranges in a single
+ *  merge pass. The OpenMP and TBB systems split the two ranges into chunks of equal size along the
+ *  merge path, moving every split to a key boundary so that equivalent keys stay in one chunk, then
+ *  count the output of every chunk and write the chunks in parallel at their offsets.
+ *
+ *  \param keys1_first The beginning of the first sorted range of keys.
+ *  \param keys1_last The end of the first sorted range of keys.
+ *  \param keys2_first The beginning of the second sorted range of keys.
+ *  \param keys2_last The end of the second sorted range of keys.
+ *  \param index1_output The beginning of the output sequence of positions in the first range.
+ *  \param comp Comparison operator.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator1's \c value_type is convertible to \p StrictWeakCompare's first argument type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c InputIterator2's \c value_type is convertible to \p StrictWeakCompare's second argument type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c InputIterator1's \c difference_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[keys1_first, keys1_last)</tt> and <tt>[keys2_first, keys2_last)</tt> shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_semi_join to join two columns of keys:
+ *
+ *  \code
+ *  #include <thrust/merge_join.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys1[5] = {1, 3, 3, 5, 7};
+ *  int keys2[4] = {3, 3, 4, 7};
+ *
+ *  int index1[5];
+ *
+ *  int *end = thrust::merge_semi_join(keys1, keys1 + 5, keys2, keys2 + 4, index1, thrust::less<int>());
+ *
+ *  // index1 is now {1, 2, 4}.
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p merge_join
+ *  \see \p merge_left_outer_join
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+  OutputIterator1 merge_semi_join(InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp);
+
+
+/*! \} // end merging
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/merge_join.inl>
@@ -0,0 +1,357 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource adaptor which caches freed blocks by size class,
+ *  so that memory allocated repeatedly in the same sizes is reused instead of
+ *  being obtained from the upstream resource again.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <thrust/detail/integer_math.h>
+
+// included so that the address of the resource can be passed to execution policies
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A type used for configuring \p caching_resource.
+ */
+struct caching_options
+{
+    /*! The size of the smallest blocks. All allocation requests below this size will be rounded up to this size.
+     */
+    std::size_t smallest_block_size;
+
+    /*! The alignment of all blocks. All allocation requests above this alignment are passed to the upstream resource
+     *      directly.
+     */
+    std::size_t alignment;
+
+    /*! The maximal number of bytes in the cached free blocks. Blocks deallocated while the cache is full are returned to
+     *      the upstream resource.
+     */
+    std::size_t max_cached_bytes;
+
+    /*! Checks if the options are self-consistent.
+     *
+     *  \returns true if the options are self-consistent, false otherwise.
+     */
+    bool validate() const
+    {
+        if (!detail::is_power_of_2(smallest_block_size)) return false;
+        if (!detail::is_power_of_2(alignment)) return false;
+
+        if (smallest_block_size < 4) return false;
+
+        return true;
+    }
+};
+
+/*! A memory resource adaptor which keeps the blocks deallocated through it in a cache, binned by size class, and serves
+ *      later allocations of the same size class from the cache instead of the upstream resource. Requests are rounded
+ *      up to one of four size classes per power of two, which wastes at most a quarter of a block.
+ *
+ *  The resource is meant for the temporary storage of algorithms, which are often called repeatedly with the same
+ *      sizes, for example in every iteration of an iterative solver: after the first iteration, all temporary storage
+ *      is served from the cache. Unlike a pool, it never splits or merges blocks, so it suits allocations of any size.
+ *      The cached bytes are bounded by \p caching_options::max_cached_bytes, and can be returned to the upstream
+ *      resource explicitly with \p trim.
+ *
+ *  \code
+ *  thrust::mr::caching_resource<thrust::mr::new_delete_resource> cache;
+ *
+ *  for (int i = 0; i < iterations; ++i)
+ *  {
+ *      thrust::sort(thrust::omp::par(&cache), keys.begin(), keys.end());
+ *  }
+ *  cache.trim();
+ *  \endcode
+ *
+ *  The host execution policies provide an instance per system through \p with_cached_temporaries, as in
+ *      <tt>thrust::omp::par.with_cached_temporaries()</tt>.
+ *
+ *  The resource is thread-safe if its upstream resource is; the cache is protected by a mutex, which is not held while
+ *      the upstream resource is called. It never accesses the memory it caches.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template<typename Upstream>
+class caching_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+public:
+    /*! Get the default options for the resource. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static caching_options get_default_options()
+    {
+        caching_options ret;
+
+        ret.smallest_block_size = 256;
+        ret.alignment = 64;
+
+        ret.max_cached_bytes = static_cast<std::size_t>(1) << 28;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param options options to use
+     */
+    caching_resource(Upstream * upstream, caching_options options = get_default_options())
+        : m_upstream(upstream),
+        m_options(options),
+        m_smallest_block_log2(detail::log2(m_options.smallest_block_size)),
+        m_mutex(),
+        m_bins((sizeof(std::size_t) * 8 - m_smallest_block_log2) * 4 + 1),
+        m_cached_bytes(0)
+    {
+        assert(m_options.validate());
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options options to use
+     */
+    caching_resource(caching_options options = get_default_options())
+        : caching_resource(get_global_resource<Upstream>(), options)
+    {
+    }
+
+    /*! Destructor. Returns all cached blocks to upstream.
+     */
+    ~caching_resource()
+    {
+        release();
+    }
+
+private:
+    using void_ptr = typename Upstream::pointer;
+
+    Upstream * m_upstream;
+
+    caching_options m_options;
+    std::size_t m_smallest_block_log2;
+
+    mutable std::mutex m_mutex;
+
+    // the free blocks of every size class
+    std::vector<std::vector<void_ptr>> m_bins;
+    std::size_t m_cached_bytes;
+
+    // returns the index of the size class of a request, and stores the size
+    // of its blocks in block_size; above the smallest block size, there are
+    // four size classes per power of two
+    std::size_t size_class(std::size_t bytes, std::size_t & block_size) const
+    {
+        if (bytes <= m_options.smallest_block_size)
+        {
+            block_size = m_options.smallest_block_size;
+            return 0;
+        }
+
+        // 2^exponent < bytes <= 2^(exponent + 1)
+        std::size_t exponent = detail::log2(bytes - 1);
+        std::size_t quarter = exponent - 2;
+        std::size_t quarters = (bytes - 1) >> quarter;
+
+        block_size = (quarters + 1) << quarter;
+        return (exponent - m_smallest_block_log2) * 4 + quarters - 3;
+    }
+
+    // returns cached blocks to upstream, largest first, until at most
+    // max_bytes remain cached
+    void trim_locked(std::unique_lock<std::mutex> & lock, std::size_t max_bytes)
+    {
+        std::vector<std::pair<void_ptr, std::size_t>> freed;
+
+        for (std::size_t i = m_bins.size(); i > 0 && m_cached_bytes > max_bytes; --i)
+        {
+            std::vector<void_ptr> & bin = m_bins[i - 1];
+            if (bin.empty())
+            {
+                continue;
+            }
+
+            std::size_t block_size = block_size_of(i - 1);
+            while (!bin.empty() && m_cached_bytes > max_bytes)
+            {
+                freed.push_back(std::make_pair(bin.back(), block_size));
+                bin.pop_back();
+                m_cached_bytes -= block_size;
+            }
+        }
+
+        lock.unlock();
+
+        for (std::size_t i = 0; i < freed.size(); ++i)
+        {
+            m_upstream->do_deallocate(freed[i].first, freed[i].second, m_options.alignment);
+        }
+    }
+
+    std::size_t block_size_of(std::size_t index) const
+    {
+        if (index == 0)
+        {
+            return m_options.smallest_block_size;
+        }
+
+        std::size_t exponent = (index - 1) / 4 + m_smallest_block_log2;
+        std::size_t quarters = (index - 1) % 4 + 4;
+        return (quarters + 1) << (exponent - 2);
+    }
+
+public:
+    /*! Returns cached blocks to the upstream resource until at most \p max_bytes remain cached. The largest blocks are
+     *      returned first.
+     *
+     *  \param max_bytes the number of bytes that may remain cached
+     */
+    void trim(std::size_t max_bytes = 0)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        trim_locked(lock, max_bytes);
+    }
+
+    /*! Returns all cached blocks to the upstream resource.
+     */
+    void release()
+    {
+        trim(0);
+    }
+
+    /*! Changes the maximal number of cached bytes, and returns cached blocks to the upstream resource until at most that
+     *      many remain cached.
+     *
+     *  \param max_bytes the new maximal number of cached bytes
+     */
+    void set_max_cached_bytes(std::size_t max_bytes)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_options.max_cached_bytes = max_bytes;
+        trim_locked(lock, max_bytes);
+    }
+
+    /*! Returns the options the resource uses.
+     */
+    caching_options options() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_options;
+    }
+
+    /*! Returns the number of bytes in the cached free blocks.
+     */
+    std::size_t cached_bytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_cached_bytes;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        // an alignment stricter than that of the blocks can't be served from the cache
+        if (alignment > m_options.alignment)
+        {
+            return m_upstream->do_allocate(bytes, alignment);
+        }
+
+        std::size_t block_size;
+        std::size_t index = size_class(bytes, block_size);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            std::vector<void_ptr> & bin = m_bins[index];
+            if (!bin.empty())
+            {
+                void_ptr ret = bin.back();
+                bin.pop_back();
+                m_cached_bytes -= block_size;
+                return ret;
+            }
+        }
+
+        return m_upstream->do_allocate(block_size, m_options.alignment);
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        if (alignment > m_options.alignment)
+        {
+            m_upstream->do_deallocate(p, bytes, alignment);
+            return;
+        }
+
+        std::size_t block_size;
+        std::size_t index = size_class(bytes, block_size);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_cached_bytes + block_size <= m_options.max_cached_bytes)
+            {
+                // reserving room for the block may throw, in which case it is
+                // returned to upstream below
+                try
+                {
+                    m_bins[index].push_back(p);
+                    m_cached_bytes += block_size;
+                    return;
+                }
+                catch (...)
+                {
+                }
+            }
+        }
+
+        m_upstream->do_deallocate(p, block_size, m_options.alignment);
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,545 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A pooling memory resource adaptor which scales with the number of
+ *  threads allocating from it concurrently.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <thrust/mr/pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe pooling memory resource adaptor, meant as a drop-in replacement for \p synchronized_pool_resource in
+ *      code that allocates from many threads at once. Uses \p std::mutex and \p std::atomic, and therefore requires C++11.
+ *
+ *  \p synchronized_pool_resource serializes every allocation and deallocation on a single mutex. This resource instead
+ *      keeps a number of caches of free blocks, one per hardware thread, with a free list for each size class. Every
+ *      thread is mapped to one of the caches, which it claims with a single uncontended atomic exchange; allocations and
+ *      deallocations which hit the cache never wait on another thread. When a cache runs out of blocks of some size, or
+ *      holds too many of them, blocks are moved between it and a central pool in batches. The central pool is sharded
+ *      by size class, with a mutex per class, so threads refilling caches of different sizes don't contend either.
+ *
+ *  Size classes, chunk sizes and the treatment of oversized and overaligned requests follow the \p pool_options
+ *      the same way \p unsynchronized_pool_resource does; oversized and overaligned requests are rare enough that they
+ *      are served by an \p unsynchronized_pool_resource guarded by a mutex. Calls to the upstream resource are always
+ *      serialized, so it doesn't need to be thread-safe.
+ *
+ *  Like \p unsynchronized_pool_resource, this version embeds its bookkeeping in the allocated blocks, and therefore
+ *      requires that memory allocated from Upstream is accessible from the host, directly or through smart references.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template<typename Upstream>
+class concurrent_pool_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+    using oversized_pool = unsynchronized_pool_resource<Upstream>;
+    using lock_t         = std::lock_guard<std::mutex>;
+
+public:
+    /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static pool_options get_default_options()
+    {
+        return oversized_pool::get_default_options();
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param options pool options to use
+     */
+    concurrent_pool_resource(Upstream * upstream, pool_options options = get_default_options())
+        : m_upstream(upstream),
+        m_options(options),
+        m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_class_count(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_cache_count((std::max)(std::thread::hardware_concurrency(), 1u)),
+        m_pools(new central_pool[m_class_count]),
+        m_caches(new cache[m_cache_count]),
+        m_oversized(upstream, options)
+    {
+        assert(m_options.validate());
+
+        for (std::size_t i = 0; i < m_cache_count; ++i)
+        {
+            m_caches[i].lists.reset(new block_list[m_class_count]);
+        }
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options pool options to use
+     */
+    concurrent_pool_resource(pool_options options = get_default_options())
+        : concurrent_pool_resource(get_global_resource<Upstream>(), options)
+    {
+    }
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~concurrent_pool_resource()
+    {
+        release();
+    }
+
+private:
+    using void_ptr = typename Upstream::pointer;
+    using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+    using char_ptr = typename void_ptr_traits::template rebind<char>::other;
+
+    struct block_descriptor;
+    struct chunk_descriptor;
+
+    using block_descriptor_ptr = typename void_ptr_traits::template rebind<block_descriptor>::other;
+    using chunk_descriptor_ptr = typename void_ptr_traits::template rebind<chunk_descriptor>::other;
+
+    struct block_descriptor
+    {
+        block_descriptor_ptr next;
+    };
+
+    struct chunk_descriptor
+    {
+        std::size_t size;
+        chunk_descriptor_ptr next;
+    };
+
+    struct block_list
+    {
+        block_descriptor_ptr head;
+        std::size_t count;
+
+        block_list() : head(), count(0)
+        {
+        }
+    };
+
+    // the blocks of a single size class which aren't held by any cache, and
+    // the chunks that blocks of this size class were carved out of
+    struct central_pool
+    {
+        std::mutex mutex;
+        block_list free_list;
+        std::size_t previous_allocated_count;
+        chunk_descriptor_ptr allocated;
+
+        central_pool() : mutex(), free_list(), previous_allocated_count(0), allocated()
+        {
+        }
+    };
+
+    // the padding keeps the flags of neighbouring caches in separate cache lines
+    struct cache
+    {
+        std::atomic<bool> busy;
+        std::unique_ptr<block_list[]> lists;
+        char padding[64];
+
+        cache() : busy(false), lists()
+        {
+        }
+    };
+
+    // blocks are moved between the caches and the central pools in batches
+    // of about this many bytes, and a cache holds at most two batches of
+    // blocks of any size class
+    static const std::size_t batch_bytes = static_cast<std::size_t>(1) << 16;
+    static const std::size_t max_batch_size = 64;
+
+    Upstream * m_upstream;
+
+    pool_options m_options;
+    std::size_t m_smallest_block_log2;
+    std::size_t m_class_count;
+    std::size_t m_cache_count;
+
+    std::unique_ptr<central_pool[]> m_pools;
+    std::unique_ptr<cache[]> m_caches;
+
+    // serializes the calls to upstream, including the ones made by the pool of
+    // oversized blocks
+    std::mutex m_upstream_mutex;
+    oversized_pool m_oversized;
+
+    static std::size_t batch_size(std::size_t bytes_log2)
+    {
+        std::size_t n = batch_bytes >> bytes_log2;
+        return n == 0 ? 1 : n > max_batch_size ? max_batch_size : n;
+    }
+
+    // every thread gets a number when it first touches any pool, and prefers
+    // the cache with that number; the numbers are handed out round-robin, so
+    // up to m_cache_count threads each have a cache to themselves
+    static std::size_t thread_index()
+    {
+        static std::atomic<std::size_t> next_index(0);
+        static thread_local std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    // claims a cache without waiting; if the preferred one is held by another
+    // thread, the others are tried in turn, and if all of them are busy, the
+    // caller goes to the central pool directly
+    cache * acquire_cache()
+    {
+        std::size_t first = thread_index() % m_cache_count;
+        for (std::size_t i = 0; i < m_cache_count; ++i)
+        {
+            std::size_t idx = first + i < m_cache_count ? first + i : first + i - m_cache_count;
+            cache & c = m_caches[idx];
+            if (!c.busy.load(std::memory_order_relaxed) && !c.busy.exchange(true, std::memory_order_acquire))
+            {
+                return &c;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void release_cache(cache * c)
+    {
+        c->busy.store(false, std::memory_order_release);
+    }
+
+    // releases the claimed cache, if any, when it goes out of scope; an
+    // upstream that throws must not leave a cache claimed, or release() would
+    // wait for it forever
+    struct cache_guard
+    {
+        cache * c;
+
+        explicit cache_guard(cache * c) : c(c)
+        {
+        }
+
+        ~cache_guard()
+        {
+            if (c)
+            {
+                release_cache(c);
+            }
+        }
+
+        cache_guard(const cache_guard &) = delete;
+        cache_guard & operator=(const cache_guard &) = delete;
+    };
+
+    static block_descriptor_ptr block_at(void_ptr p, std::size_t bytes)
+    {
+        return static_cast<block_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(p) + bytes
+            )
+        );
+    }
+
+    static void_ptr block_memory(block_descriptor_ptr block, std::size_t bytes)
+    {
+        return static_cast<void_ptr>(
+            static_cast<char_ptr>(
+                static_cast<void_ptr>(block)
+            ) - bytes
+        );
+    }
+
+    static void push(block_list & list, block_descriptor_ptr block)
+    {
+        thrust::raw_reference_cast(*block).next = list.head;
+        list.head = block;
+        ++list.count;
+    }
+
+    static block_descriptor_ptr pop(block_list & list)
+    {
+        block_descriptor_ptr block = list.head;
+        list.head = thrust::raw_reference_cast(*block).next;
+        --list.count;
+        return block;
+    }
+
+    // moves up to n blocks from the front of one list to the front of another
+    static void splice(block_list & from, block_list & to, std::size_t n)
+    {
+        n = (std::min)(n, from.count);
+        if (n == 0)
+        {
+            return;
+        }
+
+        block_descriptor_ptr first = from.head;
+        block_descriptor_ptr last = first;
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            last = thrust::raw_reference_cast(*last).next;
+        }
+
+        from.head = thrust::raw_reference_cast(*last).next;
+        from.count -= n;
+
+        thrust::raw_reference_cast(*last).next = to.head;
+        to.head = first;
+        to.count += n;
+    }
+
+    // carves a new chunk into blocks of the given size class and adds them to
+    // the free list of the central pool; the caller holds the pool's mutex
+    void grow(central_pool & pool, std::size_t bytes_log2)
+    {
+        std::size_t bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+        std::size_t n = pool.previous_allocated_count;
+        if (n == 0)
+        {
+            n = m_options.min_blocks_per_chunk;
+            if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.min_bytes_per_chunk >> bytes_log2;
+            }
+        }
+        else
+        {
+            n = n * 3 / 2;
+            if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.max_bytes_per_chunk >> bytes_log2;
+            }
+            if (n > m_options.max_blocks_per_chunk)
+            {
+                n = m_options.max_blocks_per_chunk;
+            }
+        }
+        std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+        std::size_t block_size = bytes + descriptor_size;
+        block_size += m_options.alignment - block_size % m_options.alignment;
+        std::size_t chunk_size = block_size * n;
+
+        void_ptr allocated;
+        {
+            lock_t lock(m_upstream_mutex);
+            allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+        }
+        pool.previous_allocated_count = n;
+
+        chunk_descriptor_ptr chunk = static_cast<chunk_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(allocated) + chunk_size
+            )
+        );
+
+        chunk_descriptor chunk_desc;
+        chunk_desc.size = chunk_size;
+        chunk_desc.next = pool.allocated;
+        *chunk = chunk_desc;
+        pool.allocated = chunk;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            push(pool.free_list, block_at(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + block_size * i), bytes));
+        }
+    }
+
+public:
+    /*! Releases all held memory to upstream.
+     */
+    void release()
+    {
+        // claim every cache, so that no thread touches a free list while the
+        // chunks are returned; threads that find all caches busy only touch
+        // the central pools, whose mutexes are taken below
+        for (std::size_t i = 0; i < m_cache_count; ++i)
+        {
+            while (m_caches[i].busy.exchange(true, std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            for (std::size_t j = 0; j < m_class_count; ++j)
+            {
+                m_caches[i].lists[j] = block_list();
+            }
+        }
+
+        for (std::size_t i = 0; i < m_class_count; ++i)
+        {
+            central_pool & pool = m_pools[i];
+            lock_t pool_lock(pool.mutex);
+
+            pool.free_list = block_list();
+            pool.previous_allocated_count = 0;
+
+            lock_t lock(m_upstream_mutex);
+            while (detail::pointer_traits<chunk_descriptor_ptr>::get(pool.allocated))
+            {
+                chunk_descriptor_ptr alloc = pool.allocated;
+                pool.allocated = thrust::raw_reference_cast(*pool.allocated).next;
+
+                void_ptr p = static_cast<void_ptr>(
+                    static_cast<char_ptr>(
+                        static_cast<void_ptr>(alloc)
+                    ) - thrust::raw_reference_cast(*alloc).size
+                );
+                m_upstream->do_deallocate(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+            }
+        }
+
+        {
+            lock_t lock(m_upstream_mutex);
+            m_oversized.release();
+        }
+
+        for (std::size_t i = 0; i < m_cache_count; ++i)
+        {
+            release_cache(&m_caches[i]);
+        }
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes = (std::max)(bytes, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // an oversized and/or overaligned allocation requested; needs to be allocated separately
+        if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_upstream_mutex);
+            return m_oversized.do_allocate(bytes, alignment);
+        }
+
+        std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+        std::size_t class_idx = bytes_log2 - m_smallest_block_log2;
+        central_pool & pool = m_pools[class_idx];
+
+        bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+        cache_guard guard(acquire_cache());
+        if (!guard.c)
+        {
+            lock_t lock(pool.mutex);
+            if (pool.free_list.count == 0)
+            {
+                grow(pool, bytes_log2);
+            }
+            return block_memory(pop(pool.free_list), bytes);
+        }
+
+        block_list & list = guard.c->lists[class_idx];
+
+        // the cache is empty; refill it with a batch from the central pool
+        if (list.count == 0)
+        {
+            lock_t lock(pool.mutex);
+            if (pool.free_list.count == 0)
+            {
+                grow(pool, bytes_log2);
+            }
+            splice(pool.free_list, list, batch_size(bytes_log2));
+        }
+
+        return block_memory(pop(list), bytes);
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        n = (std::max)(n, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // verify that the pointer is at least as aligned as claimed
+        assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
+
+        // the deallocated block is oversized and/or overaligned
+        if (n > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_upstream_mutex);
+            m_oversized.do_deallocate(p, n, alignment);
+            return;
+        }
+
+        std::size_t n_log2 = thrust::detail::log2_ri(n);
+        std::size_t class_idx = n_log2 - m_smallest_block_log2;
+        central_pool & pool = m_pools[class_idx];
+
+        n = static_cast<std::size_t>(1) << n_log2;
+
+        block_descriptor_ptr block = block_at(p, n);
+
+        cache_guard guard(acquire_cache());
+        if (!guard.c)
+        {
+            lock_t lock(pool.mutex);
+            push(pool.free_list, block);
+            return;
+        }
+
+        block_list & list = guard.c->lists[class_idx];
+        push(list, block);
+
+        // the cache holds more than two batches; keep the most recently freed
+        // batch and return the rest to the central pool
+        std::size_t batch = batch_size(n_log2);
+        if (list.count > 2 * batch)
+        {
+            block_descriptor_ptr last = list.head;
+            for (std::size_t i = 1; i < batch; ++i)
+            {
+                last = thrust::raw_reference_cast(*last).next;
+            }
+
+            block_descriptor_ptr surplus = thrust::raw_reference_cast(*last).next;
+            block_descriptor_ptr surplus_last = surplus;
+            while (detail::pointer_traits<block_descriptor_ptr>::get(thrust::raw_reference_cast(*surplus_last).next))
+            {
+                surplus_last = thrust::raw_reference_cast(*surplus_last).next;
+            }
+
+            std::size_t surplus_count = list.count - batch;
+            thrust::raw_reference_cast(*last).next = block_descriptor_ptr();
+            list.count = batch;
+
+            lock_t lock(pool.mutex);
+            thrust::raw_reference_cast(*surplus_last).next = pool.free_list.head;
+            pool.free_list.head = surplus;
+            pool.free_list.count += surplus_count;
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
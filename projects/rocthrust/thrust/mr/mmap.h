@@ -0,0 +1,533 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A host memory resource which backs allocations with memory mapped
+ *  files, so that host containers can hold data larger than the memory of the
+ *  system, or the contents of a file without reading it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <thrust/detail/integer_math.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/system_error.h>
+
+// included so that the address of the resource can be passed to execution policies
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#if defined(__linux__)
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The access patterns of mapped memory the kernel can be advised of, which tune its read-ahead and eviction of pages.
+ */
+enum class mmap_advice
+{
+    /*! No particular access pattern.
+     */
+    normal,
+    /*! The memory is accessed from lower to higher addresses; pages are read ahead aggressively and may be evicted soon
+     *      after they are accessed.
+     */
+    sequential,
+    /*! The memory is accessed in random order; pages are not read ahead.
+     */
+    random,
+    /*! The memory will be accessed soon; its pages are read ahead immediately.
+     */
+    willneed
+};
+
+/*! A type used for configuring \p mmap_resource.
+ */
+struct mmap_options
+{
+    /*! The access pattern every new mapping is advised of.
+     */
+    mmap_advice advice;
+
+    /*! Whether the changes made to memory mapped from a file are written back to it. If false, the file is opened
+     *      read-only and the mapped memory is a private copy-on-write view of it, which algorithms may modify without
+     *      changing the file.
+     */
+    bool write_back;
+};
+
+/*! A memory resource which backs every allocation with a memory mapping of a file. Depending on how it is constructed,
+ *      the file is:
+ *
+ *  - an anonymous memory file, created with \p memfd_create for every allocation. This is the default, and behaves like
+ *      ordinary memory.
+ *  - an unlinked temporary file in a given directory, created for every allocation. When the memory of the system runs
+ *      short, the pages of such allocations are written to the file system rather than to swap space, so that host
+ *      containers, and the algorithms running over them, can hold more data than fits in memory.
+ *  - a given file, in which consecutive allocations are laid out one after another, starting at the beginning of the
+ *      file. The first allocation of a resource maps the contents of the file, so that a vector of the size of the file
+ *      created with \p thrust::no_init holds the data of the file without it being read or copied:
+ *
+ *  \code
+ *  thrust::mr::mmap_resource file("prices.bin");
+ *  thrust::mapped_vector<float> prices(file.file_size() / sizeof(float), thrust::no_init, &file);
+ *
+ *  float total = thrust::reduce(thrust::omp::par, prices.begin(), prices.end());
+ *  \endcode
+ *
+ *  The pages of a file are only read when they are first accessed, and the kernel may be advised of the access pattern
+ *      of the memory with \p mmap_options::advice and \p advise. Allocations are rounded up to whole pages, so the
+ *      resource is meant for large arrays.
+ *
+ *  In a given file, the space of a deallocated allocation is only reused when it is the most recent allocation, so a
+ *      vector which grows in steps leaves earlier copies of its elements in the file; reserve its final capacity up
+ *      front instead. The file is extended as needed when \p mmap_options::write_back is true; otherwise, allocations
+ *      past its end throw \p thrust::bad_alloc.
+ *
+ *  The resource is thread-safe. Memory mapped files are only supported on Linux; elsewhere, the resource allocates
+ *      memory with the global operator new, and constructing it with a path throws \p thrust::system_error.
+ */
+class mmap_resource final : public memory_resource<>
+{
+public:
+    /*! Get the default options for the resource. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static mmap_options get_default_options()
+    {
+        mmap_options ret;
+
+        ret.advice = mmap_advice::normal;
+        ret.write_back = true;
+
+        return ret;
+    }
+
+    /*! Constructor. Allocations are backed by anonymous memory files.
+     *
+     *  \param options options to use
+     */
+    mmap_resource(mmap_options options = get_default_options())
+        : m_options(options),
+        m_page_size(system_page_size()),
+        m_backing(backing::memory),
+        m_path(),
+        m_fd(-1),
+        m_mutex(),
+        m_file_size(0),
+        m_next_offset(0),
+        m_last_allocation(nullptr),
+        m_last_offset(0)
+    {
+    }
+
+    /*! Constructor. If \p path names a directory, allocations are backed by unlinked temporary files created in it;
+     *      otherwise, they are laid out in the file \p path, which is created if it does not exist and
+     *      \p mmap_options::write_back is true.
+     *
+     *  \param path the path of the directory or file
+     *  \param options options to use
+     *  \throws thrust::system_error when the file cannot be opened.
+     */
+    mmap_resource(const char * path, mmap_options options = get_default_options())
+        : mmap_resource(options)
+    {
+#if defined(__linux__)
+        struct stat status;
+        if (::stat(path, &status) == 0 && S_ISDIR(status.st_mode))
+        {
+            m_backing = backing::directory;
+            m_path = path;
+            return;
+        }
+
+        int flags = m_options.write_back ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC;
+        int fd = ::open(path, flags, 0644);
+        if (fd < 0 || ::fstat(fd, &status) != 0)
+        {
+            int error = errno;
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            throw thrust::system_error(error, thrust::system_category(), std::string("cannot open ") + path);
+        }
+
+        m_backing = backing::file;
+        m_fd = fd;
+        m_file_size = static_cast<std::size_t>(status.st_size);
+#else
+        throw thrust::system_error(ENOTSUP, thrust::generic_category(),
+            std::string("memory mapped files are not supported, cannot open ") + path);
+#endif
+    }
+
+    /*! Destructor. Closes the file, if the resource was constructed with one. The memory that is still allocated
+     *      remains mapped.
+     */
+    ~mmap_resource()
+    {
+#if defined(__linux__)
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    mmap_resource(const mmap_resource &) = delete;
+    mmap_resource & operator=(const mmap_resource &) = delete;
+
+    /*! Returns the options the resource was constructed with.
+     */
+    const mmap_options & options() const
+    {
+        return m_options;
+    }
+
+    /*! Returns the size of the file the resource was constructed with, which includes the allocations that extended
+     *      it, or zero if allocations are not laid out in a given file.
+     */
+    std::size_t file_size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_file_size;
+    }
+
+    /*! Advises the kernel of the access pattern of a range of memory allocated from the resource, for example to read a
+     *      file ahead before a sequential pass over it and to stop reading ahead before sorting it.
+     *
+     *  \param p pointer to the beginning of the range
+     *  \param bytes the size of the range
+     *  \param advice the access pattern of the range
+     */
+    void advise(void * p, std::size_t bytes, mmap_advice advice) const
+    {
+#if defined(__linux__)
+        // the range passed to the kernel has to start at a page boundary
+        std::size_t head = reinterpret_cast<std::size_t>(p) % m_page_size;
+        ::madvise(static_cast<char *>(p) - head, bytes + head, advice_flag(advice));
+#else
+        (void)p;
+        (void)bytes;
+        (void)advice;
+#endif
+    }
+
+    /*! Allocates memory of size at least \p bytes and alignment at least \p alignment.
+     *
+     *  \param bytes size, in bytes, that is requested from this allocation
+     *  \param alignment alignment that is requested from this allocation
+     *  \throws thrust::bad_alloc when no memory with requested size and alignment can be allocated.
+     *  \return A pointer to void to the newly allocated memory.
+     */
+    THRUST_NODISCARD void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+#if defined(__linux__)
+        std::size_t size = mapping_size(bytes);
+        void * ret = nullptr;
+
+        if (m_backing == backing::file)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            std::size_t offset = m_next_offset;
+            if (offset + bytes > m_file_size)
+            {
+                if (!m_options.write_back)
+                {
+                    throw thrust::system::detail::bad_alloc("the allocation extends past the end of a read-only file");
+                }
+                if (::ftruncate(m_fd, static_cast<off_t>(offset + bytes)) != 0)
+                {
+                    throw thrust::system::detail::bad_alloc(std::strerror(errno));
+                }
+                m_file_size = offset + bytes;
+            }
+
+            ret = map(size, alignment, m_fd, offset, m_options.write_back ? MAP_SHARED : MAP_PRIVATE);
+
+            m_next_offset = offset + size;
+            m_last_allocation = ret;
+            m_last_offset = offset;
+        }
+        else
+        {
+            int fd = create_file(size);
+            if (fd >= 0)
+            {
+                try
+                {
+                    ret = map(size, alignment, fd, 0, MAP_SHARED);
+                }
+                catch (...)
+                {
+                    ::close(fd);
+                    throw;
+                }
+                // the mapping keeps the file alive
+                ::close(fd);
+            }
+            else
+            {
+                ret = map(size, alignment, -1, 0, MAP_PRIVATE | MAP_ANONYMOUS);
+            }
+        }
+
+        if (m_options.advice != mmap_advice::normal)
+        {
+            ::madvise(ret, size, advice_flag(m_options.advice));
+        }
+
+        return ret;
+#else
+        return m_fallback.do_allocate(bytes, alignment);
+#endif
+    }
+
+    /*! Deallocates memory pointed to by \p p.
+     *
+     *  \param p pointer to be deallocated
+     *  \param bytes the size of the allocation. This must be equivalent to the value of \p bytes that
+     *      was passed to the allocation function that returned \p p.
+     *  \param alignment the size of the allocation. This must be equivalent to the value of \p alignment
+     *      that was passed to the allocation function that returned \p p.
+     */
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+#if defined(__linux__)
+        (void)alignment;
+        ::munmap(p, mapping_size(bytes));
+
+        if (m_backing == backing::file)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // the most recent allocation is taken back, so that a vector
+            // which is created and destroyed repeatedly reuses the same part
+            // of the file
+            if (p == m_last_allocation)
+            {
+                m_next_offset = m_last_offset;
+                m_last_allocation = nullptr;
+            }
+        }
+#else
+        m_fallback.do_deallocate(p, bytes, alignment);
+#endif
+    }
+
+    /*! Compares this resource to the other one. Two resources which don't lay allocations out in a given file are
+     *      equal, since memory allocated by one of them can be deallocated by the other.
+     *
+     *  \param other the other resource to compare this resource to
+     *  \return whether the two resources are equivalent.
+     */
+    bool do_is_equal(const memory_resource<> & other) const noexcept override
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const mmap_resource * other_mmap = dynamic_cast<const mmap_resource *>(&other);
+        return other_mmap && m_backing != backing::file && other_mmap->m_backing != backing::file;
+    }
+
+private:
+    enum class backing
+    {
+        memory,
+        directory,
+        file
+    };
+
+    mmap_options m_options;
+    std::size_t m_page_size;
+
+    backing m_backing;
+    std::string m_path;
+    int m_fd;
+
+    // the layout of allocations in a given file
+    mutable std::mutex m_mutex;
+    std::size_t m_file_size;
+    std::size_t m_next_offset;
+    void * m_last_allocation;
+    std::size_t m_last_offset;
+
+#if defined(__linux__)
+    static std::size_t system_page_size()
+    {
+        long ret = ::sysconf(_SC_PAGESIZE);
+        return ret > 0 ? static_cast<std::size_t>(ret) : 4096;
+    }
+
+    static int advice_flag(mmap_advice advice)
+    {
+        switch (advice)
+        {
+        case mmap_advice::sequential:
+            return MADV_SEQUENTIAL;
+        case mmap_advice::random:
+            return MADV_RANDOM;
+        case mmap_advice::willneed:
+            return MADV_WILLNEED;
+        default:
+            return MADV_NORMAL;
+        }
+    }
+
+    std::size_t mapping_size(std::size_t bytes) const
+    {
+        return (std::max)(detail::divide_ri(bytes, m_page_size), static_cast<std::size_t>(1)) * m_page_size;
+    }
+
+    // creates the file backing an allocation, and returns its descriptor, or
+    // -1 if an anonymous mapping is to be used instead
+    int create_file(std::size_t size) const
+    {
+        int fd = -1;
+
+        if (m_backing == backing::memory)
+        {
+#if defined(SYS_memfd_create)
+            // the system call is made directly, so that an old C library
+            // doesn't prevent its use; the value of MFD_CLOEXEC is 1
+            fd = static_cast<int>(::syscall(SYS_memfd_create, "thrust::mr::mmap_resource", 1u));
+#endif
+            if (fd < 0)
+            {
+                return -1;
+            }
+        }
+        else
+        {
+#if defined(O_TMPFILE)
+            fd = ::open(m_path.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+#endif
+            if (fd < 0)
+            {
+                // not every file system supports unnamed temporary files
+                std::string name = m_path + "/thrust_mmap_XXXXXX";
+                fd = ::mkstemp(&name[0]);
+                if (fd < 0)
+                {
+                    throw thrust::system::detail::bad_alloc(std::strerror(errno));
+                }
+                ::unlink(name.c_str());
+            }
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            int error = errno;
+            ::close(fd);
+            throw thrust::system::detail::bad_alloc(std::strerror(error));
+        }
+
+        return fd;
+    }
+
+    // maps size bytes of a file at an address aligned to alignment; stricter
+    // alignments than a page are obtained by reserving a larger range of
+    // addresses and mapping the file over the aligned part of it
+    void * map(std::size_t size, std::size_t alignment, int fd, std::size_t offset, int flags) const
+    {
+        void * address = nullptr;
+
+        if (alignment > m_page_size)
+        {
+            std::size_t excess = alignment - m_page_size;
+
+            void * reserved = ::mmap(nullptr, size + excess, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reserved == MAP_FAILED)
+            {
+                throw thrust::system::detail::bad_alloc(std::strerror(errno));
+            }
+
+            char * begin = static_cast<char *>(reserved);
+            std::size_t head = (alignment - reinterpret_cast<std::size_t>(begin) % alignment) % alignment;
+
+            if (head)
+            {
+                ::munmap(begin, head);
+            }
+            if (excess - head)
+            {
+                ::munmap(begin + head + size, excess - head);
+            }
+
+            address = begin + head;
+            flags |= MAP_FIXED;
+        }
+
+        void * ret = ::mmap(address, size, PROT_READ | PROT_WRITE, flags, fd, static_cast<off_t>(offset));
+        if (ret == MAP_FAILED)
+        {
+            int error = errno;
+            if (address)
+            {
+                ::munmap(address, size);
+            }
+            throw thrust::system::detail::bad_alloc(std::strerror(error));
+        }
+
+        return ret;
+    }
+#else
+    new_delete_resource m_fallback;
+
+    static std::size_t system_page_size()
+    {
+        return 4096;
+    }
+#endif
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
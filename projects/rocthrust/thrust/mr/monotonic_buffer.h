@@ -0,0 +1,259 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource which hands out memory by advancing a pointer
+ *  through regions obtained from an upstream resource, and frees nothing until
+ *  it is reset.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <vector>
+
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+
+// included so that the address of the resource can be passed to execution policies
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource which hands out memory from a region obtained from an upstream resource by advancing a pointer,
+ *      and which does not return memory to the upstream resource when it is deallocated. An allocation costs a few
+ *      arithmetic operations, and the memory it returns has usually been used before, so it does not incur the page
+ *      faults and zeroing of memory freshly obtained from the system.
+ *
+ *  When the current region is exhausted, a new one, twice as large as the previous one or large enough for the request,
+ *      is obtained from upstream. \p reset makes all the memory available again at once; if more than one region was
+ *      needed since the last reset, they are replaced by a single region as large as all of them together, so that a
+ *      repeated workload is served from a single region after the first reset.
+ *
+ *  This makes the resource suitable for holding the temporary storage of algorithms that are invoked repeatedly, for
+ *      example once per request in a server, by passing its address to an execution policy and resetting it between
+ *      the invocations:
+ *
+ *  \code
+ *  thrust::mr::monotonic_buffer_resource<thrust::mr::new_delete_resource> arena(1 << 24);
+ *
+ *  for (auto & request : requests)
+ *  {
+ *      thrust::sort(thrust::omp::par(&arena), request.begin(), request.end());
+ *      arena.reset();
+ *  }
+ *  \endcode
+ *
+ *  The resource is not thread-safe. It only computes addresses, and never accesses the memory it hands out, so the
+ *      upstream resource may allocate memory that is not accessible from the host.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating the regions
+ */
+template<typename Upstream>
+class monotonic_buffer_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+public:
+    /*! The size of the first region obtained from upstream when no size is given to the constructor.
+     */
+    static const std::size_t default_initial_size = static_cast<std::size_t>(1) << 20;
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocating the regions
+     *  \param initial_size the size of the first region obtained from upstream
+     */
+    monotonic_buffer_resource(Upstream * upstream, std::size_t initial_size = default_initial_size)
+        : m_upstream(upstream),
+        m_initial_size((std::max)(initial_size, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT))),
+        m_next_size(m_initial_size),
+        m_regions(),
+        m_current(),
+        m_current_size(0),
+        m_used(0)
+    {
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param initial_size the size of the first region obtained from upstream
+     */
+    monotonic_buffer_resource(std::size_t initial_size = default_initial_size)
+        : monotonic_buffer_resource(get_global_resource<Upstream>(), initial_size)
+    {
+    }
+
+    /*! Destructor. Returns all regions to upstream.
+     */
+    ~monotonic_buffer_resource()
+    {
+        release();
+    }
+
+private:
+    using void_ptr = typename Upstream::pointer;
+    using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+    using char_ptr = typename void_ptr_traits::template rebind<char>::other;
+    using char_ptr_traits = thrust::detail::pointer_traits<char_ptr>;
+
+    struct region
+    {
+        void_ptr pointer;
+        std::size_t size;
+        std::size_t alignment;
+    };
+
+    Upstream * m_upstream;
+
+    std::size_t m_initial_size;
+    std::size_t m_next_size;
+
+    // all regions obtained since the last reset; the last one is the one
+    // allocations are currently served from
+    std::vector<region> m_regions;
+
+    char_ptr m_current;
+    std::size_t m_current_size;
+    std::size_t m_used;
+
+    void add_region(std::size_t size, std::size_t alignment)
+    {
+        region r = { m_upstream->do_allocate(size, alignment), size, alignment };
+        m_regions.push_back(r);
+
+        m_current = static_cast<char_ptr>(r.pointer);
+        m_current_size = size;
+        m_used = 0;
+
+        // regions grow geometrically, so that a workload larger than the
+        // initial size only needs a logarithmic number of them
+        m_next_size = (std::max)(m_next_size, size) * 2;
+    }
+
+    // the padding needed in front of an allocation at the current position to
+    // align it as requested
+    std::size_t padding(std::size_t alignment) const
+    {
+        std::size_t address = static_cast<std::size_t>(
+            reinterpret_cast<detail::intmax_t>(char_ptr_traits::get(m_current)) + m_used);
+        return (alignment - address % alignment) % alignment;
+    }
+
+public:
+    /*! Returns all regions to upstream. The next allocation obtains a region of the initial size again.
+     */
+    void release()
+    {
+        for (std::size_t i = 0; i < m_regions.size(); ++i)
+        {
+            m_upstream->do_deallocate(m_regions[i].pointer, m_regions[i].size, m_regions[i].alignment);
+        }
+
+        m_regions.clear();
+        m_next_size = m_initial_size;
+        m_current = char_ptr();
+        m_current_size = 0;
+        m_used = 0;
+    }
+
+    /*! Makes all the memory held by the resource available for allocation again. All memory allocated from the resource
+     *      so far must no longer be used. If more than one region was obtained from upstream since the last reset,
+     *      they are replaced with a single region of their total size.
+     */
+    void reset()
+    {
+        if (m_regions.size() > 1)
+        {
+            std::size_t total_size = 0;
+            for (std::size_t i = 0; i < m_regions.size(); ++i)
+            {
+                total_size += m_regions[i].size;
+            }
+
+            release();
+            add_region(total_size, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+
+        m_used = 0;
+    }
+
+    /*! Returns the total size of the regions currently obtained from upstream.
+     */
+    std::size_t capacity() const
+    {
+        std::size_t ret = 0;
+        for (std::size_t i = 0; i < m_regions.size(); ++i)
+        {
+            ret += m_regions[i].size;
+        }
+        return ret;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        if (m_regions.empty() || padding(alignment) + bytes > m_current_size - m_used)
+        {
+            // a region aligned as strictly as the request needs no padding
+            std::size_t region_alignment = (std::max)(alignment, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT));
+            add_region((std::max)(m_next_size, bytes), region_alignment);
+        }
+
+        m_used += padding(alignment);
+
+        void_ptr ret = static_cast<void_ptr>(m_current + m_used);
+        m_used += bytes;
+
+        return ret;
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        // verify that the pointer is at least as aligned as claimed
+        assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
+
+        // memory is only reclaimed by reset, except that the most recent
+        // allocation can be taken back; temporary storage is usually freed in
+        // the reverse order of allocation, so this lets consecutive algorithms
+        // reuse the same memory
+        if (!m_regions.empty() && static_cast<char_ptr>(p) + n == m_current + m_used)
+        {
+            m_used -= n;
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,388 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A host memory resource which maps pages from the operating system
+ *  directly, optionally backed by huge pages and placed on chosen NUMA nodes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstdint>
+
+#include <thrust/detail/integer_math.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kinds of pages that back the memory allocated by \p page_resource.
+ */
+enum class huge_page_policy
+{
+    /*! Ordinary pages of the system page size.
+     */
+    none,
+    /*! Transparent huge pages. The mappings are aligned to and sized in multiples of the huge page size, and the
+     *      kernel is advised to back them with huge pages.
+     */
+    transparent,
+    /*! Huge pages reserved in advance by the administrator, for example through \p /proc/sys/vm/nr_hugepages. When no
+     *      reserved huge pages are left, transparent huge pages are used instead.
+     */
+    hugetlb
+};
+
+/*! The placement of the memory allocated by \p page_resource on the NUMA nodes of the system.
+ */
+enum class numa_policy
+{
+    /*! Every page is placed on the node of the thread that touches it first.
+     */
+    first_touch,
+    /*! The pages are spread over the nodes round-robin.
+     */
+    interleave,
+    /*! The pages are placed on the given nodes only.
+     */
+    bind
+};
+
+/*! A type used for configuring \p page_resource.
+ */
+struct page_options
+{
+    /*! The kind of pages that back the allocated memory.
+     */
+    huge_page_policy huge_pages;
+    /*! The size of huge pages. Allocations backed by huge pages are rounded up to a multiple of this size.
+     */
+    std::size_t huge_page_size;
+
+    /*! The placement of the allocated memory on the NUMA nodes.
+     */
+    numa_policy placement;
+    /*! The NUMA nodes used by \p numa_policy::interleave and \p numa_policy::bind, as a bit mask in which bit \p i
+     *      stands for node \p i. Zero stands for all nodes that have memory.
+     */
+    std::uint64_t numa_nodes;
+
+    /*! Checks if the options are self-consistent.
+     *
+     *  \returns true if the options are self-consistent, false otherwise.
+     */
+    bool validate() const
+    {
+        if (!detail::is_power_of_2(huge_page_size)) return false;
+
+        return true;
+    }
+};
+
+/*! A memory resource which maps memory from the operating system directly, instead of going through the global
+ *      operator new. Every allocation is a mapping of its own, rounded up to whole pages, and is returned to the
+ *      operating system when it is deallocated; the resource is therefore meant for large arrays, and small allocations
+ *      are better served by a pool in front of it.
+ *
+ *  Backing large arrays with huge pages reduces the TLB misses of random accesses to them, and placing them explicitly
+ *      on NUMA nodes avoids cross-socket traffic when the threads accessing them are spread over the sockets. The huge
+ *      page and NUMA policies are requests to the kernel: when the kernel cannot honour them, the memory is backed by
+ *      ordinary pages or placed on first touch, instead of the allocation failing.
+ *
+ *  The resource may be used with host containers through \p thrust::mr::allocator:
+ *
+ *  \code
+ *  thrust::mr::page_options options = thrust::mr::page_resource::get_default_options();
+ *  options.placement = thrust::mr::numa_policy::interleave;
+ *
+ *  thrust::mr::page_resource resource(options);
+ *  thrust::host_vector<float, thrust::mr::allocator<float, thrust::mr::page_resource>> data(n, &resource);
+ *  \endcode
+ *
+ *  Huge pages and NUMA placement are only supported on Linux; elsewhere, the resource allocates memory with the global
+ *      operator new.
+ */
+class page_resource final : public memory_resource<>
+{
+public:
+    /*! Get the default options for the resource. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static page_options get_default_options()
+    {
+        page_options ret;
+
+        ret.huge_pages = huge_page_policy::transparent;
+        ret.huge_page_size = static_cast<std::size_t>(2) << 20;
+
+        ret.placement = numa_policy::first_touch;
+        ret.numa_nodes = 0;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param options options to use
+     */
+    page_resource(page_options options = get_default_options())
+        : m_options(options),
+        m_page_size(system_page_size())
+    {
+        assert(m_options.validate());
+
+        m_options.huge_page_size = (std::max)(m_options.huge_page_size, m_page_size);
+    }
+
+    /*! Returns the options the resource was constructed with.
+     */
+    const page_options & options() const
+    {
+        return m_options;
+    }
+
+    /*! Allocates memory of size at least \p bytes and alignment at least \p alignment.
+     *
+     *  \param bytes size, in bytes, that is requested from this allocation
+     *  \param alignment alignment that is requested from this allocation
+     *  \throws thrust::bad_alloc when no memory with requested size and alignment can be allocated.
+     *  \return A pointer to void to the newly allocated memory.
+     */
+    THRUST_NODISCARD void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+#if defined(__linux__)
+        std::size_t size = mapping_size(bytes);
+        void * ret = nullptr;
+
+        if (m_options.huge_pages == huge_page_policy::hugetlb && alignment <= m_options.huge_page_size)
+        {
+            // reserved huge pages are mapped at addresses aligned to their size
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+            flags |= static_cast<int>(detail::log2(m_options.huge_page_size)) << MAP_HUGE_SHIFT;
+#endif
+            ret = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (ret == MAP_FAILED)
+            {
+                ret = nullptr;
+            }
+        }
+
+        if (!ret)
+        {
+            bool huge = m_options.huge_pages != huge_page_policy::none;
+
+            ret = map_aligned(size, (std::max)(alignment, huge ? m_options.huge_page_size : m_page_size));
+
+#if defined(MADV_HUGEPAGE)
+            if (huge)
+            {
+                ::madvise(ret, size, MADV_HUGEPAGE);
+            }
+#endif
+        }
+
+        place(ret, size);
+
+        return ret;
+#else
+        return m_fallback.do_allocate(bytes, alignment);
+#endif
+    }
+
+    /*! Deallocates memory pointed to by \p p.
+     *
+     *  \param p pointer to be deallocated
+     *  \param bytes the size of the allocation. This must be equivalent to the value of \p bytes that
+     *      was passed to the allocation function that returned \p p.
+     *  \param alignment the size of the allocation. This must be equivalent to the value of \p alignment
+     *      that was passed to the allocation function that returned \p p.
+     */
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+#if defined(__linux__)
+        (void)alignment;
+        ::munmap(p, mapping_size(bytes));
+#else
+        m_fallback.do_deallocate(p, bytes, alignment);
+#endif
+    }
+
+    /*! Compares this resource to the other one. Two page resources are equal when they map memory with the same
+     *      policies, so that memory allocated by one of them can be deallocated by the other.
+     *
+     *  \param other the other resource to compare this resource to
+     *  \return whether the two resources are equivalent.
+     */
+    bool do_is_equal(const memory_resource<> & other) const noexcept override
+    {
+        const page_resource * other_page = dynamic_cast<const page_resource *>(&other);
+        return other_page
+            && other_page->m_options.huge_pages == m_options.huge_pages
+            && other_page->m_options.huge_page_size == m_options.huge_page_size;
+    }
+
+private:
+    page_options m_options;
+    std::size_t m_page_size;
+
+#if defined(__linux__)
+    static std::size_t system_page_size()
+    {
+        long ret = ::sysconf(_SC_PAGESIZE);
+        return ret > 0 ? static_cast<std::size_t>(ret) : 4096;
+    }
+
+    // the size of the mapping of an allocation; allocations that may be backed
+    // by huge pages are mapped in whole huge pages, so that no part of them
+    // needs to be backed by ordinary pages
+    std::size_t mapping_size(std::size_t bytes) const
+    {
+        std::size_t granularity = m_options.huge_pages == huge_page_policy::none ? m_page_size : m_options.huge_page_size;
+        return (std::max)(detail::divide_ri(bytes, granularity), static_cast<std::size_t>(1)) * granularity;
+    }
+
+    // maps size bytes at an address aligned to alignment, by mapping more than
+    // needed and unmapping the excess on both sides
+    void * map_aligned(std::size_t size, std::size_t alignment) const
+    {
+        std::size_t excess = alignment > m_page_size ? alignment - m_page_size : 0;
+
+        void * mapped = ::mmap(nullptr, size + excess, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            throw thrust::system::detail::bad_alloc(std::strerror(errno));
+        }
+
+        char * begin = static_cast<char *>(mapped);
+        std::size_t head = (alignment - reinterpret_cast<std::size_t>(begin) % alignment) % alignment;
+
+        if (head)
+        {
+            ::munmap(begin, head);
+        }
+        if (excess - head)
+        {
+            ::munmap(begin + head + size, excess - head);
+        }
+
+        return begin + head;
+    }
+
+    // the nodes that have memory, as a bit mask; nodes past the 64th are ignored
+    static std::uint64_t memory_nodes()
+    {
+        static const std::uint64_t nodes = []
+        {
+            std::uint64_t ret = 0;
+
+            // a list of ranges, like "0-1,4"
+            std::FILE * file = std::fopen("/sys/devices/system/node/has_memory", "r");
+            if (file)
+            {
+                unsigned long first, last;
+                int matched;
+                while ((matched = std::fscanf(file, "%lu-%lu", &first, &last)) >= 1)
+                {
+                    if (matched == 1)
+                    {
+                        last = first;
+                    }
+                    for (unsigned long node = first; node <= last && node < 64; ++node)
+                    {
+                        ret |= static_cast<std::uint64_t>(1) << node;
+                    }
+                    if (std::fgetc(file) != ',')
+                    {
+                        break;
+                    }
+                }
+                std::fclose(file);
+            }
+
+            return ret ? ret : 1;
+        }();
+
+        return nodes;
+    }
+
+    // sets the NUMA policy of a mapping that hasn't been touched yet; the
+    // system call is made directly, so that libnuma isn't required
+    void place(void * p, std::size_t size) const
+    {
+#if defined(SYS_mbind)
+        // the values of MPOL_BIND and MPOL_INTERLEAVE in linux/mempolicy.h
+        const int mpol_bind = 2;
+        const int mpol_interleave = 3;
+
+        if (m_options.placement == numa_policy::first_touch)
+        {
+            return;
+        }
+
+        unsigned long mask = static_cast<unsigned long>(m_options.numa_nodes ? m_options.numa_nodes : memory_nodes());
+        int mode = m_options.placement == numa_policy::bind ? mpol_bind : mpol_interleave;
+
+        // the kernel reads one bit less than the maximal node number it is given;
+        // if it can't apply the policy, the pages are placed on first touch
+        ::syscall(SYS_mbind, p, size, mode, &mask, sizeof(mask) * 8 + 1, 0);
+#else
+        (void)p;
+        (void)size;
+#endif
+    }
+#else
+    new_delete_resource m_fallback;
+
+    static std::size_t system_page_size()
+    {
+        return 4096;
+    }
+#endif
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
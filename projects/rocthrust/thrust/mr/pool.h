@@ -33,6 +33,7 @@
 #include <thrust/mr/pool_options.h>
 
 #include <cassert>
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -108,7 +109,8 @@ public:
         m_pools(upstream),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_oversized(),
+        m_cached_buckets()
     {
         assert(m_options.validate());
 
@@ -129,7 +131,8 @@ public:
         m_pools(get_global_resource<Upstream>()),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_oversized(),
+        m_cached_buckets()
     {
         assert(m_options.validate());
 
@@ -171,8 +174,7 @@ private:
 
     // this was originally a forward list, but I made it a doubly linked list
     // because that way deallocation when not caching is faster and doesn't require
-    // traversal of a linked list (it's still a forward list for the cached list,
-    // because allocation from that list already traverses)
+    // traversal of a linked list
     //
     // TODO: investigate whether it's better to have this be a doubly-linked list
     // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -181,13 +183,17 @@ private:
     // I assume that it is better this way, but the additional pointer could
     // potentially hurt? these are supposed to be oversized and/or overaligned,
     // so they are kinda memory intensive already
+    //
+    // cached blocks are additionally linked into the list of their size bucket
+    // (see m_cached_oversized) through cached_prev and cached_next
     struct oversized_block_descriptor
     {
         std::size_t size;
         std::size_t alignment;
         oversized_block_descriptor_ptr prev;
         oversized_block_descriptor_ptr next;
-        oversized_block_descriptor_ptr next_cached;
+        oversized_block_descriptor_ptr cached_prev;
+        oversized_block_descriptor_ptr cached_next;
         std::size_t current_size;
     };
 
@@ -209,7 +215,196 @@ private:
     pool_vector m_pools;
     chunk_descriptor_ptr m_allocated;
     oversized_block_descriptor_ptr m_oversized;
-    oversized_block_descriptor_ptr m_cached_oversized;
+
+    // the cached oversized blocks, segregated by size into four buckets per power of two; every bucket is a doubly
+    // linked list with the most recently cached block at the front, and a bit is set in m_cached_buckets for every
+    // bucket that isn't empty. A lookup goes straight to the first bucket whose blocks are all large enough for the
+    // request, instead of walking all cached blocks.
+    static const std::size_t sub_bucket_bits = 2;
+    static const std::size_t bucket_count = (sizeof(std::size_t) * 8) << sub_bucket_bits;
+    static const std::size_t bucket_word_bits = sizeof(std::uint64_t) * 8;
+
+    oversized_block_descriptor_ptr m_cached_oversized[bucket_count];
+    std::uint64_t m_cached_buckets[bucket_count / bucket_word_bits];
+
+    static std::size_t floor_log2(std::uint64_t x)
+    {
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_GCC || THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_CLANG
+        return 63 - __builtin_clzll(x);
+#else
+        std::size_t ret = 0;
+        for (std::size_t shift = 32; shift > 0; shift /= 2)
+        {
+            if (x >> shift)
+            {
+                x >>= shift;
+                ret += shift;
+            }
+        }
+        return ret;
+#endif
+    }
+
+    static std::size_t cached_bucket(std::size_t size)
+    {
+        std::size_t size_log2 = floor_log2(size);
+        if (size_log2 < sub_bucket_bits)
+        {
+            return size_log2 << sub_bucket_bits;
+        }
+
+        std::size_t sub_bucket = (size >> (size_log2 - sub_bucket_bits)) & ((1 << sub_bucket_bits) - 1);
+        return (size_log2 << sub_bucket_bits) + sub_bucket;
+    }
+
+    // the size of the smallest block that belongs to a bucket
+    static std::size_t bucket_min_size(std::size_t bucket)
+    {
+        std::size_t size_log2 = bucket >> sub_bucket_bits;
+        if (size_log2 < sub_bucket_bits)
+        {
+            return static_cast<std::size_t>(1) << size_log2;
+        }
+
+        std::size_t sub_bucket = bucket & ((1 << sub_bucket_bits) - 1);
+        return ((static_cast<std::size_t>(1) << sub_bucket_bits) + sub_bucket) << (size_log2 - sub_bucket_bits);
+    }
+
+    // the first bucket at or after the given one that isn't empty, or bucket_count if there is none
+    std::size_t next_cached_bucket(std::size_t bucket) const
+    {
+        std::size_t word = bucket / bucket_word_bits;
+        if (word >= bucket_count / bucket_word_bits)
+        {
+            return bucket_count;
+        }
+
+        std::uint64_t bits = m_cached_buckets[word] & (~std::uint64_t(0) << (bucket % bucket_word_bits));
+        while (!bits)
+        {
+            if (++word == bucket_count / bucket_word_bits)
+            {
+                return bucket_count;
+            }
+            bits = m_cached_buckets[word];
+        }
+
+        return word * bucket_word_bits + floor_log2(bits & (~bits + 1));
+    }
+
+    void insert_cached(oversized_block_descriptor_ptr block)
+    {
+        oversized_block_descriptor & desc = thrust::raw_reference_cast(*block);
+        std::size_t bucket = cached_bucket(desc.size);
+
+        oversized_block_descriptor_ptr & head = m_cached_oversized[bucket];
+        desc.cached_prev = oversized_block_descriptor_ptr();
+        desc.cached_next = head;
+        if (oversized_block_ptr_traits::get(head))
+        {
+            thrust::raw_reference_cast(*head).cached_prev = block;
+        }
+        head = block;
+
+        m_cached_buckets[bucket / bucket_word_bits] |= std::uint64_t(1) << (bucket % bucket_word_bits);
+    }
+
+    void erase_cached(const oversized_block_descriptor & desc)
+    {
+        std::size_t bucket = cached_bucket(desc.size);
+
+        if (oversized_block_ptr_traits::get(desc.cached_prev))
+        {
+            thrust::raw_reference_cast(*desc.cached_prev).cached_next = desc.cached_next;
+        }
+        else
+        {
+            m_cached_oversized[bucket] = desc.cached_next;
+        }
+
+        if (oversized_block_ptr_traits::get(desc.cached_next))
+        {
+            thrust::raw_reference_cast(*desc.cached_next).cached_prev = desc.cached_prev;
+        }
+
+        if (!oversized_block_ptr_traits::get(m_cached_oversized[bucket]))
+        {
+            m_cached_buckets[bucket / bucket_word_bits] &= ~(std::uint64_t(1) << (bucket % bucket_word_bits));
+        }
+    }
+
+    // the most recently cached block of a bucket that is large enough and aligned enough for the request, but not so
+    // much larger or more aligned that the cutoff factors rule it out
+    oversized_block_descriptor_ptr find_cached_in(std::size_t bucket, std::size_t bytes, std::size_t alignment) const
+    {
+        for (oversized_block_descriptor_ptr ptr = m_cached_oversized[bucket];
+             oversized_block_ptr_traits::get(ptr);)
+        {
+            const oversized_block_descriptor & desc = thrust::raw_reference_cast(*ptr);
+            bool is_good = desc.size >= bytes && desc.alignment >= alignment;
+
+            // if the size is bigger than the requested size by a factor
+            // bigger than or equal to the specified cutoff for size,
+            // allocate a new block
+            if (is_good)
+            {
+                std::size_t size_factor = desc.size / bytes;
+                if (size_factor >= m_options.cached_size_cutoff_factor)
+                {
+                    is_good = false;
+                }
+            }
+
+            // if the alignment is bigger than the requested one by a factor
+            // bigger than or equal to the specified cutoff for alignment,
+            // allocate a new block
+            if (is_good)
+            {
+                std::size_t alignment_factor = desc.alignment / alignment;
+                if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+                {
+                    is_good = false;
+                }
+            }
+
+            if (is_good)
+            {
+                return ptr;
+            }
+
+            ptr = desc.cached_next;
+        }
+
+        return oversized_block_descriptor_ptr();
+    }
+
+    // finds a cached block that fits the request, if there is one. Every block in the buckets after the request's own
+    // is large enough, so the front block of the first of them that isn't empty fits unless the alignment doesn't; those
+    // buckets are searched first, from the smallest blocks up, and the request's own bucket, whose blocks may be too
+    // small, is searched last
+    oversized_block_descriptor_ptr find_cached(std::size_t bytes, std::size_t alignment) const
+    {
+        std::size_t own_bucket = cached_bucket(bytes);
+
+        for (std::size_t bucket = next_cached_bucket(own_bucket + 1); bucket < bucket_count;
+             bucket = next_cached_bucket(bucket + 1))
+        {
+            // if even the smallest blocks of the bucket are bigger than the requested size by a factor bigger than or
+            // equal to the specified cutoff for size, no block in this or any later bucket can be used
+            if (bucket_min_size(bucket) / bytes >= m_options.cached_size_cutoff_factor)
+            {
+                break;
+            }
+
+            oversized_block_descriptor_ptr ptr = find_cached_in(bucket, bytes, alignment);
+            if (oversized_block_ptr_traits::get(ptr))
+            {
+                return ptr;
+            }
+        }
+
+        return find_cached_in(own_bucket, bytes, alignment);
+    }
 
 public:
     /*! Releases all held memory to upstream.
@@ -254,7 +449,14 @@ public:
                 desc.alignment);
         }
 
-        m_cached_oversized = oversized_block_descriptor_ptr();
+        for (std::size_t i = 0; i < bucket_count; ++i)
+        {
+            m_cached_oversized[i] = oversized_block_descriptor_ptr();
+        }
+        for (std::size_t i = 0; i < bucket_count / bucket_word_bits; ++i)
+        {
+            m_cached_buckets[i] = 0;
+        }
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -267,78 +469,40 @@ public:
         {
             if (m_options.cache_oversized)
             {
-                oversized_block_descriptor_ptr ptr = m_cached_oversized;
-                oversized_block_descriptor_ptr * previous = &m_cached_oversized;
-                while (oversized_block_ptr_traits::get(ptr))
+                oversized_block_descriptor_ptr ptr = find_cached(bytes, alignment);
+                if (oversized_block_ptr_traits::get(ptr))
                 {
                     oversized_block_descriptor desc = *ptr;
-                    bool is_good = desc.size >= bytes && desc.alignment >= alignment;
-
-                    // if the size is bigger than the requested size by a factor
-                    // bigger than or equal to the specified cutoff for size,
-                    // allocate a new block
-                    if (is_good)
-                    {
-                        std::size_t size_factor = desc.size / bytes;
-                        if (size_factor >= m_options.cached_size_cutoff_factor)
-                        {
-                            is_good = false;
-                        }
-                    }
-
-                    // if the alignment is bigger than the requested one by a factor
-                    // bigger than or equal to the specified cutoff for alignment,
-                    // allocate a new block
-                    if (is_good)
-                    {
-                        std::size_t alignment_factor = desc.alignment / alignment;
-                        if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-                        {
-                            is_good = false;
-                        }
-                    }
-
-                    if (is_good)
-                    {
-                        if (previous != &m_cached_oversized)
-                        {
-                            *previous = desc.next_cached;
-                        }
-                        else
-                        {
-                            m_cached_oversized = desc.next_cached;
-                        }
 
-                        desc.next_cached = oversized_block_descriptor_ptr();
+                    erase_cached(desc);
 
-                        auto ret =
-                            static_cast<char_ptr>(static_cast<void_ptr>(ptr)) -
-                            desc.size;
+                    desc.cached_prev = oversized_block_descriptor_ptr();
+                    desc.cached_next = oversized_block_descriptor_ptr();
 
-                        if (bytes != desc.size) {
-                            desc.current_size = bytes;
+                    auto ret =
+                        static_cast<char_ptr>(static_cast<void_ptr>(ptr)) -
+                        desc.size;
 
-                            ptr = static_cast<oversized_block_descriptor_ptr>(
-                                static_cast<void_ptr>(ret + bytes));
+                    if (bytes != desc.size) {
+                        desc.current_size = bytes;
 
-                            if (oversized_block_ptr_traits::get(desc.prev)) {
-                                thrust::raw_reference_cast(*desc.prev).next = ptr;
-                            } else {
-                                m_oversized = ptr;
-                            }
+                        ptr = static_cast<oversized_block_descriptor_ptr>(
+                            static_cast<void_ptr>(ret + bytes));
 
-                            if (oversized_block_ptr_traits::get(desc.next)) {
-                                thrust::raw_reference_cast(*desc.next).prev = ptr;
-                            }
+                        if (oversized_block_ptr_traits::get(desc.prev)) {
+                            thrust::raw_reference_cast(*desc.prev).next = ptr;
+                        } else {
+                            m_oversized = ptr;
                         }
 
-                        *ptr = desc;
-
-                        return static_cast<void_ptr>(ret);
+                        if (oversized_block_ptr_traits::get(desc.next)) {
+                            thrust::raw_reference_cast(*desc.next).prev = ptr;
+                        }
                     }
 
-                    previous = &thrust::raw_reference_cast(*ptr).next_cached;
-                    ptr = *previous;
+                    *ptr = desc;
+
+                    return static_cast<void_ptr>(ret);
                 }
             }
 
@@ -355,7 +519,8 @@ public:
             desc.alignment = alignment;
             desc.prev = oversized_block_descriptor_ptr();
             desc.next = m_oversized;
-            desc.next_cached = oversized_block_descriptor_ptr();
+            desc.cached_prev = oversized_block_descriptor_ptr();
+            desc.cached_next = oversized_block_descriptor_ptr();
             desc.current_size = bytes;
             *block = desc;
             m_oversized = block;
@@ -466,12 +631,11 @@ public:
 
             oversized_block_descriptor desc = *block;
             assert(desc.current_size == n);
-            assert(desc.alignment == alignment);
+            // a cached block may have been handed out for a less strict alignment than it was allocated with
+            assert(desc.alignment >= alignment);
 
             if (m_options.cache_oversized)
             {
-                desc.next_cached = m_cached_oversized;
-
                 if (desc.size != n) {
                     desc.current_size = desc.size;
                     block = static_cast<oversized_block_descriptor_ptr>(
@@ -488,8 +652,8 @@ public:
                     }
                 }
 
-                m_cached_oversized = block;
                 *block = desc;
+                insert_cached(block);
 
                 return;
             }
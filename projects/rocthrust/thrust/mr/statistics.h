@@ -0,0 +1,337 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource adaptor which records statistics of the
+ *  allocations made through it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <thrust/detail/integer_math.h>
+
+// included so that the address of the resource can be passed to execution policies
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+// the tag of the statistics_tag innermost on the calling thread, shared by all
+// statistics resources
+inline const char *& current_statistics_tag()
+{
+    static thread_local const char * tag = nullptr;
+    return tag;
+}
+
+} // end detail
+
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A snapshot of the statistics recorded by a \p statistics_resource.
+ */
+struct allocation_statistics
+{
+    /*! The number of buckets of \p size_histogram.
+     */
+    static const std::size_t histogram_size = sizeof(std::size_t) * 8 + 1;
+
+    /*! The number of allocations.
+     */
+    std::size_t allocations;
+    /*! The number of deallocations.
+     */
+    std::size_t deallocations;
+    /*! The total number of bytes allocated.
+     */
+    std::size_t bytes_allocated;
+    /*! The number of bytes allocated and not yet deallocated.
+     */
+    std::size_t bytes_in_use;
+    /*! The largest value \p bytes_in_use has had since the statistics were last reset.
+     */
+    std::size_t peak_bytes_in_use;
+
+    /*! The number of allocations by size; bucket \p 0 counts the allocations of at most one byte, and bucket \p i counts
+     *      the allocations of more than <tt>2^(i-1)</tt> and at most <tt>2^i</tt> bytes.
+     */
+    std::size_t size_histogram[histogram_size];
+};
+
+/*! Tags the allocations and deallocations that the calling thread makes through any \p statistics_resource while the
+ *      object is alive, so that they are also recorded separately under the tag. Tags nest: the innermost one is used,
+ *      and the enclosing one is restored when it is destroyed.
+ *
+ *  \code
+ *  {
+ *      thrust::mr::statistics_tag tag("sort keys");
+ *      thrust::sort(thrust::omp::par(stats), keys.begin(), keys.end());
+ *  }
+ *  \endcode
+ */
+class statistics_tag
+{
+public:
+    /*! Constructor.
+     *
+     *  \param tag the name of the tag; it must outlive the object
+     */
+    explicit statistics_tag(const char * tag)
+        : m_previous(detail::current_statistics_tag())
+    {
+        detail::current_statistics_tag() = tag;
+    }
+
+    /*! Destructor. Restores the tag that was in effect when the object was constructed.
+     */
+    ~statistics_tag()
+    {
+        detail::current_statistics_tag() = m_previous;
+    }
+
+    statistics_tag(const statistics_tag &) = delete;
+    statistics_tag & operator=(const statistics_tag &) = delete;
+
+private:
+    const char * m_previous;
+};
+
+/*! A memory resource adaptor which passes all allocations to an upstream resource and records statistics of them: the
+ *      number of allocations and deallocations, the bytes in use and their high-water mark, and a histogram of the
+ *      allocation sizes. The statistics are kept in atomic counters, so the resource is as thread-safe as its upstream
+ *      resource, and untagged allocations never wait on other threads.
+ *
+ *  Allocations and deallocations made while a \p statistics_tag is alive on the calling thread are recorded under the
+ *      tag as well, which attributes them to a call site. A deallocation is attributed to the tag in effect when it is
+ *      made, which is the tag of the allocation when the memory is freed in the same scope it was allocated in, as the
+ *      temporary storage of algorithms is.
+ *
+ *  To record the temporary storage of algorithms, pass the address of the resource to their execution policies. A
+ *      single instance shared by the whole program is returned by \p get_global_resource:
+ *
+ *  \code
+ *  using stats_resource = thrust::mr::statistics_resource<thrust::mr::new_delete_resource>;
+ *  stats_resource * stats = thrust::mr::get_global_resource<stats_resource>();
+ *
+ *  thrust::reduce_by_key(thrust::omp::par(stats), ...);
+ *  std::size_t scratch = stats->statistics().peak_bytes_in_use;
+ *  \endcode
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template<typename Upstream>
+class statistics_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+public:
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     */
+    statistics_resource(Upstream * upstream)
+        : m_upstream(upstream),
+        m_allocations(0),
+        m_deallocations(0),
+        m_bytes_allocated(0),
+        m_bytes_in_use(0),
+        m_peak_bytes_in_use(0),
+        m_size_histogram(),
+        m_tags_mutex(),
+        m_tags()
+    {
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     */
+    statistics_resource()
+        : statistics_resource(get_global_resource<Upstream>())
+    {
+    }
+
+private:
+    using void_ptr = typename Upstream::pointer;
+    using histogram = std::atomic<std::size_t>[allocation_statistics::histogram_size];
+
+    Upstream * m_upstream;
+
+    std::atomic<std::size_t> m_allocations;
+    std::atomic<std::size_t> m_deallocations;
+    std::atomic<std::size_t> m_bytes_allocated;
+    std::atomic<std::size_t> m_bytes_in_use;
+    std::atomic<std::size_t> m_peak_bytes_in_use;
+    histogram m_size_histogram;
+
+    // tagged allocations are rare enough that a lock is fine; std::less<>
+    // finds a tag without constructing a string
+    mutable std::mutex m_tags_mutex;
+    std::map<std::string, allocation_statistics, std::less<>> m_tags;
+
+    static std::size_t histogram_bucket(std::size_t bytes)
+    {
+        return bytes <= 1 ? 0 : static_cast<std::size_t>(thrust::detail::log2_ri(bytes));
+    }
+
+    allocation_statistics & tag_entry(const char * tag)
+    {
+        auto it = m_tags.find(tag);
+        if (it == m_tags.end())
+        {
+            it = m_tags.emplace(tag, allocation_statistics()).first;
+        }
+        return it->second;
+    }
+
+public:
+    /*! Returns a snapshot of the statistics of all allocations. The counters are read one by one, so while other threads
+     *      allocate, the snapshot may not correspond to a single point in time.
+     */
+    allocation_statistics statistics() const
+    {
+        allocation_statistics ret;
+
+        ret.allocations = m_allocations.load(std::memory_order_relaxed);
+        ret.deallocations = m_deallocations.load(std::memory_order_relaxed);
+        ret.bytes_allocated = m_bytes_allocated.load(std::memory_order_relaxed);
+        ret.bytes_in_use = m_bytes_in_use.load(std::memory_order_relaxed);
+        ret.peak_bytes_in_use = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < allocation_statistics::histogram_size; ++i)
+        {
+            ret.size_histogram[i] = m_size_histogram[i].load(std::memory_order_relaxed);
+        }
+
+        return ret;
+    }
+
+    /*! Returns a snapshot of the statistics of the allocations made under a tag. All counters are zero for a tag that
+     *      has not been used.
+     *
+     *  \param tag the name of the tag
+     */
+    allocation_statistics tag_statistics(const char * tag) const
+    {
+        std::lock_guard<std::mutex> lock(m_tags_mutex);
+
+        auto it = m_tags.find(tag);
+        return it != m_tags.end() ? it->second : allocation_statistics();
+    }
+
+    /*! Returns the names of all tags allocations have been made under.
+     */
+    std::vector<std::string> tags() const
+    {
+        std::lock_guard<std::mutex> lock(m_tags_mutex);
+
+        std::vector<std::string> ret;
+        for (const auto & tag : m_tags)
+        {
+            ret.push_back(tag.first);
+        }
+        return ret;
+    }
+
+    /*! Resets the high-water marks, of all allocations and of every tag, to the bytes currently in use, so that the peak
+     *      of a following piece of work can be measured on its own.
+     */
+    void reset_peak()
+    {
+        m_peak_bytes_in_use.store(m_bytes_in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_tags_mutex);
+        for (auto & tag : m_tags)
+        {
+            tag.second.peak_bytes_in_use = tag.second.bytes_in_use;
+        }
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+
+        std::size_t bucket = histogram_bucket(bytes);
+
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+        m_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+        m_size_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t in_use = m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::size_t peak = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+        while (in_use > peak
+            && !m_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+        {
+        }
+
+        if (const char * tag = detail::current_statistics_tag())
+        {
+            std::lock_guard<std::mutex> lock(m_tags_mutex);
+
+            allocation_statistics & entry = tag_entry(tag);
+            ++entry.allocations;
+            entry.bytes_allocated += bytes;
+            ++entry.size_histogram[bucket];
+            entry.bytes_in_use += bytes;
+            entry.peak_bytes_in_use = (std::max)(entry.peak_bytes_in_use, entry.bytes_in_use);
+        }
+
+        return ret;
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        m_upstream->do_deallocate(p, bytes, alignment);
+
+        m_deallocations.fetch_add(1, std::memory_order_relaxed);
+        m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+
+        if (const char * tag = detail::current_statistics_tag())
+        {
+            std::lock_guard<std::mutex> lock(m_tags_mutex);
+
+            allocation_statistics & entry = tag_entry(tag);
+            ++entry.deallocations;
+            // memory allocated under another tag may be freed under this one
+            entry.bytes_in_use -= (std::min)(entry.bytes_in_use, bytes);
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,490 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource adaptor which caches free blocks per thread, in
+ *  front of an upstream resource shared by all threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/numeric_traits.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A type used for configuring \p thread_caching_resource.
+ */
+struct thread_caching_options
+{
+    /*! The size of the smallest blocks cached by a thread. All allocation requests below this size will be rounded up to
+     *      this size.
+     */
+    std::size_t smallest_block_size;
+    /*! The size of the largest blocks cached by a thread. All allocation requests above this size are passed to the
+     *      upstream resource directly.
+     */
+    std::size_t largest_block_size;
+
+    /*! The alignment of all cached blocks. All allocation requests above this alignment are passed to the upstream resource
+     *      directly.
+     */
+    std::size_t alignment;
+
+    /*! The maximal number of bytes in the free blocks cached by a single thread. When a thread holds more than this, it
+     *      returns blocks to the upstream resource until it holds at most half of it.
+     */
+    std::size_t max_cached_bytes;
+
+    /*! Checks if the options are self-consistent.
+     *
+     *  \returns true if the options are self-consistent, false otherwise.
+     */
+    bool validate() const
+    {
+        if (!detail::is_power_of_2(smallest_block_size)) return false;
+        if (!detail::is_power_of_2(largest_block_size)) return false;
+        if (!detail::is_power_of_2(alignment)) return false;
+
+        if (smallest_block_size > largest_block_size) return false;
+
+        return true;
+    }
+};
+
+/*! A memory resource adaptor which keeps a cache of free blocks for every thread that uses it, in front of an upstream
+ *      resource shared by all threads. Uses \p std::atomic and \p thread_local, and therefore requires C++11.
+ *
+ *  Unlike \p tls_pool, a block may be deallocated by any thread, not only by the one that allocated it. Every block
+ *      remembers the cache of the thread that allocated it; a block deallocated by another thread is pushed to a queue
+ *      of that cache without taking a lock, and the owning thread moves the blocks of its queue to its free lists the next
+ *      time it allocates. This makes the resource suitable for pipelines in which producer threads allocate memory that
+ *      consumer threads free.
+ *
+ *  The free blocks cached by a thread are bounded by \p thread_caching_options::max_cached_bytes; the surplus is returned
+ *      to the upstream resource. When a thread exits, or the resource is destroyed, the blocks cached by the thread are
+ *      returned to the upstream resource as well. Requests for more than the largest block size or for a stricter
+ *      alignment than the blocks have are passed to the upstream resource directly.
+ *
+ *  The upstream resource is used by many threads at once, and therefore must be thread-safe; a
+ *      \p concurrent_pool_resource or a \p synchronized_pool_resource is a good choice. Every cached block starts with
+ *      a small header, so memory allocated from it must be accessible from the host.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template<typename Upstream>
+class thread_caching_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+public:
+    /*! Get the default options for the resource. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static thread_caching_options get_default_options()
+    {
+        thread_caching_options ret;
+
+        ret.smallest_block_size = THRUST_MR_DEFAULT_ALIGNMENT;
+        ret.largest_block_size = static_cast<std::size_t>(1) << 20;
+
+        ret.alignment = THRUST_MR_DEFAULT_ALIGNMENT;
+
+        ret.max_cached_bytes = static_cast<std::size_t>(1) << 22;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations, shared by all threads
+     *  \param options options to use
+     */
+    thread_caching_resource(Upstream * upstream, thread_caching_options options = get_default_options())
+        : m_upstream(upstream),
+        m_options(options),
+        m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_class_count(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_header_size(sizeof(block_header)),
+        m_id(next_id()),
+        m_caches_mutex(),
+        m_caches()
+    {
+        assert(m_options.validate());
+
+        if (m_header_size % m_options.alignment != 0)
+        {
+            m_header_size += m_options.alignment - m_header_size % m_options.alignment;
+        }
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options options to use
+     */
+    thread_caching_resource(thread_caching_options options = get_default_options())
+        : thread_caching_resource(get_global_resource<Upstream>(), options)
+    {
+    }
+
+    /*! Destructor. Returns the blocks cached by all threads to upstream.
+     */
+    ~thread_caching_resource()
+    {
+        std::lock_guard<std::mutex> lock(m_caches_mutex);
+        for (std::size_t i = 0; i < m_caches.size(); ++i)
+        {
+            detach(*m_caches[i]);
+        }
+    }
+
+private:
+    using void_ptr = typename Upstream::pointer;
+    using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+
+    struct thread_cache;
+
+    struct block_header
+    {
+        thread_cache * owner;
+        block_header * next;
+        std::size_t size_class;
+    };
+
+    struct thread_cache
+    {
+        // blocks deallocated by other threads; they are pushed one by one, and
+        // taken by the owning thread all at once, so there is no ABA problem.
+        // Once the cache is detached, this holds the address of closed, and
+        // blocks are returned to upstream instead
+        std::atomic<block_header *> remote_frees;
+        block_header closed;
+
+        std::unique_ptr<block_header *[]> free_lists;
+        std::size_t cached_bytes;
+
+        // detaching happens either when the owning thread exits or when the
+        // resource is destroyed, whichever comes first
+        std::mutex detach_mutex;
+        bool detached;
+        thread_caching_resource * resource;
+
+        thread_cache(thread_caching_resource * resource, std::size_t class_count)
+            : remote_frees(nullptr),
+            closed(),
+            free_lists(new block_header *[class_count]()),
+            cached_bytes(0),
+            detach_mutex(),
+            detached(false),
+            resource(resource)
+        {
+        }
+    };
+
+    struct thread_entry
+    {
+        std::uint64_t id;
+        std::shared_ptr<thread_cache> cache;
+    };
+
+    // the caches of one thread, one for every resource the thread has used;
+    // shared ownership keeps a cache alive until both its thread has exited
+    // and its resource has been destroyed
+    struct thread_caches
+    {
+        std::vector<thread_entry> entries;
+
+        ~thread_caches()
+        {
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                detach(*entries[i].cache);
+            }
+        }
+    };
+
+    Upstream * m_upstream;
+
+    thread_caching_options m_options;
+    std::size_t m_smallest_block_log2;
+    std::size_t m_class_count;
+    std::size_t m_header_size;
+
+    // resources are told apart by a number that is never reused, so that a
+    // thread never mistakes a new resource for a destroyed one at the same address
+    std::uint64_t m_id;
+
+    // the caches of exited threads are kept too, since blocks they allocated
+    // may still be deallocated by other threads
+    std::mutex m_caches_mutex;
+    std::vector<std::shared_ptr<thread_cache>> m_caches;
+
+    static std::uint64_t next_id()
+    {
+        static std::atomic<std::uint64_t> id(0);
+        return id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    thread_cache & local_cache()
+    {
+        static thread_local thread_caches caches;
+
+        for (std::size_t i = 0; i < caches.entries.size(); ++i)
+        {
+            if (caches.entries[i].id == m_id)
+            {
+                return *caches.entries[i].cache;
+            }
+        }
+
+        // forget the caches of resources that have been destroyed
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < caches.entries.size(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(caches.entries[i].cache->detach_mutex);
+            if (!caches.entries[i].cache->detached)
+            {
+                caches.entries[kept++] = caches.entries[i];
+            }
+        }
+        caches.entries.resize(kept);
+
+        thread_entry entry = { m_id, std::make_shared<thread_cache>(this, m_class_count) };
+        {
+            std::lock_guard<std::mutex> lock(m_caches_mutex);
+            m_caches.push_back(entry.cache);
+        }
+        caches.entries.push_back(entry);
+
+        return *entry.cache;
+    }
+
+    void_ptr block_memory(block_header * block) const
+    {
+        return static_cast<void_ptr>(static_cast<void *>(block));
+    }
+
+    void deallocate_block(block_header * block)
+    {
+        std::size_t bytes = static_cast<std::size_t>(1) << (block->size_class + m_smallest_block_log2);
+        m_upstream->do_deallocate(block_memory(block), m_header_size + bytes, m_options.alignment);
+    }
+
+    // moves the blocks deallocated by other threads to the free lists
+    void collect_remote_frees(thread_cache & cache)
+    {
+        block_header * block = cache.remote_frees.exchange(nullptr, std::memory_order_acquire);
+        while (block)
+        {
+            block_header * next = block->next;
+
+            block->next = cache.free_lists[block->size_class];
+            cache.free_lists[block->size_class] = block;
+            cache.cached_bytes += static_cast<std::size_t>(1) << (block->size_class + m_smallest_block_log2);
+
+            block = next;
+        }
+    }
+
+    // returns free blocks to upstream, the largest ones first, until the cache
+    // holds at most max_bytes
+    void trim(thread_cache & cache, std::size_t max_bytes)
+    {
+        for (std::size_t i = m_class_count; i > 0 && cache.cached_bytes > max_bytes; --i)
+        {
+            std::size_t bytes = static_cast<std::size_t>(1) << (i - 1 + m_smallest_block_log2);
+            block_header *& head = cache.free_lists[i - 1];
+            while (head && cache.cached_bytes > max_bytes)
+            {
+                block_header * block = head;
+                head = block->next;
+                cache.cached_bytes -= bytes;
+                deallocate_block(block);
+            }
+        }
+    }
+
+    static void detach(thread_cache & cache)
+    {
+        std::lock_guard<std::mutex> lock(cache.detach_mutex);
+        if (cache.detached)
+        {
+            return;
+        }
+        cache.detached = true;
+
+        thread_caching_resource & resource = *cache.resource;
+
+        block_header * block = cache.remote_frees.exchange(&cache.closed, std::memory_order_acquire);
+        while (block)
+        {
+            block_header * next = block->next;
+            resource.deallocate_block(block);
+            block = next;
+        }
+
+        resource.trim(cache, 0);
+    }
+
+public:
+    /*! Returns the blocks cached by all threads to upstream. Must not be called concurrently with allocations or
+     *      deallocations from other threads.
+     */
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(m_caches_mutex);
+        for (std::size_t i = 0; i < m_caches.size(); ++i)
+        {
+            thread_cache & cache = *m_caches[i];
+
+            std::lock_guard<std::mutex> detach_lock(cache.detach_mutex);
+            if (!cache.detached)
+            {
+                collect_remote_frees(cache);
+                trim(cache, 0);
+            }
+        }
+    }
+
+    /*! Returns the number of bytes in the free blocks cached by the calling thread.
+     */
+    std::size_t cached_bytes()
+    {
+        return local_cache().cached_bytes;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes = (std::max)(bytes, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // an oversized and/or overaligned allocation requested; upstream takes care of it
+        if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            return m_upstream->do_allocate(bytes, alignment);
+        }
+
+        std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+        std::size_t size_class = bytes_log2 - m_smallest_block_log2;
+
+        bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+        thread_cache & cache = local_cache();
+
+        if (cache.remote_frees.load(std::memory_order_relaxed))
+        {
+            collect_remote_frees(cache);
+        }
+
+        block_header * block = cache.free_lists[size_class];
+        if (block)
+        {
+            cache.free_lists[size_class] = block->next;
+            cache.cached_bytes -= bytes;
+
+            // collecting the remote frees may have left the cache over its limit
+            if (cache.cached_bytes > m_options.max_cached_bytes)
+            {
+                trim(cache, m_options.max_cached_bytes / 2);
+            }
+        }
+        else
+        {
+            void_ptr allocated = m_upstream->do_allocate(m_header_size + bytes, m_options.alignment);
+            block = static_cast<block_header *>(void_ptr_traits::get(allocated));
+            block->owner = &cache;
+            block->size_class = size_class;
+        }
+
+        return static_cast<void_ptr>(static_cast<void *>(reinterpret_cast<char *>(block) + m_header_size));
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        n = (std::max)(n, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // verify that the pointer is at least as aligned as claimed
+        assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
+
+        // the deallocated block is oversized and/or overaligned
+        if (n > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            m_upstream->do_deallocate(p, n, alignment);
+            return;
+        }
+
+        block_header * block = reinterpret_cast<block_header *>(
+            static_cast<char *>(void_ptr_traits::get(p)) - m_header_size);
+        thread_cache & owner = *block->owner;
+
+        // a block allocated by another thread goes back to that thread's
+        // queue, or to upstream if that thread has exited
+        if (&owner != &local_cache())
+        {
+            block_header * head = owner.remote_frees.load(std::memory_order_relaxed);
+            do
+            {
+                if (head == &owner.closed)
+                {
+                    deallocate_block(block);
+                    return;
+                }
+                block->next = head;
+            } while (!owner.remote_frees.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+
+            return;
+        }
+
+        block->next = owner.free_lists[block->size_class];
+        owner.free_lists[block->size_class] = block;
+        owner.cached_bytes += static_cast<std::size_t>(1) << (block->size_class + m_smallest_block_log2);
+
+        if (owner.cached_bytes > m_options.max_cached_bytes)
+        {
+            trim(owner, m_options.max_cached_bytes / 2);
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
@@ -35,6 +35,9 @@ namespace mr
  */
 
 /*! Potentially constructs, if not yet created, and then returns the address of a thread-local \p unsynchronized_pool_resource,
+ *
+ *  Memory allocated from the returned pool must be deallocated by the same thread. Use \p thread_caching_resource when
+ *      blocks are freed by other threads than the ones that allocated them.
  *
  *  \tparam Upstream the template argument to the pool template
  *  \param upstream the argument to the constructor, if invoked
@@ -0,0 +1,618 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file multiway_merge.h
+ *  \brief Merging many sorted runs at once
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup merging
+ *  \{
+ */
+
+
+/*! \p multiway_merge combines many sorted runs into a single sorted range. Every element of
+ *  <tt>[runs_first, runs_last)</tt> is a \p thrust::pair of iterators delimiting one run, and the elements
+ *  of all of the runs are copied to <tt>[result, result + n)</tt>, where \c n is the total length of
+ *  the runs, such that the resulting range is in ascending order. \p multiway_merge is stable, meaning
+ *  both that the relative order of elements within each run is preserved, and that for equivalent
+ *  elements in different runs the element from the earlier run precedes the element from the later one.
+ *
+ *  This version of \p multiway_merge compares elements using \c operator<.
+ *
+ *  Every element is moved once, rather than once per round of a tree of pairwise \p merge calls.
+ *  The CPP system selects the next element with a loser tree, and the OpenMP and TBB systems split
+ *  the output into slices of equal size by searching every run for the boundaries of each slice,
+ *  so that every thread merges an independent slice with its own loser tree.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param runs_first The beginning of the sequence of runs.
+ *  \param runs_last The end of the sequence of runs.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>, and the ordering on it is a
+ *          strict weak ordering, as defined in the <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre Every run shall be sorted with respect to \c operator<.
+ *  \pre The output range shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge to merge three sorted runs in ascending order:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[3] = {1, 5, 9};
+ *  int B[4] = {2, 3, 5, 10};
+ *  int C[2] = {0, 5};
+ *
+ *  thrust::pair<int*,int*> runs[3] = {thrust::make_pair(A, A + 3),
+ *                                     thrust::make_pair(B, B + 4),
+ *                                     thrust::make_pair(C, C + 2)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::multiway_merge(thrust::host, runs, runs + 3, result);
+ *
+ *  // result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  \endcode
+ *
+ *  \see merge
+ *  \see multiway_merge_by_key
+ *  \see stable_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result);
+
+
+/*! \p multiway_merge combines many sorted runs into a single sorted range. Every element of
+ *  <tt>[runs_first, runs_last)</tt> is a \p thrust::pair of iterators delimiting one run, and the elements
+ *  of all of the runs are copied to <tt>[result, result + n)</tt>, where \c n is the total length of
+ *  the runs, such that the resulting range is in ascending order. \p multiway_merge is stable, meaning
+ *  both that the relative order of elements within each run is preserved, and that for equivalent
+ *  elements in different runs the element from the earlier run precedes the element from the later one.
+ *
+ *  This version of \p multiway_merge compares elements using a function object \p comp.
+ *
+ *  Every element is moved once, rather than once per round of a tree of pairwise \p merge calls.
+ *  The CPP system selects the next element with a loser tree, and the OpenMP and TBB systems split
+ *  the output into slices of equal size by searching every run for the boundaries of each slice,
+ *  so that every thread merges an independent slice with its own loser tree.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param runs_first The beginning of the sequence of runs.
+ *  \param runs_last The end of the sequence of runs.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is convertible to \p StrictWeakCompare's \c first_argument_type
+ *          and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every run shall be sorted with respect to \p comp.
+ *  \pre The output range shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge to merge three sorted runs in descending order:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[3] = {9, 5, 1};
+ *  int B[4] = {10, 5, 3, 2};
+ *  int C[2] = {5, 0};
+ *
+ *  thrust::pair<int*,int*> runs[3] = {thrust::make_pair(A, A + 3),
+ *                                     thrust::make_pair(B, B + 4),
+ *                                     thrust::make_pair(C, C + 2)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::multiway_merge(thrust::host, runs, runs + 3, result, thrust::greater<int>());
+ *
+ *  // result = {10, 9, 5, 5, 5, 3, 2, 1, 0}
+ *  \endcode
+ *
+ *  \see merge
+ *  \see multiway_merge_by_key
+ *  \see stable_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp);
+
+
+/*! \p multiway_merge combines many sorted runs into a single sorted range. Every element of
+ *  <tt>[runs_first, runs_last)</tt> is a \p thrust::pair of iterators delimiting one run, and the elements
+ *  of all of the runs are copied to <tt>[result, result + n)</tt>, where \c n is the total length of
+ *  the runs, such that the resulting range is in ascending order. \p multiway_merge is stable, meaning
+ *  both that the relative order of elements within each run is preserved, and that for equivalent
+ *  elements in different runs the element from the earlier run precedes the element from the later one.
+ *
+ *  This version of \p multiway_merge compares elements using \c operator<.
+ *
+ *  \param runs_first The beginning of the sequence of runs.
+ *  \param runs_last The end of the sequence of runs.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>, and the ordering on it is a
+ *          strict weak ordering, as defined in the <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre Every run shall be sorted with respect to \c operator<.
+ *  \pre The output range shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge to merge three sorted runs in ascending order:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  ...
+ *  int A[3] = {1, 5, 9};
+ *  int B[4] = {2, 3, 5, 10};
+ *  int C[2] = {0, 5};
+ *
+ *  thrust::pair<int*,int*> runs[3] = {thrust::make_pair(A, A + 3),
+ *                                     thrust::make_pair(B, B + 4),
+ *                                     thrust::make_pair(C, C + 2)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::multiway_merge(runs, runs + 3, result);
+ *
+ *  // result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  \endcode
+ *
+ *  \see merge
+ *  \see multiway_merge_by_key
+ *  \see stable_sort
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator2 multiway_merge(RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result);
+
+
+/*! \p multiway_merge combines many sorted runs into a single sorted range. Every element of
+ *  <tt>[runs_first, runs_last)</tt> is a \p thrust::pair of iterators delimiting one run, and the elements
+ *  of all of the runs are copied to <tt>[result, result + n)</tt>, where \c n is the total length of
+ *  the runs, such that the resulting range is in ascending order. \p multiway_merge is stable, meaning
+ *  both that the relative order of elements within each run is preserved, and that for equivalent
+ *  elements in different runs the element from the earlier run precedes the element from the later one.
+ *
+ *  This version of \p multiway_merge compares elements using a function object \p comp.
+ *
+ *  \param runs_first The beginning of the sequence of runs.
+ *  \param runs_last The end of the sequence of runs.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is convertible to \p StrictWeakCompare's \c first_argument_type
+ *          and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every run shall be sorted with respect to \p comp.
+ *  \pre The output range shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge to merge three sorted runs in descending order:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int A[3] = {9, 5, 1};
+ *  int B[4] = {10, 5, 3, 2};
+ *  int C[2] = {5, 0};
+ *
+ *  thrust::pair<int*,int*> runs[3] = {thrust::make_pair(A, A + 3),
+ *                                     thrust::make_pair(B, B + 4),
+ *                                     thrust::make_pair(C, C + 2)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::multiway_merge(runs, runs + 3, result, thrust::greater<int>());
+ *
+ *  // result = {10, 9, 5, 5, 5, 3, 2, 1, 0}
+ *  \endcode
+ *
+ *  \see merge
+ *  \see multiway_merge_by_key
+ *  \see stable_sort
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+  RandomAccessIterator2 multiway_merge(RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp);
+
+
+/*! \p multiway_merge_by_key performs a key-value multiway merge. Every element of
+ *  <tt>[key_runs_first, key_runs_last)</tt> is a \p thrust::pair of iterators delimiting a sorted run of
+ *  keys, and the corresponding element of the sequence beginning at \p value_runs_first is an
+ *  iterator to the beginning of the values of that run. The keys of all of the runs are merged as
+ *  by \p multiway_merge into <tt>[keys_result, keys_result + n)</tt>, and each value is copied to the
+ *  position in <tt>[values_result, values_result + n)</tt> of its key. \p multiway_merge_by_key is stable.
+ *
+ *  This version of \p multiway_merge_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param key_runs_first The beginning of the sequence of runs of keys.
+ *  \param key_runs_last The end of the sequence of runs of keys.
+ *  \param value_runs_first The beginning of the sequence of the beginnings of the runs of values.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>, and the ordering on it is a
+ *          strict weak ordering, as defined in the <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2's \c value_type is an iterator which is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator3 is mutable.
+ *  \tparam RandomAccessIterator4 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator4 is mutable.
+ *
+ *  \pre Every run of keys shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge_by_key to merge three sorted
+ *  runs of keys and their values using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A_keys[3] = {1, 5, 9};
+ *  int B_keys[4] = {2, 3, 5, 10};
+ *  int C_keys[2] = {0, 5};
+ *
+ *  char A_vals[3] = {'a', 'a', 'a'};
+ *  char B_vals[4] = {'b', 'b', 'b', 'b'};
+ *  char C_vals[2] = {'c', 'c'};
+ *
+ *  thrust::pair<int*,int*> key_runs[3] = {thrust::make_pair(A_keys, A_keys + 3),
+ *                                         thrust::make_pair(B_keys, B_keys + 4),
+ *                                         thrust::make_pair(C_keys, C_keys + 2)};
+ *
+ *  char *value_runs[3] = {A_vals, B_vals, C_vals};
+ *
+ *  int  keys_result[9];
+ *  char vals_result[9];
+ *
+ *  thrust::pair<int*,char*> end =
+ *    thrust::multiway_merge_by_key(thrust::host, key_runs, key_runs + 3, value_runs, keys_result, vals_result);
+ *
+ *  // keys_result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  // vals_result = {'c', 'a', 'b', 'b', 'a', 'b', 'c', 'a', 'b'}
+ *  \endcode
+ *
+ *  \see merge_by_key
+ *  \see multiway_merge
+ *  \see stable_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result);
+
+
+/*! \p multiway_merge_by_key performs a key-value multiway merge. Every element of
+ *  <tt>[key_runs_first, key_runs_last)</tt> is a \p thrust::pair of iterators delimiting a sorted run of
+ *  keys, and the corresponding element of the sequence beginning at \p value_runs_first is an
+ *  iterator to the beginning of the values of that run. The keys of all of the runs are merged as
+ *  by \p multiway_merge into <tt>[keys_result, keys_result + n)</tt>, and each value is copied to the
+ *  position in <tt>[values_result, values_result + n)</tt> of its key. \p multiway_merge_by_key is stable.
+ *
+ *  This version of \p multiway_merge_by_key compares keys using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param key_runs_first The beginning of the sequence of runs of keys.
+ *  \param key_runs_last The end of the sequence of runs of keys.
+ *  \param value_runs_first The beginning of the sequence of the beginnings of the runs of values.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is convertible to \p StrictWeakCompare's \c first_argument_type
+ *          and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2's \c value_type is an iterator which is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator3 is mutable.
+ *  \tparam RandomAccessIterator4 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator4 is mutable.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every run of keys shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge_by_key to merge three sorted
+ *  runs of keys and their values using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A_keys[3] = {1, 5, 9};
+ *  int B_keys[4] = {2, 3, 5, 10};
+ *  int C_keys[2] = {0, 5};
+ *
+ *  char A_vals[3] = {'a', 'a', 'a'};
+ *  char B_vals[4] = {'b', 'b', 'b', 'b'};
+ *  char C_vals[2] = {'c', 'c'};
+ *
+ *  thrust::pair<int*,int*> key_runs[3] = {thrust::make_pair(A_keys, A_keys + 3),
+ *                                         thrust::make_pair(B_keys, B_keys + 4),
+ *                                         thrust::make_pair(C_keys, C_keys + 2)};
+ *
+ *  char *value_runs[3] = {A_vals, B_vals, C_vals};
+ *
+ *  int  keys_result[9];
+ *  char vals_result[9];
+ *
+ *  thrust::pair<int*,char*> end =
+ *    thrust::multiway_merge_by_key(thrust::host, key_runs, key_runs + 3, value_runs, keys_result, vals_result, thrust::less<int>());
+ *
+ *  // keys_result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  // vals_result = {'c', 'a', 'b', 'b', 'a', 'b', 'c', 'a', 'b'}
+ *  \endcode
+ *
+ *  \see merge_by_key
+ *  \see multiway_merge
+ *  \see stable_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp);
+
+
+/*! \p multiway_merge_by_key performs a key-value multiway merge. Every element of
+ *  <tt>[key_runs_first, key_runs_last)</tt> is a \p thrust::pair of iterators delimiting a sorted run of
+ *  keys, and the corresponding element of the sequence beginning at \p value_runs_first is an
+ *  iterator to the beginning of the values of that run. The keys of all of the runs are merged as
+ *  by \p multiway_merge into <tt>[keys_result, keys_result + n)</tt>, and each value is copied to the
+ *  position in <tt>[values_result, values_result + n)</tt> of its key. \p multiway_merge_by_key is stable.
+ *
+ *  This version of \p multiway_merge_by_key compares keys using \c operator<.
+ *
+ *  \param key_runs_first The beginning of the sequence of runs of keys.
+ *  \param key_runs_last The end of the sequence of runs of keys.
+ *  \param value_runs_first The beginning of the sequence of the beginnings of the runs of values.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>, and the ordering on it is a
+ *          strict weak ordering, as defined in the <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2's \c value_type is an iterator which is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator3 is mutable.
+ *  \tparam RandomAccessIterator4 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator4 is mutable.
+ *
+ *  \pre Every run of keys shall be sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge_by_key to merge three sorted
+ *  runs of keys and their values:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  ...
+ *  int A_keys[3] = {1, 5, 9};
+ *  int B_keys[4] = {2, 3, 5, 10};
+ *  int C_keys[2] = {0, 5};
+ *
+ *  char A_vals[3] = {'a', 'a', 'a'};
+ *  char B_vals[4] = {'b', 'b', 'b', 'b'};
+ *  char C_vals[2] = {'c', 'c'};
+ *
+ *  thrust::pair<int*,int*> key_runs[3] = {thrust::make_pair(A_keys, A_keys + 3),
+ *                                         thrust::make_pair(B_keys, B_keys + 4),
+ *                                         thrust::make_pair(C_keys, C_keys + 2)};
+ *
+ *  char *value_runs[3] = {A_vals, B_vals, C_vals};
+ *
+ *  int  keys_result[9];
+ *  char vals_result[9];
+ *
+ *  thrust::pair<int*,char*> end =
+ *    thrust::multiway_merge_by_key(key_runs, key_runs + 3, value_runs, keys_result, vals_result);
+ *
+ *  // keys_result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  // vals_result = {'c', 'a', 'b', 'b', 'a', 'b', 'c', 'a', 'b'}
+ *  \endcode
+ *
+ *  \see merge_by_key
+ *  \see multiway_merge
+ *  \see stable_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result);
+
+
+/*! \p multiway_merge_by_key performs a key-value multiway merge. Every element of
+ *  <tt>[key_runs_first, key_runs_last)</tt> is a \p thrust::pair of iterators delimiting a sorted run of
+ *  keys, and the corresponding element of the sequence beginning at \p value_runs_first is an
+ *  iterator to the beginning of the values of that run. The keys of all of the runs are merged as
+ *  by \p multiway_merge into <tt>[keys_result, keys_result + n)</tt>, and each value is copied to the
+ *  position in <tt>[values_result, values_result + n)</tt> of its key. \p multiway_merge_by_key is stable.
+ *
+ *  This version of \p multiway_merge_by_key compares keys using a function object \p comp.
+ *
+ *  \param key_runs_first The beginning of the sequence of runs of keys.
+ *  \param key_runs_last The end of the sequence of runs of keys.
+ *  \param value_runs_first The beginning of the sequence of the beginnings of the runs of values.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a \p thrust::pair of iterators which are models of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *          The \c value_type of these iterators is convertible to \p StrictWeakCompare's \c first_argument_type
+ *          and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2's \c value_type is an iterator which is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator3 is mutable.
+ *  \tparam RandomAccessIterator4 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p RandomAccessIterator4 is mutable.
+ *  \tparam StrictWeakCompare is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every run of keys shall be sorted with respect to \p comp.
+ *  \pre The output ranges shall not overlap any of the runs.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge_by_key to merge three sorted
+ *  runs of keys and their values:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int A_keys[3] = {1, 5, 9};
+ *  int B_keys[4] = {2, 3, 5, 10};
+ *  int C_keys[2] = {0, 5};
+ *
+ *  char A_vals[3] = {'a', 'a', 'a'};
+ *  char B_vals[4] = {'b', 'b', 'b', 'b'};
+ *  char C_vals[2] = {'c', 'c'};
+ *
+ *  thrust::pair<int*,int*> key_runs[3] = {thrust::make_pair(A_keys, A_keys + 3),
+ *                                         thrust::make_pair(B_keys, B_keys + 4),
+ *                                         thrust::make_pair(C_keys, C_keys + 2)};
+ *
+ *  char *value_runs[3] = {A_vals, B_vals, C_vals};
+ *
+ *  int  keys_result[9];
+ *  char vals_result[9];
+ *
+ *  thrust::pair<int*,char*> end =
+ *    thrust::multiway_merge_by_key(key_runs, key_runs + 3, value_runs, keys_result, vals_result, thrust::less<int>());
+ *
+ *  // keys_result = {0, 1, 2, 3, 5, 5, 5, 9, 10}
+ *  // vals_result = {'c', 'a', 'b', 'b', 'a', 'b', 'c', 'a', 'b'}
+ *  \endcode
+ *
+ *  \see merge_by_key
+ *  \see multiway_merge
+ *  \see stable_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp);
+
+
+/*! \} // merging
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/multiway_merge.inl>
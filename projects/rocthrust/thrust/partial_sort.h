@@ -0,0 +1,891 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file partial_sort.h
+ *  \brief Functions for selecting and ordering the smallest or largest elements of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that the element at \p nth
+ *  is the one which would be there if the whole range were sorted, every element before \p nth
+ *  is not greater than it and every element after \p nth is not less than it. The order of the
+ *  elements on either side of \p nth is unspecified.
+ *
+ *  The sequential systems use introselect, which takes linear time on average. The parallel
+ *  systems repeatedly partition the range around two splitters, chosen from a sample to bracket
+ *  \p nth closely, so every round of partitioning discards all but a small fraction of the range.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *
+ *  \pre \p nth shall be in <tt>[first, last]</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find the median of a
+ *  sequence of integers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[7] = {5, 2, 9, 1, 7, 3, 8};
+ *
+ *  thrust::nth_element(thrust::host, A, A + 3, A + 7);
+ *
+ *  // A[3] is now 5, A[0], A[1] and A[2] are {1, 2, 3} in some order,
+ *  // and A[4], A[5] and A[6] are {7, 8, 9} in some order
+ *  \endcode
+ *
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that the element at \p nth
+ *  is the one which would be there if the whole range were sorted, every element before \p nth
+ *  is not greater than it and every element after \p nth is not less than it. The order of the
+ *  elements on either side of \p nth is unspecified.
+ *
+ *  The sequential systems use introselect, which takes linear time on average. The parallel
+ *  systems repeatedly partition the range around two splitters, chosen from a sample to bracket
+ *  \p nth closely, so every round of partitioning discards all but a small fraction of the range.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *
+ *  \pre \p nth shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename RandomAccessIterator>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that the element at \p nth
+ *  is the one which would be there if the whole range were sorted, every element before \p nth
+ *  is not greater than it and every element after \p nth is not less than it. The order of the
+ *  elements on either side of \p nth is unspecified.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre \p nth shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that the element at \p nth
+ *  is the one which would be there if the whole range were sorted, every element before \p nth
+ *  is not greater than it and every element after \p nth is not less than it. The order of the
+ *  elements on either side of \p nth is unspecified.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre \p nth shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that <tt>[first, middle)</tt>
+ *  holds the <tt>middle - first</tt> smallest elements in ascending order. The order of the elements
+ *  of <tt>[middle, last)</tt> is unspecified, as is the relative order of equivalent elements.
+ *
+ *  This selects the smallest elements with \p nth_element and sorts only those, which takes much
+ *  less time than sorting the whole range when <tt>middle - first</tt> is small.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the part of the sequence to order.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *
+ *  \pre \p middle shall be in <tt>[first, last]</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to order the three
+ *  smallest elements of a sequence using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[7] = {5, 2, 9, 1, 7, 3, 8};
+ *
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + 7);
+ *
+ *  // A[0], A[1] and A[2] are now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that <tt>[first, middle)</tt>
+ *  holds the <tt>middle - first</tt> smallest elements in ascending order. The order of the elements
+ *  of <tt>[middle, last)</tt> is unspecified, as is the relative order of equivalent elements.
+ *
+ *  This selects the smallest elements with \p nth_element and sorts only those, which takes much
+ *  less time than sorting the whole range when <tt>middle - first</tt> is small.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the part of the sequence to order.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *
+ *  \pre \p middle shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename RandomAccessIterator>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that <tt>[first, middle)</tt>
+ *  holds the <tt>middle - first</tt> smallest elements in ascending order. The order of the elements
+ *  of <tt>[middle, last)</tt> is unspecified, as is the relative order of equivalent elements.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the part of the sequence to order.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre \p middle shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that <tt>[first, middle)</tt>
+ *  holds the <tt>middle - first</tt> smallest elements in ascending order. The order of the elements
+ *  of <tt>[middle, last)</tt> is unspecified, as is the relative order of equivalent elements.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the part of the sequence to order.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre \p middle shall be in <tt>[first, last]</tt>.
+ *
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the <tt>r = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + r)</tt> in ascending
+ *  order. The input sequence is not modified.
+ *
+ *  On the host systems, small selections keep the best elements of every thread's part of the
+ *  input in a heap, so the input is read once and never copied.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return <tt>result_first + r</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy to copy the three
+ *  smallest elements of a sequence using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[7] = {5, 2, 9, 1, 7, 3, 8};
+ *  int B[3];
+ *
+ *  thrust::partial_sort_copy(thrust::host, A, A + 7, B, B + 3);
+ *
+ *  // B is now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last);
+
+
+/*! \p partial_sort_copy copies the <tt>r = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + r)</tt> in ascending
+ *  order. The input sequence is not modified.
+ *
+ *  On the host systems, small selections keep the best elements of every thread's part of the
+ *  input in a heap, so the input is read once and never copied.
+ *
+ *  The order is defined by \c operator<.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return <tt>result_first + r</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last);
+
+
+/*! \p partial_sort_copy copies the <tt>r = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + r)</tt> in ascending
+ *  order. The input sequence is not modified.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result_first + r</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the <tt>r = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + r)</tt> in ascending
+ *  order. The input sequence is not modified.
+ *
+ *  The order is defined by the function object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result_first + r</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the <tt>r = min(k, last - first)</tt> greatest elements of <tt>[first, last)</tt>
+ *  to <tt>[result, result + r)</tt> in descending order. The input sequence is not modified.
+ *
+ *  This is equivalent to \p partial_sort_copy with \c thrust::greater, and reads the input only
+ *  once on the host systems when \p k is small.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return <tt>result + r</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the three highest scores
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float scores[7] = {5.0f, 2.5f, 9.0f, 1.0f, 7.5f, 3.0f, 8.0f};
+ *  float best[3];
+ *
+ *  thrust::top_k(thrust::host, scores, scores + 7, 3, best);
+ *
+ *  // best is now {9.0f, 8.0f, 7.5f}
+ *  \endcode
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p top_k_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result);
+
+
+/*! \p top_k copies the <tt>r = min(k, last - first)</tt> greatest elements of <tt>[first, last)</tt>
+ *  to <tt>[result, result + r)</tt> in descending order. The input sequence is not modified.
+ *
+ *  This is equivalent to \p partial_sort_copy with \c thrust::greater, and reads the input only
+ *  once on the host systems when \p k is small.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return <tt>result + r</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p top_k_by_key
+ */
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result);
+
+
+/*! \p top_k copies the <tt>r = min(k, last - first)</tt> elements of <tt>[first, last)</tt> which come
+ *  first in the order defined by the function object \p comp to <tt>[result, result + r)</tt>, in that
+ *  order. The input sequence is not modified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result + r</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p top_k_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the <tt>r = min(k, last - first)</tt> elements of <tt>[first, last)</tt> which come
+ *  first in the order defined by the function object \p comp to <tt>[result, result + r)</tt>, in that
+ *  order. The input sequence is not modified.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result + r</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p top_k_by_key
+ */
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the <tt>r = min(k, keys_last - keys_first)</tt> greatest keys of
+ *  <tt>[keys_first, keys_last)</tt> to <tt>[keys_result, keys_result + r)</tt> in descending order, and
+ *  the value at <tt>values_first + i</tt> to \p values_result along with the key at <tt>keys_first + i</tt>.
+ *  The input sequences are not modified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key sequence.
+ *  \param keys_last The end of the input key sequence.
+ *  \param values_first The beginning of the input value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \return A \p pair of iterators <tt>(keys_result + r, values_result + r)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p InputIterator1's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find the two players
+ *  with the highest scores using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int scores[5]  = {50, 90, 20, 70, 10};
+ *  int players[5] = { 0,  1,  2,  3,  4};
+ *  int best_scores[2];
+ *  int best_players[2];
+ *
+ *  thrust::top_k_by_key(thrust::host, scores, scores + 5, players, 2, best_scores, best_players);
+ *
+ *  // best_scores is now  {90, 70}
+ *  // best_players is now { 1,  3}
+ *  \endcode
+ *
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result);
+
+
+/*! \p top_k_by_key copies the <tt>r = min(k, keys_last - keys_first)</tt> greatest keys of
+ *  <tt>[keys_first, keys_last)</tt> to <tt>[keys_result, keys_result + r)</tt> in descending order, and
+ *  the value at <tt>values_first + i</tt> to \p values_result along with the key at <tt>keys_first + i</tt>.
+ *  The input sequences are not modified.
+ *
+ *  \param keys_first The beginning of the input key sequence.
+ *  \param keys_last The end of the input key sequence.
+ *  \param values_first The beginning of the input value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \return A \p pair of iterators <tt>(keys_result + r, values_result + r)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p InputIterator1's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p top_k
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result);
+
+
+/*! \p top_k_by_key copies the <tt>r = min(k, keys_last - keys_first)</tt> keys of
+ *  <tt>[keys_first, keys_last)</tt> which come first in the order defined by the function object \p comp
+ *  to <tt>[keys_result, keys_result + r)</tt> in that order, and the value at <tt>values_first + i</tt>
+ *  to \p values_result along with the key at <tt>keys_first + i</tt>. The input sequences are not modified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key sequence.
+ *  \param keys_last The end of the input key sequence.
+ *  \param values_first The beginning of the input value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \param comp Comparison operator.
+ *  \return A \p pair of iterators <tt>(keys_result + r, values_result + r)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p InputIterator1's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the <tt>r = min(k, keys_last - keys_first)</tt> keys of
+ *  <tt>[keys_first, keys_last)</tt> which come first in the order defined by the function object \p comp
+ *  to <tt>[keys_result, keys_result + r)</tt> in that order, and the value at <tt>values_first + i</tt>
+ *  to \p values_result along with the key at <tt>keys_first + i</tt>. The input sequences are not modified.
+ *
+ *  \param keys_first The beginning of the input key sequence.
+ *  \param keys_last The end of the input key sequence.
+ *  \param values_first The beginning of the input value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \param comp Comparison operator.
+ *  \return A \p pair of iterators <tt>(keys_result + r, values_result + r)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam InputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p InputIterator1's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output sequences shall not overlap.
+ *
+ *  \see \p top_k
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/partial_sort.inl>
+
@@ -0,0 +1,239 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file pipeline.h
+ *  \brief Fuses a chain of transformations, filters and a reduction into
+ *         a single pass over the input
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+template<typename Policy, typename Iterator, typename Stage> class pipeline_range;
+struct pipeline_identity_stage;
+template<typename Function> struct pipeline_transformed;
+template<typename Predicate> struct pipeline_filtered;
+template<typename T, typename BinaryFunction> struct pipeline_reduced;
+struct pipeline_counted;
+template<typename OutputIterator> struct pipeline_copied;
+
+} // end namespace detail
+
+/*! \addtogroup transformed_reductions
+ *  \{
+ */
+
+
+/*! \p pipeline starts a lazy chain of algorithm stages over the range <tt>[first, last)</tt>.
+ *  Stages are appended with <tt>operator|</tt>: \p transformed and \p filtered return a new
+ *  pipeline without touching the input, and a terminal stage (\p reduced, \p counted or
+ *  \p copied) runs the whole chain.
+ *
+ *  The stages of a pipeline are fused into the functor of a single algorithm call, so a chain
+ *  such as <tt>transform</tt>, <tt>copy_if</tt> and <tt>reduce</tt> is executed as one
+ *  \p transform_reduce without any intermediate buffers. \p reduced and \p counted read every
+ *  input element exactly once; \p copied lowers onto \p copy_if and evaluates the stages of an
+ *  element once for its flag and once for its value.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return A pipeline over <tt>[first, last)</tt> without any stages.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p pipeline to sum the squares of the
+ *  positive elements of a sequence using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/execution_policy.h>
+ *
+ *  struct square
+ *  {
+ *    __host__ __device__ int operator()(int x) const { return x * x; }
+ *  };
+ *
+ *  struct is_positive
+ *  {
+ *    __host__ __device__ bool operator()(int x) const { return x > 0; }
+ *  };
+ *  ...
+ *  int data[6] = {-1, 2, -3, 4, -5, 6};
+ *
+ *  int result = thrust::pipeline(thrust::host, data, data + 6)
+ *             | thrust::filtered(is_positive())
+ *             | thrust::transformed(square())
+ *             | thrust::reduced(0);
+ *
+ *  // result is 4 + 16 + 36 = 56
+ *  \endcode
+ *
+ *  \see transform_reduce
+ *  \see transform_iterator
+ */
+template<typename DerivedPolicy, typename InputIterator>
+  thrust::detail::pipeline_range<DerivedPolicy, InputIterator, thrust::detail::pipeline_identity_stage>
+    pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+             InputIterator first,
+             InputIterator last);
+
+
+/*! \p pipeline starts a lazy chain of algorithm stages over the range <tt>[first, last)</tt>.
+ *  The chain is executed by the system of \p InputIterator once a terminal stage is appended.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return A pipeline over <tt>[first, last)</tt> without any stages.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>.
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<int> data = ...;
+ *
+ *  // the number of elements whose square exceeds 100
+ *  size_t n = thrust::pipeline(data.begin(), data.end())
+ *           | thrust::transformed(square())
+ *           | thrust::filtered(greater_than_100())
+ *           | thrust::counted();
+ *  \endcode
+ *
+ *  \see transform_reduce
+ */
+template<typename InputIterator>
+  thrust::detail::pipeline_range<typename thrust::iterator_system<InputIterator>::type,
+                                 InputIterator,
+                                 thrust::detail::pipeline_identity_stage>
+    pipeline(InputIterator first,
+             InputIterator last);
+
+
+/*! \p transformed is a pipeline stage which replaces every element that reaches it with
+ *  <tt>op(x)</tt>. \p op is only invoked on elements which passed all the preceding filters;
+ *  the result type of \p op must be default constructible.
+ *
+ *  \param op The unary function to apply.
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>.
+ *
+ *  \see pipeline
+ */
+template<typename UnaryFunction>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_transformed<UnaryFunction> transformed(UnaryFunction op);
+
+
+/*! \p filtered is a pipeline stage which drops every element for which \p pred is \c false.
+ *
+ *  \param pred The predicate to test elements with.
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam Predicate is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \see pipeline
+ */
+template<typename Predicate>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_filtered<Predicate> filtered(Predicate pred);
+
+
+/*! \p reduced is a terminal pipeline stage which reduces the elements that reach it with
+ *  \p binary_op, starting from \p init, and returns the result. If no element reaches the
+ *  stage, the result is \p init.
+ *
+ *  \param init The initial value of the reduction.
+ *  \param binary_op The associative binary function used to combine elements.
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>,
+ *          and the value type of the elements reaching this stage is convertible to \p T.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \p T.
+ *
+ *  \see pipeline
+ *  \see reduce
+ */
+template<typename T, typename BinaryFunction>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_reduced<T, BinaryFunction> reduced(T init, BinaryFunction binary_op);
+
+
+/*! \p reduced is a terminal pipeline stage which sums the elements that reach it, starting
+ *  from \p init, and returns the result.
+ *
+ *  \param init The initial value of the reduction.
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \see pipeline
+ *  \see reduce
+ */
+template<typename T>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_reduced<T, thrust::plus<T>> reduced(T init);
+
+
+/*! \p counted is a terminal pipeline stage which returns the number of elements that reach it.
+ *
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \see pipeline
+ *  \see count_if
+ */
+THRUST_HOST_DEVICE
+  inline thrust::detail::pipeline_counted counted();
+
+
+/*! \p copied is a terminal pipeline stage which copies the elements that reach it to the range
+ *  beginning at \p result, preserving their relative order, and returns the end of the
+ *  output range.
+ *
+ *  \param result The beginning of the output sequence.
+ *  \return A stage to be appended to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>.
+ *
+ *  \see pipeline
+ *  \see copy_if
+ */
+template<typename OutputIterator>
+THRUST_HOST_DEVICE
+  thrust::detail::pipeline_copied<OutputIterator> copied(OutputIterator result);
+
+
+/*! \} // end transformed_reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/pipeline.inl>
+
@@ -0,0 +1,400 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file run_length_encode.h
+ *  \brief Functions for run-length encoding and decoding sequences
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p run_length_encode compresses the range <tt>[first, last)</tt> into runs: for each group of
+ *  consecutive equal elements, it copies the first element of the group to \p values_output and the
+ *  number of elements in the group to \p counts_output. The number of runs is the distance from
+ *  \p values_output to the first of the returned iterators.
+ *
+ *  This version of \p run_length_encode uses \c operator== to test consecutive elements for equality.
+ *
+ *  This is the result of \p reduce_by_key with a constant value of \c 1 for every element, but the
+ *  host systems compute it without reducing any values: the CPP system encodes the input in a single
+ *  pass, and the OpenMP and TBB systems count the runs of every chunk of the input before encoding
+ *  the chunks in parallel, without storing a flag per element.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at end of the ranges <tt>[values_output, values_output_last)</tt> and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c OutputIterator2's \c value_type is an integral type.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to compress a sequence
+ *  of characters using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 9;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'd', 'd'};
+ *  char values[N];
+ *  int  counts[N];
+ *
+ *  thrust::pair<char*,int*> new_end;
+ *  new_end = thrust::run_length_encode(thrust::host, input, input + N, values, counts);
+ *
+ *  // The first five values are now {'a', 'b', 'c', 'a', 'd'} and new_end.first - values is 5.
+ *  // The first five counts are now {2, 1, 3, 1, 2} and new_end.second - counts is 5.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see unique_count
+ *  \see run_length_decode
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output);
+
+
+/*! \p run_length_encode compresses the range <tt>[first, last)</tt> into runs: for each group of
+ *  consecutive equal elements, it copies the first element of the group to \p values_output and the
+ *  number of elements in the group to \p counts_output. The number of runs is the distance from
+ *  \p values_output to the first of the returned iterators.
+ *
+ *  This version of \p run_length_encode uses the function object \p binary_pred to test for equality,
+ *  so \p binary_pred shall be an equivalence relation.
+ *
+ *  This is the result of \p reduce_by_key with a constant value of \c 1 for every element, but the
+ *  host systems compute it without reducing any values: the CPP system encodes the input in a single
+ *  pass, and the OpenMP and TBB systems count the runs of every chunk of the input before encoding
+ *  the chunks in parallel, without storing a flag per element.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[values_output, values_output_last)</tt> and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c OutputIterator2's \c value_type is an integral type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to compress a sequence
+ *  of characters using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 9;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'd', 'd'};
+ *  char values[N];
+ *  int  counts[N];
+ *
+ *  thrust::equal_to<char> binary_pred;
+ *  thrust::pair<char*,int*> new_end;
+ *  new_end = thrust::run_length_encode(thrust::host, input, input + N, values, counts, binary_pred);
+ *
+ *  // The first five values are now {'a', 'b', 'c', 'a', 'd'} and new_end.first - values is 5.
+ *  // The first five counts are now {2, 1, 3, 1, 2} and new_end.second - counts is 5.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see unique_count
+ *  \see run_length_decode
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred);
+
+
+/*! \p run_length_encode compresses the range <tt>[first, last)</tt> into runs: for each group of
+ *  consecutive equal elements, it copies the first element of the group to \p values_output and the
+ *  number of elements in the group to \p counts_output. The number of runs is the distance from
+ *  \p values_output to the first of the returned iterators.
+ *
+ *  This version of \p run_length_encode uses \c operator== to test consecutive elements for equality.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at end of the ranges <tt>[values_output, values_output_last)</tt> and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c OutputIterator2's \c value_type is an integral type.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to compress a sequence
+ *  of characters:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  ...
+ *  const int N = 9;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'd', 'd'};
+ *  char values[N];
+ *  int  counts[N];
+ *
+ *  thrust::pair<char*,int*> new_end;
+ *  new_end = thrust::run_length_encode(input, input + N, values, counts);
+ *
+ *  // The first five values are now {'a', 'b', 'c', 'a', 'd'} and new_end.first - values is 5.
+ *  // The first five counts are now {2, 1, 3, 1, 2} and new_end.second - counts is 5.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see unique_count
+ *  \see run_length_decode
+ */
+template<typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output);
+
+
+/*! \p run_length_encode compresses the range <tt>[first, last)</tt> into runs: for each group of
+ *  consecutive equal elements, it copies the first element of the group to \p values_output and the
+ *  number of elements in the group to \p counts_output. The number of runs is the distance from
+ *  \p values_output to the first of the returned iterators.
+ *
+ *  This version of \p run_length_encode uses the function object \p binary_pred to test for equality,
+ *  so \p binary_pred shall be an equivalence relation.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[values_output, values_output_last)</tt> and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \c OutputIterator2's \c value_type is an integral type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to compress a sequence
+ *  of characters:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 9;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'd', 'd'};
+ *  char values[N];
+ *  int  counts[N];
+ *
+ *  thrust::equal_to<char> binary_pred;
+ *  thrust::pair<char*,int*> new_end;
+ *  new_end = thrust::run_length_encode(input, input + N, values, counts, binary_pred);
+ *
+ *  // The first five values are now {'a', 'b', 'c', 'a', 'd'} and new_end.first - values is 5.
+ *  // The first five counts are now {2, 1, 3, 1, 2} and new_end.second - counts is 5.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see unique_count
+ *  \see run_length_decode
+ */
+template<typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred);
+
+
+/*! \p run_length_decode expands the runs produced by \p run_length_encode: for each value in
+ *  <tt>[values_first, values_last)</tt>, it writes <tt>counts_first[i]</tt> copies of <tt>values_first[i]</tt>
+ *  to the output, in order. The decoded sequence holds the sum of the counts, which can be found
+ *  beforehand with \p reduce.
+ *
+ *  The OpenMP and TBB systems find the position of every run with a parallel prefix sum of the
+ *  counts and then split the output evenly over the threads, so that long runs are written by
+ *  several threads.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of run values.
+ *  \param values_last The end of the sequence of run values.
+ *  \param counts_first The beginning of the sequence of run lengths.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator3's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3 is mutable.
+ *
+ *  \pre The counts shall not be negative.
+ *  \pre The output range shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_decode to expand a sequence
+ *  of runs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  char values[3] = {'a', 'b', 'c'};
+ *  int  counts[3] = {2, 0, 3};
+ *  char output[5];
+ *
+ *  char *output_end = thrust::run_length_decode(thrust::host, values, values + 3, counts, output);
+ *
+ *  // output is now {'a', 'a', 'c', 'c', 'c'} and output_end - output is 5.
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 run_length_decode(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result);
+
+
+/*! \p run_length_decode expands the runs produced by \p run_length_encode: for each value in
+ *  <tt>[values_first, values_last)</tt>, it writes <tt>counts_first[i]</tt> copies of <tt>values_first[i]</tt>
+ *  to the output, in order. The decoded sequence holds the sum of the counts, which can be found
+ *  beforehand with \p reduce.
+ *
+ *  \param values_first The beginning of the sequence of run values.
+ *  \param values_last The end of the sequence of run values.
+ *  \param counts_first The beginning of the sequence of run lengths.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator3's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3 is mutable.
+ *
+ *  \pre The counts shall not be negative.
+ *  \pre The output range shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_decode to expand a sequence
+ *  of runs:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  ...
+ *  char values[3] = {'a', 'b', 'c'};
+ *  int  counts[3] = {2, 0, 3};
+ *  char output[5];
+ *
+ *  char *output_end = thrust::run_length_decode(values, values + 3, counts, output);
+ *
+ *  // output is now {'a', 'a', 'c', 'c', 'c'} and output_end - output is 5.
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 run_length_decode(RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/run_length_encode.inl>
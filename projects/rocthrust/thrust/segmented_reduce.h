@@ -0,0 +1,630 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file segmented_reduce.h
+ *  \brief Functions for reducing many independent segments of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the sum of the values of the segment, computed with <tt>operator+</tt>
+ *  and starting from \c 0; an empty segment produces \c 0.
+ *
+ *  Unlike \p reduce_by_key, \p segmented_reduce needs no key per value and performs no key
+ *  comparisons, because the boundaries of the segments are given explicitly. On the host systems
+ *  the values and segments are split evenly over the threads, so that long segments are reduced
+ *  by many threads and runs of short segments are batched into one.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and if \c x and \c y are objects of \p RandomAccessIterator1's \c value_type,
+ *          then <tt>x + y</tt> is defined and is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum the values of
+ *  three segments using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(thrust::host, values, offsets, offsets + 4, result);
+ *
+ *  // result is now {1, 0, 8}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result);
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the sum of \p init and the values of the segment, computed with
+ *  <tt>operator+</tt>; an empty segment produces \p init.
+ *
+ *  Unlike \p reduce_by_key, \p segmented_reduce needs no key per value and performs no key
+ *  comparisons, because the boundaries of the segments are given explicitly. On the host systems
+ *  the values and segments are split evenly over the threads, so that long segments are reduced
+ *  by many threads and runs of short segments are batched into one.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param init The value each segment's reduction starts from.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and if \c x and \c y are objects of \p RandomAccessIterator1's \c value_type,
+ *          then <tt>x + y</tt> is defined and is convertible to \p T.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum the values of
+ *  three segments using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(thrust::host, values, offsets, offsets + 4, result, 1);
+ *
+ *  // result is now {2, 1, 9}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init);
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the generalized sum of \p init and the values of the segment, computed
+ *  with \p binary_op; an empty segment produces \p init.
+ *
+ *  Unlike \p reduce_by_key, \p segmented_reduce needs no key per value and performs no key
+ *  comparisons, because the boundaries of the segments are given explicitly. On the host systems
+ *  the values and segments are split evenly over the threads, so that long segments are reduced
+ *  by many threads and runs of short segments are batched into one.
+ *
+ *  Note that \p segmented_reduce assumes \p binary_op is associative, but not commutative: the values
+ *  of a segment are always combined in order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param init The value each segment's reduction starts from.
+ *  \param binary_op The binary function used to combine the values.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p BinaryFunction's second argument type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is convertible to \p BinaryFunction's first argument type.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \p BinaryFunction's \c result_type is convertible to \p T.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to find the largest value
+ *  of three segments using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(thrust::host, values, offsets, offsets + 4, result, -1, thrust::maximum<int>());
+ *
+ *  // result is now {1, -1, 3}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op);
+
+
+/*! \p segmented_transform_reduce applies \p unary_op to every value of the range beginning at
+ *  \p values_first and reduces every segment of the transformed values to a single value, independently
+ *  of the other segments, writing the result of segment \c i to <tt>result[i]</tt>. The segments are
+ *  described by the sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the generalized sum of \p init and the transformed values of the
+ *  segment, computed with \p binary_op; an empty segment produces \p init. No intermediate sequence
+ *  of transformed values is stored.
+ *
+ *  Note that \p segmented_transform_reduce assumes \p binary_op is associative, but not commutative:
+ *  the values of a segment are always combined in order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param unary_op The function used to transform the values.
+ *  \param init The value each segment's reduction starts from.
+ *  \param binary_op The binary function used to combine the transformed values.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p UnaryFunction's argument type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>
+ *          and \p UnaryFunction's \c result_type is convertible to \p BinaryFunction's second argument type.
+ *  \tparam T is convertible to \p BinaryFunction's first argument type.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \p BinaryFunction's \c result_type is convertible to \p T.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_transform_reduce to compute the
+ *  sum of squares of three segments using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct square
+ *  {
+ *    __host__ __device__
+ *    int operator()(int x) const
+ *    {
+ *      return x * x;
+ *    }
+ *  };
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_transform_reduce(thrust::host, values, offsets, offsets + 4, result,
+ *                                     square(), 0, thrust::plus<int>());
+ *
+ *  // result is now {1, 0, 18}
+ *  \endcode
+ *
+ *  \see \p transform_reduce
+ *  \see \p segmented_reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_transform_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op);
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the sum of the values of the segment, computed with <tt>operator+</tt>
+ *  and starting from \c 0; an empty segment produces \c 0.
+ *
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and if \c x and \c y are objects of \p RandomAccessIterator1's \c value_type,
+ *          then <tt>x + y</tt> is defined and is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum the values of
+ *  three segments:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(values, offsets, offsets + 4, result);
+ *
+ *  // result is now {1, 0, 8}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result);
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the sum of \p init and the values of the segment, computed with
+ *  <tt>operator+</tt>; an empty segment produces \p init.
+ *
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param init The value each segment's reduction starts from.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and if \c x and \c y are objects of \p RandomAccessIterator1's \c value_type,
+ *          then <tt>x + y</tt> is defined and is convertible to \p T.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum the values of
+ *  three segments:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(values, offsets, offsets + 4, result, 1);
+ *
+ *  // result is now {2, 1, 9}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result,
+                     T init);
+
+
+/*! \p segmented_reduce reduces every segment of the range beginning at \p values_first to a single
+ *  value, independently of the other segments, and writes the result of segment \c i to <tt>result[i]</tt>.
+ *  The segments are described by the sequence of <tt>num_segments + 1</tt> offsets
+ *  <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the generalized sum of \p init and the values of the segment, computed
+ *  with \p binary_op; an empty segment produces \p init.
+ *
+ *  Note that \p segmented_reduce assumes \p binary_op is associative, but not commutative: the values
+ *  of a segment are always combined in order.
+ *
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param init The value each segment's reduction starts from.
+ *  \param binary_op The binary function used to combine the values.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p BinaryFunction's second argument type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is convertible to \p BinaryFunction's first argument type.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \p BinaryFunction's \c result_type is convertible to \p T.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to find the largest value
+ *  of three segments:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_reduce(values, offsets, offsets + 4, result, -1, thrust::maximum<int>());
+ *
+ *  // result is now {1, -1, 3}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *  \see \p segmented_transform_reduce
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_reduce(RandomAccessIterator1 values_first,
+                     RandomAccessIterator2 offsets_first,
+                     RandomAccessIterator2 offsets_last,
+                     OutputIterator result,
+                     T init,
+                     BinaryFunction binary_op);
+
+
+/*! \p segmented_transform_reduce applies \p unary_op to every value of the range beginning at
+ *  \p values_first and reduces every segment of the transformed values to a single value, independently
+ *  of the other segments, writing the result of segment \c i to <tt>result[i]</tt>. The segments are
+ *  described by the sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[values_first + offsets_first[i], values_first + offsets_first[i + 1])</tt>.
+ *
+ *  The result of segment \c i is the generalized sum of \p init and the transformed values of the
+ *  segment, computed with \p binary_op; an empty segment produces \p init. No intermediate sequence
+ *  of transformed values is stored.
+ *
+ *  Note that \p segmented_transform_reduce assumes \p binary_op is associative, but not commutative:
+ *  the values of a segment are always combined in order.
+ *
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param result The beginning of the sequence of segment results.
+ *  \param unary_op The function used to transform the values.
+ *  \param init The value each segment's reduction starts from.
+ *  \param binary_op The binary function used to combine the transformed values.
+ *  \return The end of the sequence of segment results, <tt>result + num_segments</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p UnaryFunction's argument type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>
+ *          and \p T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>
+ *          and \p UnaryFunction's \c result_type is convertible to \p BinaryFunction's second argument type.
+ *  \tparam T is convertible to \p BinaryFunction's first argument type.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \p BinaryFunction's \c result_type is convertible to \p T.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The range <tt>[result, result + num_segments)</tt> shall not overlap the range <tt>[values_first + offsets_first[0], values_first + offsets_first[num_segments])</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_transform_reduce to compute the
+ *  sum of squares of three segments:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  struct square
+ *  {
+ *    __host__ __device__
+ *    int operator()(int x) const
+ *    {
+ *      return x * x;
+ *    }
+ *  };
+ *  ...
+ *  int values[6]  = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int result[3];
+ *
+ *  // segments [0, 2), [2, 2) and [2, 6)
+ *  thrust::segmented_transform_reduce(values, offsets, offsets + 4, result,
+ *                                     square(), 0, thrust::plus<int>());
+ *
+ *  // result is now {1, 0, 18}
+ *  \endcode
+ *
+ *  \see \p transform_reduce
+ *  \see \p segmented_reduce
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    OutputIterator
+  >::type
+    segmented_transform_reduce(RandomAccessIterator1 values_first,
+                               RandomAccessIterator2 offsets_first,
+                               RandomAccessIterator2 offsets_last,
+                               OutputIterator result,
+                               UnaryFunction unary_op,
+                               T init,
+                               BinaryFunction binary_op);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_reduce.inl>
@@ -0,0 +1,450 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file segmented_sort.h
+ *  \brief Functions for sorting many independent segments of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p segmented_sort sorts every segment of the range <tt>[keys_first, keys_last)</tt> into
+ *  ascending order, independently of the other segments. The segments are described by the
+ *  sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys outside of every segment are left untouched.
+ *
+ *  This is equivalent to calling \p sort on every segment, but is much faster than doing so when
+ *  there are many segments. On the host systems the short segments are distributed evenly over
+ *  the threads and sorted sequentially, while the long ones are sorted by the parallel \p sort.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator1's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort three segments
+ *  of integers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[8]    = {3, 1, 2, 9, 7, 8, 5, 4};
+ *  int offsets[4] = {0, 3, 3, 8};
+ *
+ *  // segments [0, 3), [3, 3) and [3, 8)
+ *  thrust::segmented_sort(thrust::host, keys, keys + 8, offsets, offsets + 4);
+ *
+ *  // keys is now {1, 2, 3, 4, 5, 7, 8, 9}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last);
+
+
+/*! \p segmented_sort sorts every segment of the range <tt>[keys_first, keys_last)</tt> into
+ *  ascending order, independently of the other segments. The segments are described by the
+ *  sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by \c operator<.
+ *
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator1's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void segmented_sort(RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last);
+
+
+/*! \p segmented_sort sorts every segment of the range <tt>[keys_first, keys_last)</tt> into
+ *  ascending order, independently of the other segments. The segments are described by the
+ *  sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by the function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort the event times of
+ *  every user in descending order using the \p thrust::device execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  thrust::device_vector<float> times = ...;
+ *
+ *  // the events of user i are [user_offsets[i], user_offsets[i + 1])
+ *  thrust::device_vector<int> user_offsets = ...;
+ *
+ *  thrust::segmented_sort(thrust::device,
+ *                         times.begin(), times.end(),
+ *                         user_offsets.begin(), user_offsets.end(),
+ *                         thrust::greater<float>());
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort sorts every segment of the range <tt>[keys_first, keys_last)</tt> into
+ *  ascending order, independently of the other segments. The segments are described by the
+ *  sequence of <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by the function object \p comp.
+ *
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void segmented_sort(RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of every segment of the range
+ *  <tt>[keys_first, keys_last)</tt>, independently of the other segments: the keys of each segment
+ *  are sorted into ascending order, and the value at <tt>values_first + i</tt> is moved along with
+ *  the key at <tt>keys_first + i</tt>. The segments are described by the sequence of
+ *  <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys and values outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator1's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort two
+ *  segments of key-value pairs using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int  keys[6]    = {3, 1, 2,   9, 4, 5};
+ *  char values[6]  = {'a', 'b', 'c', 'd', 'e', 'f'};
+ *  int  offsets[3] = {0, 3, 6};
+ *
+ *  thrust::segmented_sort_by_key(thrust::host, keys, keys + 6, values, offsets, offsets + 3);
+ *
+ *  // keys is now   {  1,   2,   3,   4,   5,   9}
+ *  // values is now {'b', 'c', 'a', 'e', 'f', 'd'}
+ *  \endcode
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of every segment of the range
+ *  <tt>[keys_first, keys_last)</tt>, independently of the other segments: the keys of each segment
+ *  are sorted into ascending order, and the value at <tt>values_first + i</tt> is moved along with
+ *  the key at <tt>keys_first + i</tt>. The segments are described by the sequence of
+ *  <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys and values outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by \c operator<.
+ *
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>,
+ *          and the ordering relation on \p RandomAccessIterator1's \c value_type is a <em>strict weak ordering</em>, as defined in the
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> requirements.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of every segment of the range
+ *  <tt>[keys_first, keys_last)</tt>, independently of the other segments: the keys of each segment
+ *  are sorted into ascending order, and the value at <tt>values_first + i</tt> is moved along with
+ *  the key at <tt>keys_first + i</tt>. The segments are described by the sequence of
+ *  <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys and values outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by the function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of every segment of the range
+ *  <tt>[keys_first, keys_last)</tt>, independently of the other segments: the keys of each segment
+ *  are sorted into ascending order, and the value at <tt>values_first + i</tt> is moved along with
+ *  the key at <tt>keys_first + i</tt>. The segments are described by the sequence of
+ *  <tt>num_segments + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>: segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *  Keys and values outside of every segment are left untouched.
+ *
+ *  The relative order of equivalent elements within a segment is not guaranteed to be preserved,
+ *  and the order is defined by the function object \p comp.
+ *
+ *  \param keys_first The beginning of the sequence of keys.
+ *  \param keys_last The end of the sequence of keys.
+ *  \param values_first The beginning of the sequence of values.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and <tt>offsets_first[num_segments]</tt> shall not exceed <tt>keys_last - keys_first</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_sort.inl>
+
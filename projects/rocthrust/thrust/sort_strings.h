@@ -0,0 +1,164 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file sort_strings.h
+ *  \brief Functions for sorting variable-length strings
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p sort_strings computes the permutation which sorts a set of variable-length strings into
+ *  lexicographical order. The strings are stored back to back in a character buffer, and are
+ *  described by the sequence of <tt>num_strings + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  string \c i is <tt>[chars_first + offsets_first[i], chars_first + offsets_first[i + 1])</tt>.
+ *  The strings themselves are not moved; instead, <tt>permutation_out[j]</tt> is set to the index
+ *  of the <tt>j</tt>-th smallest string.
+ *
+ *  Characters are compared as <tt>unsigned char</tt>, like \c std::memcmp, and a string sorts
+ *  before every longer string of which it is a prefix. Strings may contain <tt>'\\0'</tt>
+ *  characters. The sort is stable: equal strings appear in the permutation in the order of their
+ *  indices.
+ *
+ *  Unlike a comparison sort of the strings through the permutation, \p sort_strings never
+ *  compares the characters of a common prefix more than once. The CPP system caches 7 characters
+ *  of every string at a time, distributes large ranges of strings into buckets by their next
+ *  character with a most significant digit radix sort, and finishes small ranges with a multikey
+ *  quicksort. The OpenMP and TBB systems sort the strings by their first characters in parallel,
+ *  and then sort the groups of strings sharing those characters concurrently.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param chars_first The beginning of the character buffer.
+ *  \param offsets_first The beginning of the sequence of offsets.
+ *  \param offsets_last The end of the sequence of offsets.
+ *  \param permutation_out The beginning of the output permutation.
+ *  \return The end of the output permutation, <tt>permutation_out + num_strings</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator1's \c value_type is a character type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam RandomAccessIterator3 is mutable and a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator3's \c value_type is an integral type able to represent \c num_strings.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The permutation <tt>[permutation_out, permutation_out + num_strings)</tt> shall not overlap the characters or the offsets.
+ *
+ *  The following code snippet demonstrates how to use \p sort_strings to sort a few words
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort_strings.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const char chars[] = "pearapplepeachapple";
+ *  int offsets[5]     = {0, 4, 9, 14, 19};
+ *  int permutation[4];
+ *
+ *  thrust::sort_strings(thrust::host, chars, offsets, offsets + 5, permutation);
+ *
+ *  // permutation is now {1, 3, 2, 0}, which is "apple", "apple", "peach", "pear"
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p stable_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 sort_strings(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                     RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out);
+
+
+/*! \p sort_strings computes the permutation which sorts a set of variable-length strings into
+ *  lexicographical order. The strings are stored back to back in a character buffer, and are
+ *  described by the sequence of <tt>num_strings + 1</tt> offsets <tt>[offsets_first, offsets_last)</tt>:
+ *  string \c i is <tt>[chars_first + offsets_first[i], chars_first + offsets_first[i + 1])</tt>.
+ *  The strings themselves are not moved; instead, <tt>permutation_out[j]</tt> is set to the index
+ *  of the <tt>j</tt>-th smallest string.
+ *
+ *  Characters are compared as <tt>unsigned char</tt>, like \c std::memcmp, and a string sorts
+ *  before every longer string of which it is a prefix. Strings may contain <tt>'\\0'</tt>
+ *  characters. The sort is stable: equal strings appear in the permutation in the order of their
+ *  indices.
+ *
+ *  \param chars_first The beginning of the character buffer.
+ *  \param offsets_first The beginning of the sequence of offsets.
+ *  \param offsets_last The end of the sequence of offsets.
+ *  \param permutation_out The beginning of the output permutation.
+ *  \return The end of the output permutation, <tt>permutation_out + num_strings</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator1's \c value_type is a character type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \c RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam RandomAccessIterator3 is mutable and a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator3's \c value_type is an integral type able to represent \c num_strings.
+ *
+ *  \pre The offsets shall be in ascending order.
+ *  \pre The permutation <tt>[permutation_out, permutation_out + num_strings)</tt> shall not overlap the characters or the offsets.
+ *
+ *  The following code snippet demonstrates how to use \p sort_strings to sort URLs stored
+ *  in device memory:
+ *
+ *  \code
+ *  #include <thrust/sort_strings.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<char> chars = ...;   // the characters of all URLs
+ *  thrust::device_vector<int>  offsets = ...; // num_urls + 1 offsets into chars
+ *  thrust::device_vector<int>  permutation(offsets.size() - 1);
+ *
+ *  thrust::sort_strings(chars.begin(), offsets.begin(), offsets.end(), permutation.begin());
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p stable_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 sort_strings(RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out);
+
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/sort_strings.inl>
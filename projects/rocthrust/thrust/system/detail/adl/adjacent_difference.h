@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/adjacent_difference.h>
 #include <thrust/system/hip/detail/adjacent_difference.h>
 #include <thrust/system/omp/detail/adjacent_difference.h>
+#include <thrust/system/stdpar/detail/adjacent_difference.h>
 #include <thrust/system/tbb/detail/adjacent_difference.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/assign_value.h>
 #include <thrust/system/hip/detail/assign_value.h>
 #include <thrust/system/omp/detail/assign_value.h>
+#include <thrust/system/stdpar/detail/assign_value.h>
 #include <thrust/system/tbb/detail/assign_value.h>
 #endif
 
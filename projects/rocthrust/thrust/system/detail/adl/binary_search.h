@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/binary_search.h>
 #include <thrust/system/hip/detail/binary_search.h>
 #include <thrust/system/omp/detail/binary_search.h>
+#include <thrust/system/stdpar/detail/binary_search.h>
 #include <thrust/system/tbb/detail/binary_search.h>
 #endif
 
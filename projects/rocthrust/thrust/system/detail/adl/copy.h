@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/copy.h>
 #include <thrust/system/hip/detail/copy.h>
 #include <thrust/system/omp/detail/copy.h>
+#include <thrust/system/stdpar/detail/copy.h>
 #include <thrust/system/tbb/detail/copy.h>
 #endif
 
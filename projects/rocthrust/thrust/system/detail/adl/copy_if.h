@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/copy_if.h>
 #include <thrust/system/hip/detail/copy_if.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/stdpar/detail/copy_if.h>
 #include <thrust/system/tbb/detail/copy_if.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/count.h>
 #include <thrust/system/hip/detail/count.h>
 #include <thrust/system/omp/detail/count.h>
+#include <thrust/system/stdpar/detail/count.h>
 #include <thrust/system/tbb/detail/count.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/equal.h>
 #include <thrust/system/hip/detail/equal.h>
 #include <thrust/system/omp/detail/equal.h>
+#include <thrust/system/stdpar/detail/equal.h>
 #include <thrust/system/tbb/detail/equal.h>
 #endif
 
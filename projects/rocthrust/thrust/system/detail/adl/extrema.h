@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/extrema.h>
 #include <thrust/system/hip/detail/extrema.h>
 #include <thrust/system/omp/detail/extrema.h>
+#include <thrust/system/stdpar/detail/extrema.h>
 #include <thrust/system/tbb/detail/extrema.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/fill.h>
 #include <thrust/system/hip/detail/fill.h>
 #include <thrust/system/omp/detail/fill.h>
+#include <thrust/system/stdpar/detail/fill.h>
 #include <thrust/system/tbb/detail/fill.h>
 #endif
 
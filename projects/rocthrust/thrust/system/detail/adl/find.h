@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/find.h>
 #include <thrust/system/hip/detail/find.h>
 #include <thrust/system/omp/detail/find.h>
+#include <thrust/system/stdpar/detail/find.h>
 #include <thrust/system/tbb/detail/find.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/for_each.h>
 #include <thrust/system/hip/detail/for_each.h>
 #include <thrust/system/omp/detail/for_each.h>
+#include <thrust/system/stdpar/detail/for_each.h>
 #include <thrust/system/tbb/detail/for_each.h>
 #endif
 
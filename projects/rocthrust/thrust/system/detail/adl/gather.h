@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/gather.h>
 #include <thrust/system/hip/detail/gather.h>
 #include <thrust/system/omp/detail/gather.h>
+#include <thrust/system/stdpar/detail/gather.h>
 #include <thrust/system/tbb/detail/gather.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/generate.h>
 #include <thrust/system/hip/detail/generate.h>
 #include <thrust/system/omp/detail/generate.h>
+#include <thrust/system/stdpar/detail/generate.h>
 #include <thrust/system/tbb/detail/generate.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/get_value.h>
 #include <thrust/system/hip/detail/get_value.h>
 #include <thrust/system/omp/detail/get_value.h>
+#include <thrust/system/stdpar/detail/get_value.h>
 #include <thrust/system/tbb/detail/get_value.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/inner_product.h>
 #include <thrust/system/hip/detail/inner_product.h>
 #include <thrust/system/omp/detail/inner_product.h>
+#include <thrust/system/stdpar/detail/inner_product.h>
 #include <thrust/system/tbb/detail/inner_product.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/iter_swap.h>
 #include <thrust/system/hip/detail/iter_swap.h>
 #include <thrust/system/omp/detail/iter_swap.h>
+#include <thrust/system/stdpar/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/logical.h>
 #include <thrust/system/hip/detail/logical.h>
 #include <thrust/system/omp/detail/logical.h>
+#include <thrust/system/stdpar/detail/logical.h>
 #include <thrust/system/tbb/detail/logical.h>
 #endif
 
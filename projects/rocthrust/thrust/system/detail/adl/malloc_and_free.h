@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/malloc_and_free.h>
 #include <thrust/system/hip/detail/malloc_and_free.h>
 #include <thrust/system/omp/detail/malloc_and_free.h>
+#include <thrust/system/stdpar/detail/malloc_and_free.h>
 #include <thrust/system/tbb/detail/malloc_and_free.h>
 #endif
 
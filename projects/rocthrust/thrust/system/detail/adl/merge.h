@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/merge.h>
 #include <thrust/system/hip/detail/merge.h>
 #include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/stdpar/detail/merge.h>
 #include <thrust/system/tbb/detail/merge.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/mismatch.h>
 #include <thrust/system/hip/detail/mismatch.h>
 #include <thrust/system/omp/detail/mismatch.h>
+#include <thrust/system/stdpar/detail/mismatch.h>
 #include <thrust/system/tbb/detail/mismatch.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/partition.h>
 #include <thrust/system/hip/detail/partition.h>
 #include <thrust/system/omp/detail/partition.h>
+#include <thrust/system/stdpar/detail/partition.h>
 #include <thrust/system/tbb/detail/partition.h>
 #endif
 
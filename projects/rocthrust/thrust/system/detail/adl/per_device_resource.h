@@ -28,6 +28,7 @@
 #include <thrust/system/cpp/detail/per_device_resource.h>
 #include <thrust/system/cuda/detail/per_device_resource.h>
 #include <thrust/system/omp/detail/per_device_resource.h>
+#include <thrust/system/stdpar/detail/per_device_resource.h>
 #include <thrust/system/tbb/detail/per_device_resource.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/reduce.h>
 #include <thrust/system/hip/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce.h>
+#include <thrust/system/stdpar/detail/reduce.h>
 #include <thrust/system/tbb/detail/reduce.h>
 #endif
 
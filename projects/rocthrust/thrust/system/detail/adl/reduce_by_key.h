@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/reduce_by_key.h>
 #include <thrust/system/hip/detail/reduce_by_key.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
+#include <thrust/system/stdpar/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/remove.h>
 #include <thrust/system/hip/detail/remove.h>
 #include <thrust/system/omp/detail/remove.h>
+#include <thrust/system/stdpar/detail/remove.h>
 #include <thrust/system/tbb/detail/remove.h>
 #endif
 
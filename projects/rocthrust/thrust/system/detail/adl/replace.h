@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/replace.h>
 #include <thrust/system/hip/detail/replace.h>
 #include <thrust/system/omp/detail/replace.h>
+#include <thrust/system/stdpar/detail/replace.h>
 #include <thrust/system/tbb/detail/replace.h>
 #endif
 
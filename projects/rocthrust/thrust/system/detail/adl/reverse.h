@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/reverse.h>
 #include <thrust/system/hip/detail/reverse.h>
 #include <thrust/system/omp/detail/reverse.h>
+#include <thrust/system/stdpar/detail/reverse.h>
 #include <thrust/system/tbb/detail/reverse.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/scan.h>
 #include <thrust/system/hip/detail/scan.h>
 #include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/stdpar/detail/scan.h>
 #include <thrust/system/tbb/detail/scan.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/scan_by_key.h>
 #include <thrust/system/hip/detail/scan_by_key.h>
 #include <thrust/system/omp/detail/scan_by_key.h>
+#include <thrust/system/stdpar/detail/scan_by_key.h>
 #include <thrust/system/tbb/detail/scan_by_key.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/scatter.h>
 #include <thrust/system/hip/detail/scatter.h>
 #include <thrust/system/omp/detail/scatter.h>
+#include <thrust/system/stdpar/detail/scatter.h>
 #include <thrust/system/tbb/detail/scatter.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/sequence.h>
 #include <thrust/system/hip/detail/sequence.h>
 #include <thrust/system/omp/detail/sequence.h>
+#include <thrust/system/stdpar/detail/sequence.h>
 #include <thrust/system/tbb/detail/sequence.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/set_operations.h>
 #include <thrust/system/hip/detail/set_operations.h>
 #include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/stdpar/detail/set_operations.h>
 #include <thrust/system/tbb/detail/set_operations.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/sort.h>
 #include <thrust/system/hip/detail/sort.h>
 #include <thrust/system/omp/detail/sort.h>
+#include <thrust/system/stdpar/detail/sort.h>
 #include <thrust/system/tbb/detail/sort.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/swap_ranges.h>
 #include <thrust/system/hip/detail/swap_ranges.h>
 #include <thrust/system/omp/detail/swap_ranges.h>
+#include <thrust/system/stdpar/detail/swap_ranges.h>
 #include <thrust/system/tbb/detail/swap_ranges.h>
 #endif
 
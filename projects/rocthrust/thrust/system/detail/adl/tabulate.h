@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/tabulate.h>
 #include <thrust/system/hip/detail/tabulate.h>
 #include <thrust/system/omp/detail/tabulate.h>
+#include <thrust/system/stdpar/detail/tabulate.h>
 #include <thrust/system/tbb/detail/tabulate.h>
 #endif
 
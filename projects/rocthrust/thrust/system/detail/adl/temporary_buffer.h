@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/temporary_buffer.h>
 #include <thrust/system/hip/detail/temporary_buffer.h>
 #include <thrust/system/omp/detail/temporary_buffer.h>
+#include <thrust/system/stdpar/detail/temporary_buffer.h>
 #include <thrust/system/tbb/detail/temporary_buffer.h>
 #endif
 
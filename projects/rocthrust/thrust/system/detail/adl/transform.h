@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/transform.h>
 #include <thrust/system/hip/detail/transform.h>
 #include <thrust/system/omp/detail/transform.h>
+#include <thrust/system/stdpar/detail/transform.h>
 #include <thrust/system/tbb/detail/transform.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/transform_reduce.h>
 #include <thrust/system/hip/detail/transform_reduce.h>
 #include <thrust/system/omp/detail/transform_reduce.h>
+#include <thrust/system/stdpar/detail/transform_reduce.h>
 #include <thrust/system/tbb/detail/transform_reduce.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/transform_scan.h>
 #include <thrust/system/hip/detail/transform_scan.h>
 #include <thrust/system/omp/detail/transform_scan.h>
+#include <thrust/system/stdpar/detail/transform_scan.h>
 #include <thrust/system/tbb/detail/transform_scan.h>
 #endif
 
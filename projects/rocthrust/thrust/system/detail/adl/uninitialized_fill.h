@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/uninitialized_fill.h>
 #include <thrust/system/hip/detail/uninitialized_fill.h>
 #include <thrust/system/omp/detail/uninitialized_fill.h>
+#include <thrust/system/stdpar/detail/uninitialized_fill.h>
 #include <thrust/system/tbb/detail/uninitialized_fill.h>
 #endif
 
@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/unique.h>
 #include <thrust/system/hip/detail/unique.h>
 #include <thrust/system/omp/detail/unique.h>
+#include <thrust/system/stdpar/detail/unique.h>
 #include <thrust/system/tbb/detail/unique.h>
 #endif
 
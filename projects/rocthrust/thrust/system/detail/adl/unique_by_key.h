@@ -33,6 +33,7 @@
 #include <thrust/system/cuda/detail/unique_by_key.h>
 #include <thrust/system/hip/detail/unique_by_key.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
+#include <thrust/system/stdpar/detail/unique_by_key.h>
 #include <thrust/system/tbb/detail/unique_by_key.h>
 #endif
 
@@ -0,0 +1,123 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/batch_copy.h>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// Copies the element at the given position of the concatenation of all of the
+// buffers, so that the copy is spread evenly however the sizes are distributed.
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OffsetIterator,
+         typename Size>
+struct batch_copy_element
+{
+  RandomAccessIterator1 src_ptrs;
+  RandomAccessIterator2 dst_ptrs;
+  OffsetIterator        offsets;
+  Size                  num_buffers;
+
+  THRUST_HOST_DEVICE
+  batch_copy_element(RandomAccessIterator1 src_ptrs, RandomAccessIterator2 dst_ptrs, OffsetIterator offsets, Size num_buffers)
+    : src_ptrs(src_ptrs), dst_ptrs(dst_ptrs), offsets(offsets), num_buffers(num_buffers)
+  {}
+
+  template<typename Offset>
+  THRUST_HOST_DEVICE
+  void operator()(Offset position) const
+  {
+    using src_iterator = typename thrust::iterator_value<RandomAccessIterator1>::type;
+    using dst_iterator = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+    // the buffer of an element is the number of buffer ends at or before it
+    const Size buffer = thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_buffers + 1, position) - (offsets + 1);
+    const Offset i    = position - offsets[buffer];
+
+    src_iterator src = src_ptrs[buffer];
+    dst_iterator dst = dst_ptrs[buffer];
+
+    dst[i] = src[i];
+  }
+};
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+THRUST_HOST_DEVICE
+  void batch_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers)
+{
+  using offset_type = typename thrust::iterator_difference<RandomAccessIterator3>::type;
+
+  if(num_buffers <= 0)
+    return;
+
+  // offsets[i] is the position of buffer i in the concatenation of all of the buffers
+  thrust::detail::temporary_array<offset_type, DerivedPolicy> offsets(exec, num_buffers + 1);
+
+  offsets[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(sizes, thrust::identity<offset_type>()),
+                         thrust::make_transform_iterator(sizes + num_buffers, thrust::identity<offset_type>()),
+                         offsets.begin() + 1);
+
+  const offset_type n = offsets[num_buffers];
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<offset_type>(0),
+                     n,
+                     detail::batch_copy_element<RandomAccessIterator1,
+                                                RandomAccessIterator2,
+                                                typename thrust::detail::temporary_array<offset_type, DerivedPolicy>::iterator,
+                                                Size>(src_ptrs, dst_ptrs, offsets.begin(), num_buffers));
+} // end batch_copy()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -25,9 +26,10 @@
 #include <thrust/distance.h>
 #include <thrust/transform.h>
 #include <thrust/detail/internal_functional.h>
-#include <thrust/detail/integer_traits.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/scatter.h>
 #include <limits>
@@ -43,52 +45,75 @@ namespace detail
 {
 
 
-template<typename IndexType,
-         typename DerivedPolicy,
+// The generic stream compaction algorithms (copy_if, remove, unique and
+// partition) process their input in tiles of this many elements, so their
+// scratch space is bounded by the tile size instead of the input size.
+const static int copy_if_tile_size = 1 << 22;
+
+
+template<typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename Predicate>
 THRUST_HOST_DEVICE
-OutputIterator copy_if(thrust::execution_policy<DerivedPolicy> &exec,
-                       InputIterator1 first,
-                       InputIterator1 last,
-                       InputIterator2 stencil,
-                       OutputIterator result,
-                       Predicate pred)
+OutputIterator copy_if_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator1 first,
+                             InputIterator1 last,
+                             InputIterator2 stencil,
+                             OutputIterator result,
+                             Predicate pred,
+                             typename thrust::iterator_difference<InputIterator1>::type tile_size)
 {
-  THRUST_DISABLE_MSVC_POSSIBLE_LOSS_OF_DATA_WARNING(IndexType n = thrust::distance(first, last));
-  
-  // compute {0,1} predicates
-  thrust::detail::temporary_array<IndexType, DerivedPolicy> predicates(exec, n);
-  thrust::transform(exec,
-                    stencil,
-                    stencil + n,
-                    predicates.begin(),
-                    thrust::detail::predicate_to_integral<Predicate,IndexType>(pred));
-  
-  // scan {0,1} predicates
-  thrust::detail::temporary_array<IndexType, DerivedPolicy> scatter_indices(exec, n);
-  thrust::exclusive_scan(exec,
-                         predicates.begin(),
-                         predicates.end(),
-                         scatter_indices.begin(),
-                         static_cast<IndexType>(0),
-                         thrust::plus<IndexType>());
-  
-  // scatter the true elements
-  thrust::scatter_if(exec,
-                     first,
-                     last,
-                     scatter_indices.begin(),
-                     predicates.begin(),
-                     result,
-                     thrust::identity<IndexType>());
-  
-  // find the end of the new sequence
-  IndexType output_size = scatter_indices[n - 1] + predicates[n - 1];
-  
-  return result + output_size;
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  // a tile is always smaller than 2^32 elements
+  using IndexType = unsigned int;
+
+  difference_type n = thrust::distance(first, last);
+
+  if(n <= 0)
+    return result;
+
+  tile_size = (thrust::min)(tile_size, n);
+
+  // the {0,1} predicates are computed on the fly by both the scan and the
+  // scatter, so the only scratch is one tile of scatter indices
+  using PredicateIterator =
+    thrust::transform_iterator<thrust::detail::predicate_to_integral<Predicate,IndexType>, InputIterator2, IndexType>;
+
+  PredicateIterator predicates(stencil, thrust::detail::predicate_to_integral<Predicate,IndexType>(pred));
+
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> scatter_indices(exec, tile_size);
+
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    // scan {0,1} predicates
+    thrust::exclusive_scan(exec,
+                           predicates + tile_begin,
+                           predicates + tile_begin + tile_n,
+                           scatter_indices.begin(),
+                           static_cast<IndexType>(0),
+                           thrust::plus<IndexType>());
+
+    // scatter the true elements
+    thrust::scatter_if(exec,
+                       first + tile_begin,
+                       first + tile_begin + tile_n,
+                       scatter_indices.begin(),
+                       predicates + tile_begin,
+                       result,
+                       thrust::identity<IndexType>());
+
+    // advance past this tile's part of the new sequence
+    IndexType tile_output_size = scatter_indices[tile_n - 1] + predicates[tile_begin + tile_n - 1];
+
+    result += tile_output_size;
+  }
+
+  return result;
 }
 
 
@@ -127,29 +152,7 @@ THRUST_HOST_DEVICE
                           OutputIterator result,
                           Predicate pred)
 {
-  using difference_type = typename thrust::iterator_traits<InputIterator1>::difference_type;
-
-  // empty sequence
-  if(first == last)
-    return result;
-  
-  difference_type n = thrust::distance(first, last);
-  
-  // create an unsigned version of n (we know n is positive from the comparison above)
-  // to avoid a warning in the compare below
-  typename thrust::detail::make_unsigned<difference_type>::type unsigned_n(n);
-  
-  // use 32-bit indices when possible (almost always)
-  if(sizeof(difference_type) > sizeof(unsigned int) && unsigned_n > thrust::detail::integer_traits<unsigned int>::const_max)
-  {
-    result = detail::copy_if<difference_type>(exec, first, last, stencil, result, pred);
-  } // end if
-  else
-  {
-    result = detail::copy_if<unsigned int>(exec, first, last, stencil, result, pred);
-  } // end else
-
-  return result;
+  return detail::copy_if_tiles(exec, first, last, stencil, result, pred, detail::copy_if_tile_size);
 } // end copy_if()
 
 
@@ -0,0 +1,338 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/hash_reduce_by_key.h>
+#include <thrust/hash_reduce_by_key.h>
+#include <thrust/gather.h>
+#include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// hashes a key by its object representation
+template<typename Key>
+struct object_hash
+{
+  static_assert(std::is_arithmetic<Key>::value || std::is_enum<Key>::value || std::is_pointer<Key>::value,
+                "hash_reduce_by_key requires a Hash for keys which are not arithmetic, enumeration or pointer types");
+  static_assert(sizeof(Key) <= sizeof(std::uint64_t),
+                "hash_reduce_by_key requires a Hash for keys which are wider than 64 bits");
+
+  THRUST_HOST_DEVICE
+  std::uint64_t operator()(const Key &key) const
+  {
+    // both floating point zeros are equal, but their representations are not
+    const Key canonical = (key == Key(0)) ? Key(0) : key;
+
+    std::uint64_t result = 0;
+    memcpy(&result, &canonical, sizeof(Key));
+
+    return result;
+  }
+};
+
+
+template<typename Hash>
+struct hash_key
+{
+  Hash hash;
+
+  THRUST_HOST_DEVICE
+  hash_key(Hash hash) : hash(hash) {}
+
+  template<typename Key>
+  THRUST_HOST_DEVICE
+  std::uint64_t operator()(const Key &key)
+  {
+    return static_cast<std::uint64_t>(hash(key));
+  }
+};
+
+
+// compares (hash, key) tuples, so that only keys with equal hashes are compared
+template<typename BinaryPredicate>
+struct equal_hash_and_key
+{
+  BinaryPredicate binary_pred;
+
+  THRUST_HOST_DEVICE
+  equal_hash_and_key(BinaryPredicate binary_pred) : binary_pred(binary_pred) {}
+
+  template<typename Tuple1, typename Tuple2>
+  THRUST_HOST_DEVICE
+  bool operator()(const Tuple1 &a, const Tuple2 &b)
+  {
+    return thrust::get<0>(a) == thrust::get<0>(b) && binary_pred(thrust::get<1>(a), thrust::get<1>(b));
+  }
+};
+
+
+// Finds the first group with a key equal to the key of a group among the
+// groups with the same hash. Distinct keys whose hashes collide may have
+// been split into several groups each by the reduction of the sorted keys.
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BinaryPredicate>
+struct group_leader
+{
+  RandomAccessIterator1 hashes;
+  RandomAccessIterator2 keys;
+  BinaryPredicate       binary_pred;
+
+  THRUST_HOST_DEVICE
+  group_leader(RandomAccessIterator1 hashes, RandomAccessIterator2 keys, BinaryPredicate binary_pred)
+    : hashes(hashes), keys(keys), binary_pred(binary_pred)
+  {}
+
+  template<typename Size>
+  THRUST_HOST_DEVICE
+  Size operator()(Size group)
+  {
+    const std::uint64_t hash = hashes[group];
+
+    Size first = group;
+
+    while(first > 0 && hashes[first - 1] == hash)
+      --first;
+
+    for(; first < group; ++first)
+    {
+      if(binary_pred(keys[first], keys[group]))
+        return first;
+    }
+
+    return group;
+  }
+};
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output)
+{
+  using KeyType = typename thrust::iterator_value<InputIterator1>::type;
+
+  // use equal_to<KeyType> as default BinaryPredicate
+  return thrust::hash_reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, thrust::equal_to<KeyType>());
+} // end hash_reduce_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred)
+{
+  using T = typename thrust::detail::eval_if<thrust::detail::is_output_iterator<OutputIterator2>::value,
+                                             thrust::iterator_value<InputIterator2>,
+                                             thrust::iterator_value<OutputIterator2>>::type;
+
+  // use plus<T> as default BinaryFunction
+  return thrust::hash_reduce_by_key(exec,
+                                    keys_first, keys_last,
+                                    values_first,
+                                    keys_output,
+                                    values_output,
+                                    binary_pred,
+                                    thrust::plus<T>());
+} // end hash_reduce_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op)
+{
+  using KeyType = typename thrust::iterator_value<InputIterator1>::type;
+
+  // hash the object representation of the keys by default
+  return thrust::hash_reduce_by_key(exec,
+                                    keys_first, keys_last,
+                                    values_first,
+                                    keys_output,
+                                    values_output,
+                                    binary_pred,
+                                    binary_op,
+                                    detail::object_hash<KeyType>());
+} // end hash_reduce_by_key()
+
+
+// The keys are sorted by their hashes and reduced by (hash, key), which
+// groups equal keys unless keys with colliding hashes interleave. The groups
+// of such keys are then reduced once more by the first group of their key.
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       Hash hash)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+  using KeyType         = typename thrust::iterator_value<InputIterator1>::type;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  const difference_type n = keys_last - keys_first;
+
+  if(n <= 0)
+    return thrust::make_pair(keys_output, values_output);
+
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy>   hashes(exec, n);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> permutation(exec, n);
+
+  thrust::transform(exec, keys_first, keys_last, hashes.begin(), detail::hash_key<Hash>(hash));
+  thrust::sequence(exec, permutation.begin(), permutation.end());
+  thrust::stable_sort_by_key(exec, hashes.begin(), hashes.end(), permutation.begin());
+
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> group_hashes(exec, n);
+  thrust::detail::temporary_array<KeyType, DerivedPolicy>       group_keys(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy>     group_values(exec, n);
+
+  const difference_type num_groups =
+    thrust::reduce_by_key(exec,
+                          thrust::make_zip_iterator(thrust::make_tuple(hashes.begin(), thrust::make_permutation_iterator(keys_first, permutation.begin()))),
+                          thrust::make_zip_iterator(thrust::make_tuple(hashes.end(), thrust::make_permutation_iterator(keys_first, permutation.end()))),
+                          thrust::make_permutation_iterator(values_first, permutation.begin()),
+                          thrust::make_zip_iterator(thrust::make_tuple(group_hashes.begin(), group_keys.begin())),
+                          group_values.begin(),
+                          detail::equal_hash_and_key<BinaryPredicate>(binary_pred),
+                          binary_op).second - group_values.begin();
+
+  using hash_iterator = typename thrust::detail::temporary_array<std::uint64_t, DerivedPolicy>::iterator;
+  using key_iterator  = typename thrust::detail::temporary_array<KeyType, DerivedPolicy>::iterator;
+
+  // reuse the permutation for the first group of the key of every group
+  thrust::transform(exec,
+                    thrust::counting_iterator<difference_type>(0),
+                    thrust::counting_iterator<difference_type>(num_groups),
+                    permutation.begin(),
+                    detail::group_leader<hash_iterator, key_iterator, BinaryPredicate>(group_hashes.begin(), group_keys.begin(), binary_pred));
+
+  if(thrust::equal(exec, permutation.begin(), permutation.begin() + num_groups, thrust::counting_iterator<difference_type>(0)))
+  {
+    // no key was split
+    keys_output   = thrust::copy(exec, group_keys.begin(), group_keys.begin() + num_groups, keys_output);
+    values_output = thrust::copy(exec, group_values.begin(), group_values.begin() + num_groups, values_output);
+
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+  thrust::stable_sort_by_key(exec, permutation.begin(), permutation.begin() + num_groups, group_values.begin());
+
+  using index_iterator = typename thrust::detail::temporary_array<difference_type, DerivedPolicy>::iterator;
+
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> leaders(exec, num_groups);
+
+  const thrust::pair<index_iterator, OutputIterator2> ends = thrust::reduce_by_key(exec,
+                                                                                   permutation.begin(),
+                                                                                   permutation.begin() + num_groups,
+                                                                                   group_values.begin(),
+                                                                                   leaders.begin(),
+                                                                                   values_output,
+                                                                                   thrust::equal_to<difference_type>(),
+                                                                                   binary_op);
+
+  const difference_type num_keys = ends.first - leaders.begin();
+
+  keys_output = thrust::gather(exec, leaders.begin(), leaders.begin() + num_keys, group_keys.begin(), keys_output);
+
+  return thrust::make_pair(keys_output, ends.second);
+} // end hash_reduce_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
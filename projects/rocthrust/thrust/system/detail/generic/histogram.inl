@@ -0,0 +1,273 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/generic/scalar/binary_search.h>
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/limits.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// Converts a sample to the level type. Converting a floating point sample
+// whose integral part doesn't fit an integral level type is undefined, so
+// it is range checked first; such a sample is outside of every bin and
+// false is returned.
+template<typename LevelType, typename T>
+THRUST_HOST_DEVICE
+bool histogram_sample_to_level(const T &x, LevelType &sample, thrust::detail::true_type)
+{
+  using limits = thrust::numeric_limits<LevelType>;
+
+  // the integral part of x is at least limits::min() when x is greater than
+  // limits::min() - 1; the difference is exact close to limits::min(), which
+  // is zero or a power of two. The integral part is at most limits::max()
+  // when x is less than limits::max() + 1, a power of two. NaNs fail both.
+  if(!(x - static_cast<T>(limits::min()) > T(-1) && x < static_cast<T>(limits::max() / 2 + 1) * T(2)))
+    return false;
+
+  sample = static_cast<LevelType>(x);
+  return true;
+}
+
+template<typename LevelType, typename T>
+THRUST_HOST_DEVICE
+bool histogram_sample_to_level(const T &x, LevelType &sample, thrust::detail::false_type)
+{
+  sample = static_cast<LevelType>(x);
+  return true;
+}
+
+template<typename LevelType, typename T>
+THRUST_HOST_DEVICE
+bool histogram_sample_to_level(const T &x, LevelType &sample)
+{
+  // x may be a wrapped reference to the sample
+  using SampleType = typename thrust::detail::remove_cv<
+    typename thrust::detail::remove_reference<typename thrust::detail::raw_reference<T>::type>::type>::type;
+
+  return histogram_sample_to_level(static_cast<SampleType>(x),
+                                   sample,
+                                   thrust::detail::integral_constant<bool,
+                                                                     thrust::detail::is_integral<LevelType>::value
+                                                                       && thrust::detail::is_floating_point<SampleType>::value>());
+}
+
+
+// Maps a sample to its bin among num_bins evenly sized bins covering
+// [lower_level, upper_level); samples outside of the range map to num_bins.
+template<typename LevelType>
+struct histogram_even_bin
+{
+  LevelType lower_level;
+  LevelType upper_level;
+  int       num_bins;
+
+  THRUST_HOST_DEVICE
+  histogram_even_bin(LevelType lower_level, LevelType upper_level, int num_bins)
+    : lower_level(lower_level), upper_level(upper_level), num_bins(num_bins)
+  {}
+
+  template<typename T>
+  THRUST_HOST_DEVICE
+  int operator()(const T &x) const
+  {
+    LevelType sample;
+
+    // written so that NaNs fall outside of the range
+    if(!histogram_sample_to_level(x, sample) || !(sample >= lower_level && sample < upper_level))
+      return num_bins;
+
+    return bin(sample, thrust::detail::is_integral<LevelType>());
+  }
+
+  private:
+    THRUST_HOST_DEVICE
+    int bin(LevelType sample, thrust::detail::true_type) const
+    {
+      // the differences are exact in unsigned arithmetic even for signed levels
+      const unsigned long long offset = static_cast<unsigned long long>(sample) - static_cast<unsigned long long>(lower_level);
+      const unsigned long long range  = static_cast<unsigned long long>(upper_level) - static_cast<unsigned long long>(lower_level);
+
+      if(range <= 0xFFFFFFFFull)
+      {
+        // offset * num_bins < 2^63
+        return static_cast<int>(offset * static_cast<unsigned long long>(num_bins) / range);
+      }
+
+      const int result = static_cast<int>(static_cast<double>(offset) / static_cast<double>(range) * num_bins);
+      return result < num_bins ? result : num_bins - 1;
+    }
+
+    THRUST_HOST_DEVICE
+    int bin(LevelType sample, thrust::detail::false_type) const
+    {
+      const int result = static_cast<int>((sample - lower_level) / (upper_level - lower_level) * num_bins);
+
+      // guard against rounding up to num_bins just below upper_level
+      return result < num_bins ? result : num_bins - 1;
+    }
+};
+
+
+// Maps a sample to the bin [levels[i], levels[i + 1]) containing it; samples
+// outside of [levels[0], levels[num_levels - 1]) map to num_levels - 1.
+template<typename RandomAccessIterator>
+struct histogram_range_bin
+{
+  using LevelType = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  RandomAccessIterator levels;
+  int                  num_levels;
+
+  THRUST_HOST_DEVICE
+  histogram_range_bin(RandomAccessIterator levels, int num_levels)
+    : levels(levels), num_levels(num_levels)
+  {}
+
+  template<typename T>
+  THRUST_HOST_DEVICE
+  int operator()(const T &x) const
+  {
+    LevelType sample;
+
+    if(!histogram_sample_to_level(x, sample))
+      return num_levels - 1;
+
+    const int upper = static_cast<int>(
+      thrust::system::detail::generic::scalar::upper_bound(levels, levels + num_levels, sample, thrust::less<LevelType>())
+      - levels);
+
+    // upper is the first level greater than sample
+    return (upper == 0 || upper == num_levels) ? num_levels - 1 : upper - 1;
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinFunction>
+THRUST_HOST_DEVICE
+  OutputIterator histogram_by_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                                   InputIterator first,
+                                   InputIterator last,
+                                   OutputIterator histogram,
+                                   int num_bins,
+                                   BinFunction bin_op)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  if(num_bins <= 0)
+    return histogram;
+
+  const difference_type n = thrust::distance(first, last);
+
+  // compute the bin of every sample and bring equal bins together
+  thrust::detail::temporary_array<int, DerivedPolicy> bins(exec, n);
+  thrust::transform(exec, first, last, bins.begin(), bin_op);
+  thrust::sort(exec, bins.begin(), bins.end());
+
+  // the end of each bin in the sorted sequence; out of range samples sort last
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> bin_ends(exec, num_bins);
+  thrust::upper_bound(exec,
+                      bins.begin(),
+                      bins.end(),
+                      thrust::counting_iterator<int>(0),
+                      thrust::counting_iterator<int>(num_bins),
+                      bin_ends.begin());
+
+  // the counts are the differences of consecutive ends
+  thrust::adjacent_difference(exec, bin_ends.begin(), bin_ends.end(), histogram);
+
+  return histogram + num_bins;
+} // end histogram_by_sort()
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelType>
+THRUST_HOST_DEVICE
+  OutputIterator histogram_even(thrust::execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                int num_levels,
+                                LevelType lower_level,
+                                LevelType upper_level)
+{
+  return detail::histogram_by_sort(exec,
+                                   first,
+                                   last,
+                                   histogram,
+                                   num_levels - 1,
+                                   detail::histogram_even_bin<LevelType>(lower_level, upper_level, num_levels - 1));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  OutputIterator histogram_range(thrust::execution_policy<DerivedPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 RandomAccessIterator levels_first,
+                                 RandomAccessIterator levels_last)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return detail::histogram_by_sort(exec,
+                                   first,
+                                   last,
+                                   histogram,
+                                   num_levels - 1,
+                                   detail::histogram_range_bin<RandomAccessIterator>(levels_first, num_levels));
+} // end histogram_range()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
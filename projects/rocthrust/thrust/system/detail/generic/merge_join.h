@@ -0,0 +1,133 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(thrust::execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(thrust::execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(thrust::execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(thrust::execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(thrust::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(thrust::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/merge_join.inl>
@@ -0,0 +1,297 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/merge_join.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/merge_join.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// the number of output pairs of a key of the first range, given the bounds of
+// its matches in the second range; a left outer join writes a key without
+// matches once
+template<bool LeftOuter>
+struct join_count
+{
+  template<typename Index>
+  THRUST_HOST_DEVICE
+  Index operator()(Index lower, Index upper) const
+  {
+    return (LeftOuter && lower == upper) ? Index(1) : upper - lower;
+  }
+};
+
+
+// Maps the position of an output pair to the pair: the key of the first range
+// is found from the ends of the runs of output pairs of the keys, and the key
+// of the second range from the lower bound of its matches.
+template<bool LeftOuter,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Index1,
+         typename Index2>
+struct join_pair
+{
+  RandomAccessIterator1 ends_first;
+  RandomAccessIterator1 ends_last;
+  RandomAccessIterator2 lower_first;
+  RandomAccessIterator2 upper_first;
+
+  THRUST_HOST_DEVICE
+  join_pair(RandomAccessIterator1 ends_first,
+            RandomAccessIterator1 ends_last,
+            RandomAccessIterator2 lower_first,
+            RandomAccessIterator2 upper_first)
+    : ends_first(ends_first), ends_last(ends_last), lower_first(lower_first), upper_first(upper_first)
+  {}
+
+  template<typename Position>
+  THRUST_HOST_DEVICE
+  thrust::tuple<Index1, Index2> operator()(Position position) const
+  {
+    const Index1 i = segment_of_position<RandomAccessIterator1, Index1>(ends_first, ends_last)(position);
+
+    const Position begin = (i == 0) ? Position(0) : Position(ends_first[i - 1]);
+
+    const Index2 lower = lower_first[i];
+
+    if(LeftOuter && lower == Index2(upper_first[i]))
+      return thrust::make_tuple(i, Index2(-1));
+
+    return thrust::make_tuple(i, static_cast<Index2>(lower + (position - begin)));
+  }
+};
+
+
+// The output is sized by a lower_bound and an upper_bound of every key of the
+// first range in the second range and a scan of the numbers of matches, then
+// every output pair finds its keys independently.
+template<bool LeftOuter,
+         typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    expand_join(thrust::execution_policy<DerivedPolicy> &exec,
+                InputIterator1 keys1_first,
+                InputIterator1 keys1_last,
+                InputIterator2 keys2_first,
+                InputIterator2 keys2_last,
+                OutputIterator1 index1_output,
+                OutputIterator2 index2_output,
+                StrictWeakCompare comp)
+{
+  using index_type1 = typename thrust::iterator_difference<InputIterator1>::type;
+  using index_type2 = typename thrust::iterator_difference<InputIterator2>::type;
+
+  const index_type1 n1 = keys1_last - keys1_first;
+
+  if(n1 <= 0)
+    return thrust::make_pair(index1_output, index2_output);
+
+  thrust::detail::temporary_array<index_type2, DerivedPolicy> lower(exec, n1);
+  thrust::detail::temporary_array<index_type2, DerivedPolicy> upper(exec, n1);
+  thrust::detail::temporary_array<index_type2, DerivedPolicy> ends(exec, n1);
+
+  thrust::lower_bound(exec, keys2_first, keys2_last, keys1_first, keys1_last, lower.begin(), comp);
+  thrust::upper_bound(exec, keys2_first, keys2_last, keys1_first, keys1_last, upper.begin(), comp);
+
+  thrust::transform(exec, lower.begin(), lower.end(), upper.begin(), ends.begin(), join_count<LeftOuter>());
+  thrust::inclusive_scan(exec, ends.begin(), ends.end(), ends.begin());
+
+  const index_type2 num_pairs = ends[n1 - 1];
+
+  using iterator = typename thrust::detail::temporary_array<index_type2, DerivedPolicy>::iterator;
+
+  thrust::transform(exec,
+                    thrust::counting_iterator<index_type2>(0),
+                    thrust::counting_iterator<index_type2>(num_pairs),
+                    thrust::make_zip_iterator(thrust::make_tuple(index1_output, index2_output)),
+                    join_pair<LeftOuter, iterator, iterator, index_type1, index_type2>(ends.begin(), ends.end(), lower.begin(), upper.begin()));
+
+  return thrust::make_pair(index1_output + num_pairs, index2_output + num_pairs);
+} // end expand_join()
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(thrust::execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output)
+{
+  using value_type = typename thrust::iterator_value<InputIterator1>::type;
+
+  return thrust::merge_join(exec, keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, thrust::less<value_type>());
+} // end merge_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(thrust::execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp)
+{
+  return detail::expand_join<false>(exec, keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(thrust::execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output)
+{
+  using value_type = typename thrust::iterator_value<InputIterator1>::type;
+
+  return thrust::merge_left_outer_join(exec, keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, thrust::less<value_type>());
+} // end merge_left_outer_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(thrust::execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp)
+{
+  return detail::expand_join<true>(exec, keys1_first, keys1_last, keys2_first, keys2_last, index1_output, index2_output, comp);
+} // end merge_left_outer_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(thrust::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output)
+{
+  using value_type = typename thrust::iterator_value<InputIterator1>::type;
+
+  return thrust::merge_semi_join(exec, keys1_first, keys1_last, keys2_first, keys2_last, index1_output, thrust::less<value_type>());
+} // end merge_semi_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(thrust::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp)
+{
+  using index_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const index_type n1 = keys1_last - keys1_first;
+
+  if(n1 <= 0)
+    return index1_output;
+
+  // a key is written when it's found in the second range
+  thrust::detail::temporary_array<bool, DerivedPolicy> found(exec, n1);
+
+  thrust::binary_search(exec, keys2_first, keys2_last, keys1_first, keys1_last, found.begin(), comp);
+
+  return thrust::copy_if(exec,
+                         thrust::counting_iterator<index_type>(0),
+                         thrust::counting_iterator<index_type>(n1),
+                         found.begin(),
+                         index1_output,
+                         thrust::identity<bool>());
+} // end merge_semi_join()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
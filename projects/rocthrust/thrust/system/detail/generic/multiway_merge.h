@@ -0,0 +1,92 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/multiway_merge.inl>
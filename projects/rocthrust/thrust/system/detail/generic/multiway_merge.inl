@@ -0,0 +1,233 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/batch_copy.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+template<typename Run>
+struct run_begin
+{
+  using iterator = typename Run::first_type;
+
+  THRUST_HOST_DEVICE
+  iterator operator()(const Run &run) const
+  {
+    return run.first;
+  }
+};
+
+
+template<typename Run, typename Size>
+struct run_size
+{
+  THRUST_HOST_DEVICE
+  Size operator()(const Run &run) const
+  {
+    return static_cast<Size>(run.second - run.first);
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Size>
+struct iterator_at
+{
+  RandomAccessIterator first;
+
+  THRUST_HOST_DEVICE
+  iterator_at(RandomAccessIterator first) : first(first) {}
+
+  THRUST_HOST_DEVICE
+  RandomAccessIterator operator()(Size offset) const
+  {
+    return first + offset;
+  }
+};
+
+
+// Writes the position of every run in the concatenation of the runs to
+// offsets, which has room for one more entry than there are runs, and returns
+// the total length of the runs.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Size>
+THRUST_HOST_DEVICE
+  Size run_offsets(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator runs_first,
+                   RandomAccessIterator runs_last,
+                   thrust::detail::temporary_array<Size, DerivedPolicy> &offsets)
+{
+  using run_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  offsets[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(runs_first, run_size<run_type, Size>()),
+                         thrust::make_transform_iterator(runs_last, run_size<run_type, Size>()),
+                         offsets.begin() + 1);
+
+  return offsets[runs_last - runs_first];
+}
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result)
+{
+  using run_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using value_type = typename thrust::iterator_value<typename run_type::first_type>::type;
+
+  // use less<value_type> as default StrictWeakCompare
+  return thrust::multiway_merge(exec, runs_first, runs_last, result, thrust::less<value_type>());
+} // end multiway_merge()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp)
+{
+  using run_type  = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using size_type = typename thrust::iterator_difference<typename run_type::first_type>::type;
+
+  const typename thrust::iterator_difference<RandomAccessIterator1>::type num_runs = runs_last - runs_first;
+
+  if(num_runs <= 0)
+    return result;
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(exec, num_runs + 1);
+
+  const size_type n = detail::run_offsets(exec, runs_first, runs_last, offsets);
+
+  // a stable sort of the concatenated runs orders equivalent elements by run
+  thrust::batch_copy(exec,
+                     thrust::make_transform_iterator(runs_first, detail::run_begin<run_type>()),
+                     thrust::make_transform_iterator(offsets.begin(), detail::iterator_at<RandomAccessIterator2, size_type>(result)),
+                     thrust::make_transform_iterator(runs_first, detail::run_size<run_type, size_type>()),
+                     num_runs);
+
+  thrust::stable_sort(exec, result, result + n, comp);
+
+  return result + n;
+} // end multiway_merge()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result)
+{
+  using run_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using key_type = typename thrust::iterator_value<typename run_type::first_type>::type;
+
+  // use less<key_type> as default StrictWeakCompare
+  return thrust::multiway_merge_by_key(exec, key_runs_first, key_runs_last, value_runs_first, keys_result, values_result, thrust::less<key_type>());
+} // end multiway_merge_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp)
+{
+  using run_type  = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using size_type = typename thrust::iterator_difference<typename run_type::first_type>::type;
+
+  const typename thrust::iterator_difference<RandomAccessIterator1>::type num_runs = key_runs_last - key_runs_first;
+
+  if(num_runs <= 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(exec, num_runs + 1);
+
+  const size_type n = detail::run_offsets(exec, key_runs_first, key_runs_last, offsets);
+
+  // a stable sort of the concatenated runs orders equivalent keys by run
+  thrust::batch_copy(exec,
+                     thrust::make_transform_iterator(key_runs_first, detail::run_begin<run_type>()),
+                     thrust::make_transform_iterator(offsets.begin(), detail::iterator_at<RandomAccessIterator3, size_type>(keys_result)),
+                     thrust::make_transform_iterator(key_runs_first, detail::run_size<run_type, size_type>()),
+                     num_runs);
+
+  thrust::batch_copy(exec,
+                     value_runs_first,
+                     thrust::make_transform_iterator(offsets.begin(), detail::iterator_at<RandomAccessIterator4, size_type>(values_result)),
+                     thrust::make_transform_iterator(key_runs_first, detail::run_size<run_type, size_type>()),
+                     num_runs);
+
+  thrust::stable_sort_by_key(exec, keys_result, keys_result + n, values_result, comp);
+
+  return thrust::make_pair(keys_result + n, values_result + n);
+} // end multiway_merge_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,165 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/partial_sort.inl>
+
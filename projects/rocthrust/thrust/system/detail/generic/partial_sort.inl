@@ -0,0 +1,410 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/partial_sort.h>
+#include <thrust/advance.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/partition.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// Ranges of up to this many elements are finished with a sort.
+const static int sample_select_cutoff = 1 << 14;
+
+
+// The splitters of every round are chosen from a sample of this many elements.
+const static int sample_select_sample_size = 1 << 10;
+
+
+// The splitters are this many sample ranks below and above the estimated rank
+// of the selected element, so that the element lies between them with high
+// probability while only a small fraction of the range does.
+const static int sample_select_spread = 1 << 5;
+
+
+template<typename Size>
+struct sample_select_index
+{
+  Size n;
+  Size sample_size;
+
+  THRUST_HOST_DEVICE
+  Size operator()(Size i) const
+  {
+    // the middles of sample_size evenly sized strides of the range
+    return i * n / sample_size + n / (2 * sample_size);
+  }
+};
+
+
+template<typename T, typename StrictWeakOrdering>
+struct sample_select_less
+{
+  T                  pivot;
+  StrictWeakOrdering comp;
+
+  THRUST_HOST_DEVICE
+  bool operator()(const T &x)
+  {
+    return comp(x, pivot);
+  }
+};
+
+
+template<typename T, typename StrictWeakOrdering>
+struct sample_select_not_greater
+{
+  T                  pivot;
+  StrictWeakOrdering comp;
+
+  THRUST_HOST_DEVICE
+  bool operator()(const T &x)
+  {
+    return !comp(pivot, x);
+  }
+};
+
+
+// Selects the nth element by repeatedly partitioning the range into the
+// elements below, between and above two splitters which are sampled to
+// bracket it closely. Only the middle part containing nth is kept, so the
+// range shrinks by a large factor with every round of parallel partitions.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void sample_select(thrust::execution_policy<DerivedPolicy> &exec,
+                     RandomAccessIterator first,
+                     RandomAccessIterator nth,
+                     RandomAccessIterator last,
+                     StrictWeakOrdering comp)
+{
+  using value_type      = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const difference_type sample_size = sample_select_sample_size;
+
+  difference_type spread = sample_select_spread;
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> sample(exec, sample_size);
+
+  while(last - first > sample_select_cutoff)
+  {
+    const difference_type n = last - first;
+
+    sample_select_index<difference_type> index = {n, sample_size};
+
+    thrust::gather(exec,
+                   thrust::make_transform_iterator(thrust::counting_iterator<difference_type>(0), index),
+                   thrust::make_transform_iterator(thrust::counting_iterator<difference_type>(sample_size), index),
+                   first,
+                   sample.begin());
+    thrust::sort(exec, sample.begin(), sample.end(), comp);
+
+    const difference_type rank = (nth - first) * sample_size / n;
+
+    const value_type lower = sample[rank > spread ? rank - spread : 0];
+    const value_type upper = sample[rank + spread < sample_size ? rank + spread : sample_size - 1];
+
+    sample_select_less<value_type, StrictWeakOrdering>        below = {lower, comp};
+    sample_select_not_greater<value_type, StrictWeakOrdering> not_above = {upper, comp};
+
+    RandomAccessIterator middle_first = thrust::partition(exec, first, last, below);
+    RandomAccessIterator middle_last  = thrust::partition(exec, middle_first, last, not_above);
+
+    if(nth < middle_first)
+    {
+      last = middle_first;
+    }
+    else if(nth >= middle_last)
+    {
+      first = middle_last;
+    }
+    else if(!comp(lower, upper))
+    {
+      // the middle consists of elements equivalent to nth
+      return;
+    }
+    else if(middle_first == first && middle_last == last)
+    {
+      // the splitters bracket the whole range, which only happens with many
+      // duplicates; split around a single sampled element instead
+      spread = 0;
+    }
+    else
+    {
+      first = middle_first;
+      last  = middle_last;
+    }
+  }
+
+  thrust::sort(exec, first, last, comp);
+} // end sample_select()
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  thrust::nth_element(exec, first, nth, last, thrust::less<value_type>());
+} // end nth_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  if(nth == last)
+    return;
+
+  detail::sample_select(exec, first, nth, last, comp);
+} // end nth_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  thrust::partial_sort(exec, first, middle, last, thrust::less<value_type>());
+} // end partial_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  if(first == middle)
+    return;
+
+  // gather the smallest elements in front, then order only those
+  thrust::nth_element(exec, first, middle, last, comp);
+  thrust::sort(exec, first, middle, comp);
+} // end partial_sort()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last)
+{
+  using value_type = typename thrust::iterator_value<InputIterator>::type;
+  return thrust::partial_sort_copy(exec, first, last, result_first, result_last, thrust::less<value_type>());
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  using value_type      = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const difference_type n = thrust::distance(first, last);
+  const difference_type r = (thrust::min)(n, static_cast<difference_type>(result_last - result_first));
+
+  if(r <= 0)
+    return result_first;
+
+  if(r == n)
+  {
+    thrust::copy(exec, first, last, result_first);
+    thrust::sort(exec, result_first, result_first + r, comp);
+    return result_first + r;
+  }
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values(exec, first, last);
+
+  thrust::nth_element(exec, values.begin(), values.begin() + r, values.end(), comp);
+  thrust::sort(exec, values.begin(), values.begin() + r, comp);
+
+  return thrust::copy(exec, values.begin(), values.begin() + r, result_first);
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result)
+{
+  using value_type = typename thrust::iterator_value<InputIterator>::type;
+  return thrust::top_k(exec, first, last, k, result, thrust::greater<value_type>());
+} // end top_k()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  const difference_type n = thrust::distance(first, last);
+  const difference_type r = (thrust::min)(static_cast<difference_type>(k), n);
+
+  if(r <= 0)
+    return result;
+
+  return thrust::partial_sort_copy(exec, first, last, result, result + r, comp);
+} // end top_k()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result)
+{
+  using value_type = typename thrust::iterator_value<InputIterator1>::type;
+  return thrust::top_k_by_key(exec, keys_first, keys_last, values_first, k, keys_result, values_result, thrust::greater<value_type>());
+} // end top_k_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp)
+{
+  using InputZipIterator  = thrust::zip_iterator<thrust::tuple<InputIterator1, InputIterator2>>;
+  using OutputZipIterator = thrust::zip_iterator<thrust::tuple<RandomAccessIterator1, RandomAccessIterator2>>;
+
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  const difference_type n = thrust::distance(keys_first, keys_last);
+  const difference_type r = (thrust::min)(static_cast<difference_type>(k), n);
+
+  if(r <= 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  InputZipIterator zipped_first = thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first));
+  InputZipIterator zipped_last  = zipped_first;
+  thrust::advance(zipped_last, n);
+
+  OutputZipIterator zipped_result = thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result));
+
+  // select the key-value pairs by their keys alone
+  thrust::detail::compare_first<StrictWeakOrdering> comp_first(comp);
+
+  thrust::partial_sort_copy(exec, zipped_first, zipped_last, zipped_result, zipped_result + r, comp_first);
+
+  return thrust::make_pair(keys_result + r, values_result + r);
+} // end top_k_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -27,6 +28,13 @@
 #include <thrust/partition.h>
 #include <thrust/sort.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/distance.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/system/detail/generic/copy_if.h>
 
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
@@ -40,6 +48,106 @@ namespace generic
 {
 
 
+namespace detail
+{
+
+
+template<typename IndexType>
+struct partition_false_index
+{
+  // the false elements before position i are those not counted by the scan
+  template<typename Tuple>
+  THRUST_HOST_DEVICE
+  IndexType operator()(const Tuple &t) const
+  {
+    return thrust::get<0>(t) - thrust::get<1>(t);
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    stable_partition_copy_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first,
+                                InputIterator1 last,
+                                InputIterator2 stencil,
+                                OutputIterator1 out_true,
+                                OutputIterator2 out_false,
+                                Predicate pred,
+                                typename thrust::iterator_difference<InputIterator1>::type tile_size)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+
+  // a tile is always smaller than 2^32 elements
+  using IndexType = unsigned int;
+
+  difference_type n = thrust::distance(first, last);
+
+  if(n <= 0)
+    return thrust::make_pair(out_true, out_false);
+
+  tile_size = (thrust::min)(tile_size, n);
+
+  using PredicateIterator =
+    thrust::transform_iterator<thrust::detail::predicate_to_integral<Predicate,IndexType>, InputIterator2, IndexType>;
+
+  PredicateIterator predicates(stencil, thrust::detail::predicate_to_integral<Predicate,IndexType>(pred));
+
+  // a single scan of the predicates places both partitions: a true element
+  // goes to the number of true elements before it, a false element to the
+  // number of false elements before it
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> true_indices(exec, tile_size);
+
+  auto false_indices = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(thrust::counting_iterator<IndexType>(0), true_indices.begin())),
+    partition_false_index<IndexType>());
+
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    thrust::exclusive_scan(exec,
+                           predicates + tile_begin,
+                           predicates + tile_begin + tile_n,
+                           true_indices.begin(),
+                           static_cast<IndexType>(0),
+                           thrust::plus<IndexType>());
+
+    thrust::scatter_if(exec,
+                       first + tile_begin,
+                       first + tile_begin + tile_n,
+                       true_indices.begin(),
+                       predicates + tile_begin,
+                       out_true,
+                       thrust::identity<IndexType>());
+
+    thrust::scatter_if(exec,
+                       first + tile_begin,
+                       first + tile_begin + tile_n,
+                       false_indices,
+                       predicates + tile_begin,
+                       out_false,
+                       thrust::logical_not<IndexType>());
+
+    const IndexType num_true = true_indices[tile_n - 1] + predicates[tile_begin + tile_n - 1];
+
+    out_true  += num_true;
+    out_false += tile_n - num_true;
+  }
+
+  return thrust::make_pair(out_true, out_false);
+} // end stable_partition_copy_tiles()
+
+
+} // end namespace detail
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename Predicate>
@@ -108,15 +216,7 @@ THRUST_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  auto not_pred = thrust::not_fn(pred);
-
-  // remove_copy_if the true partition to out_true
-  OutputIterator1 end_of_true_partition = thrust::remove_copy_if(exec, first, last, out_true, not_pred);
-
-  // remove_copy_if the false partition to out_false
-  OutputIterator2 end_of_false_partition = thrust::remove_copy_if(exec, first, last, out_false, pred);
-
-  return thrust::make_pair(end_of_true_partition, end_of_false_partition);
+  return detail::stable_partition_copy_tiles(exec, first, last, first, out_true, out_false, pred, detail::copy_if_tile_size);
 } // end stable_partition_copy()
 
 
@@ -136,15 +236,7 @@ THRUST_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  auto not_pred = thrust::not_fn(pred);
-
-  // remove_copy_if the true partition to out_true
-  OutputIterator1 end_of_true_partition = thrust::remove_copy_if(exec, first, last, stencil, out_true, not_pred);
-
-  // remove_copy_if the false partition to out_false
-  OutputIterator2 end_of_false_partition = thrust::remove_copy_if(exec, first, last, stencil, out_false, pred);
-
-  return thrust::make_pair(end_of_true_partition, end_of_false_partition);
+  return detail::stable_partition_copy_tiles(exec, first, last, stencil, out_true, out_false, pred, detail::copy_if_tile_size);
 } // end stable_partition_copy()
 
 
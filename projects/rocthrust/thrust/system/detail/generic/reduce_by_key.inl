@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -25,6 +26,9 @@
 #include <thrust/detail/type_traits/function_traits.h>
 #include <thrust/transform.h>
 #include <thrust/scatter.h>
+#include <thrust/find.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/pair.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <limits>
 
@@ -62,7 +66,9 @@ struct reduce_by_key_functor
 };
 
 
-} // end namespace detail
+// The input is reduced in tiles of this many elements, so the scratch
+// space of reduce_by_key is bounded by the tile size instead of the input size.
+const static int reduce_by_key_tile_size = 1 << 22;
 
 
 template<typename ExecutionPolicy,
@@ -74,62 +80,152 @@ template<typename ExecutionPolicy,
          typename BinaryFunction>
 THRUST_HOST_DEVICE
   thrust::pair<OutputIterator1,OutputIterator2>
-    reduce_by_key(thrust::execution_policy<ExecutionPolicy> &exec,
-                  InputIterator1 keys_first,
-                  InputIterator1 keys_last,
-                  InputIterator2 values_first,
-                  OutputIterator1 keys_output,
-                  OutputIterator2 values_output,
-                  BinaryPredicate binary_pred,
-                  BinaryFunction binary_op)
+    reduce_by_key_tiles(thrust::execution_policy<ExecutionPolicy> &exec,
+                        InputIterator1 keys_first,
+                        InputIterator1 keys_last,
+                        InputIterator2 values_first,
+                        OutputIterator1 keys_output,
+                        OutputIterator2 values_output,
+                        BinaryPredicate binary_pred,
+                        BinaryFunction binary_op,
+                        typename thrust::iterator_traits<InputIterator1>::difference_type tile_size)
 {
   using difference_type = typename thrust::iterator_traits<InputIterator1>::difference_type;
 
-  using FlagType = unsigned int; // TODO use difference_type
+  using FlagType = unsigned int; // a tile is always smaller than 2^32 elements
 
-    // Use the input iterator's value type per https://wg21.link/P0571
-    using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+  using KeyType = typename thrust::iterator_value<InputIterator1>::type;
 
-    if (keys_first == keys_last)
-        return thrust::make_pair(keys_output, values_output);
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
 
-    // input size
-    difference_type n = keys_last - keys_first;
+  // input size
+  difference_type n = keys_last - keys_first;
 
-    InputIterator2 values_last = values_first + n;
+  if (n <= 0)
+    return thrust::make_pair(keys_output, values_output);
 
-  // compute head flags
-  thrust::detail::temporary_array<FlagType, ExecutionPolicy> head_flags(exec, n);
-  thrust::transform(
-    exec, keys_first, keys_last - 1, keys_first + 1, head_flags.begin() + 1, thrust::not_fn(binary_pred));
-  head_flags[0] = 1;
+  tile_size = (thrust::min)(tile_size, n);
 
-  // compute tail flags
-  thrust::detail::temporary_array<FlagType, ExecutionPolicy> tail_flags(exec, n); // COPY INSTEAD OF TRANSFORM
-  thrust::transform(exec, keys_first, keys_last - 1, keys_first + 1, tail_flags.begin(), thrust::not_fn(binary_pred));
-  tail_flags[n - 1] = 1;
+  // head_flags[i] is set when element i of the tile starts a segment; the
+  // tail flags of the tile are the same array shifted by one position
+  thrust::detail::temporary_array<FlagType, ExecutionPolicy>  head_flags(exec, tile_size + 1);
+  thrust::detail::temporary_array<ValueType, ExecutionPolicy> scanned_values(exec, tile_size);
+  thrust::detail::temporary_array<FlagType, ExecutionPolicy>  scanned_tail_flags(exec, tile_size);
 
-    // scan the values by flag
-    thrust::detail::temporary_array<ValueType,ExecutionPolicy> scanned_values(exec, n);
-    thrust::detail::temporary_array<FlagType,ExecutionPolicy>  scanned_tail_flags(exec, n);
+  // number of segments written so far
+  difference_type num_segments = 0;
+
+  // partial reduction of the last segment of the previous tile
+  ValueType carry = ValueType();
 
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    InputIterator1 tile_keys   = keys_first + tile_begin;
+    InputIterator2 tile_values = values_first + tile_begin;
+
+    // compute head flags; the last element of a tile always closes a segment
+    thrust::transform(
+      exec, tile_keys, tile_keys + tile_n - 1, tile_keys + 1, head_flags.begin() + 1, thrust::not_fn(binary_pred));
+    head_flags[0]      = 1;
+    head_flags[tile_n] = 1;
+
+    // scan the values by flag
     thrust::inclusive_scan
         (exec,
-         thrust::make_zip_iterator(thrust::make_tuple(values_first,           head_flags.begin())),
-         thrust::make_zip_iterator(thrust::make_tuple(values_last,            head_flags.end())),
+         thrust::make_zip_iterator(thrust::make_tuple(tile_values,            head_flags.begin())),
+         thrust::make_zip_iterator(thrust::make_tuple(tile_values + tile_n,   head_flags.begin() + tile_n)),
          thrust::make_zip_iterator(thrust::make_tuple(scanned_values.begin(), scanned_tail_flags.begin())),
          detail::reduce_by_key_functor<ValueType, FlagType, BinaryFunction>(binary_op));
 
-    thrust::exclusive_scan(exec, tail_flags.begin(), tail_flags.end(), scanned_tail_flags.begin(), FlagType(0), thrust::plus<FlagType>());
+    thrust::exclusive_scan(exec,
+                           head_flags.begin() + 1,
+                           head_flags.begin() + 1 + tile_n,
+                           scanned_tail_flags.begin(),
+                           FlagType(0),
+                           thrust::plus<FlagType>());
+
+    // number of segments in this tile
+    const difference_type tile_segments = static_cast<difference_type>(scanned_tail_flags[tile_n - 1]) + 1;
+
+    // a segment which straddles the tile boundary has already been given an
+    // output slot (and its key) by the previous tile; fold the carried
+    // partial reduction into this tile's first segment and rewrite that slot
+    bool continues = false;
+
+    if(tile_begin > 0)
+    {
+      KeyType prev_key = keys_first[tile_begin - 1];
+      KeyType key      = *tile_keys;
+
+      continues = binary_pred(prev_key, key);
+    }
+
+    if(continues)
+    {
+      const difference_type first_tail =
+        thrust::find(exec, head_flags.begin() + 1, head_flags.begin() + 1 + tile_n, FlagType(1)) - (head_flags.begin() + 1);
+
+      ValueType first_value = scanned_values[first_tail];
+      scanned_values[first_tail] = binary_op(carry, first_value);
+
+      // the key of the straddling segment was written by the previous tile
+      head_flags[0] = 0;
+    }
 
-    // number of unique keys
-    FlagType N = scanned_tail_flags[n - 1] + 1;
+    const difference_type tile_output = continues ? num_segments - 1 : num_segments;
 
     // scatter the keys and accumulated values
-    thrust::scatter_if(exec, keys_first,            keys_last,             scanned_tail_flags.begin(), head_flags.begin(), keys_output);
-    thrust::scatter_if(exec, scanned_values.begin(), scanned_values.end(), scanned_tail_flags.begin(), tail_flags.begin(), values_output);
+    thrust::scatter_if(exec,
+                       tile_keys, tile_keys + tile_n,
+                       scanned_tail_flags.begin(),
+                       head_flags.begin(),
+                       keys_output + tile_output);
+    thrust::scatter_if(exec,
+                       scanned_values.begin(), scanned_values.begin() + tile_n,
+                       scanned_tail_flags.begin(),
+                       head_flags.begin() + 1,
+                       values_output + tile_output);
+
+    carry        = scanned_values[tile_n - 1];
+    num_segments = tile_output + tile_segments;
+  }
+
+  return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
+} // end reduce_by_key_tiles()
+
+
+} // end namespace detail
+
 
-    return thrust::make_pair(keys_output + N, values_output + N);
+template<typename ExecutionPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    reduce_by_key(thrust::execution_policy<ExecutionPolicy> &exec,
+                  InputIterator1 keys_first,
+                  InputIterator1 keys_last,
+                  InputIterator2 values_first,
+                  OutputIterator1 keys_output,
+                  OutputIterator2 values_output,
+                  BinaryPredicate binary_pred,
+                  BinaryFunction binary_op)
+{
+  return detail::reduce_by_key_tiles(exec,
+                                     keys_first, keys_last,
+                                     values_first,
+                                     keys_output,
+                                     values_output,
+                                     binary_pred,
+                                     binary_op,
+                                     detail::reduce_by_key_tile_size);
 } // end reduce_by_key()
 
 
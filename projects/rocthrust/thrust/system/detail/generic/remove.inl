@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -20,6 +21,10 @@
 #include <thrust/system/detail/generic/remove.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/copy_if.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/distance.h>
+#include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/remove.h>
@@ -33,6 +38,116 @@ namespace generic
 {
 
 
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Predicate>
+THRUST_HOST_DEVICE
+  OutputIterator remove_copy_if_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                                      InputIterator1 first,
+                                      InputIterator1 last,
+                                      InputIterator2 stencil,
+                                      OutputIterator result,
+                                      Predicate pred,
+                                      typename thrust::iterator_difference<InputIterator1>::type tile_size)
+{
+  // the elements are kept where the predicate is false, in the same tiles as copy_if
+  return copy_if_tiles(exec, first, last, stencil, result, thrust::not_fn(pred), tile_size);
+} // end remove_copy_if_tiles()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate>
+THRUST_HOST_DEVICE
+  ForwardIterator remove_if_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  Predicate pred,
+                                  typename thrust::iterator_difference<ForwardIterator>::type tile_size)
+{
+  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
+  using difference_type = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  difference_type n = thrust::distance(first, last);
+
+  if(n <= 0)
+    return first;
+
+  tile_size = (thrust::min)(tile_size, n);
+
+  // the output never overtakes the input, so the range can be compacted
+  // one tile at a time through a tile-sized copy of its elements
+  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, tile_size);
+
+  ForwardIterator result = first;
+
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    // the first tile was copied when temp was created
+    if(tile_begin > 0)
+      thrust::copy(exec, first + tile_begin, first + tile_begin + tile_n, temp.begin());
+
+    result = thrust::remove_copy_if(exec, temp.begin(), temp.begin() + tile_n, temp.begin(), result, pred);
+  }
+
+  return result;
+} // end remove_if_tiles()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+THRUST_HOST_DEVICE
+  ForwardIterator remove_if_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  InputIterator stencil,
+                                  Predicate pred,
+                                  typename thrust::iterator_difference<ForwardIterator>::type tile_size)
+{
+  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
+  using difference_type = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  difference_type n = thrust::distance(first, last);
+
+  if(n <= 0)
+    return first;
+
+  tile_size = (thrust::min)(tile_size, n);
+
+  // the output never overtakes the input, so the range can be compacted
+  // one tile at a time through a tile-sized copy of its elements
+  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, tile_size);
+
+  ForwardIterator result = first;
+
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    // the first tile was copied when temp was created
+    if(tile_begin > 0)
+      thrust::copy(exec, first + tile_begin, first + tile_begin + tile_n, temp.begin());
+
+    result = thrust::remove_copy_if(exec, temp.begin(), temp.begin() + tile_n, stencil + tile_begin, result, pred);
+  }
+
+  return result;
+} // end remove_if_tiles()
+
+
+} // end namespace detail
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename T>
@@ -76,13 +191,7 @@ THRUST_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
-  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
-
-  // create temporary storage for an intermediate result
-  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, last);
-
-  // remove into temp
-  return thrust::remove_copy_if(exec, temp.begin(), temp.end(), temp.begin(), first, pred);
+  return detail::remove_if_tiles(exec, first, last, pred, detail::copy_if_tile_size);
 } // end remove_if()
 
 
@@ -97,13 +206,7 @@ THRUST_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
-  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
-
-  // create temporary storage for an intermediate result
-  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, last);
-
-  // remove into temp
-  return thrust::remove_copy_if(exec, temp.begin(), temp.end(), stencil, first, pred);
+  return detail::remove_if_tiles(exec, first, last, stencil, pred, detail::copy_if_tile_size);
 } // end remove_if()
 
 
@@ -0,0 +1,78 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 run_length_decode(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/run_length_encode.inl>
@@ -0,0 +1,133 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  // use equal_to<value_type> as default BinaryPredicate
+  return thrust::run_length_encode(exec, first, last, values_output, counts_output, thrust::equal_to<value_type>());
+} // end run_length_encode()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred)
+{
+  using count_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  // the length of a run is the sum of a 1 for each of its elements
+  return thrust::reduce_by_key(exec,
+                               first,
+                               last,
+                               thrust::make_constant_iterator<count_type>(1),
+                               values_output,
+                               counts_output,
+                               binary_pred,
+                               thrust::plus<count_type>());
+} // end run_length_encode()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 run_length_decode(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result)
+{
+  using position_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+  using run_type      = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  const run_type num_runs = values_last - values_first;
+
+  if(num_runs <= 0)
+    return result;
+
+  // positions[i] is the position of run i in the output
+  thrust::detail::temporary_array<position_type, DerivedPolicy> positions(exec, num_runs + 1);
+
+  positions[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(counts_first, thrust::identity<position_type>()),
+                         thrust::make_transform_iterator(counts_first + num_runs, thrust::identity<position_type>()),
+                         positions.begin() + 1);
+
+  const position_type n = positions[num_runs];
+
+  using run_of_position = detail::segment_of_position<typename thrust::detail::temporary_array<position_type, DerivedPolicy>::iterator, run_type>;
+
+  // every output element gathers the value of the run containing it
+  thrust::transform_iterator<run_of_position, thrust::counting_iterator<position_type>, run_type> runs(
+    thrust::counting_iterator<position_type>(0),
+    run_of_position(positions.begin() + 1, positions.end()));
+
+  return thrust::gather(exec, runs, runs + n, values_first, result);
+} // end run_length_decode()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
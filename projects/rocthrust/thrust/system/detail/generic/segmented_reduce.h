@@ -0,0 +1,97 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_transform_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/segmented_reduce.inl>
@@ -0,0 +1,225 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// Maps the position of a value to the index of the segment containing it, so
+// that reduce_by_key can be given the segments without storing a key per value.
+template<typename RandomAccessIterator,
+         typename Size>
+struct segment_of_position
+{
+  RandomAccessIterator ends_first;
+  RandomAccessIterator ends_last;
+
+  THRUST_HOST_DEVICE
+  segment_of_position(RandomAccessIterator ends_first, RandomAccessIterator ends_last)
+    : ends_first(ends_first), ends_last(ends_last)
+  {}
+
+  template<typename Offset>
+  THRUST_HOST_DEVICE
+  Size operator()(Offset position) const
+  {
+    // the segment of a value is the number of segment ends at or before it
+    return thrust::upper_bound(thrust::seq, ends_first, ends_last, position) - ends_first;
+  }
+};
+
+
+template<typename T,
+         typename BinaryFunction>
+struct fold_segment_init
+{
+  T              init;
+  BinaryFunction binary_op;
+
+  THRUST_HOST_DEVICE
+  fold_segment_init(T init, BinaryFunction binary_op)
+    : init(init), binary_op(binary_op)
+  {}
+
+  template<typename U>
+  THRUST_HOST_DEVICE
+  T operator()(const U &partial) const
+  {
+    return binary_op(init, partial);
+  }
+};
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  // use value_type(0) as init by default
+  return thrust::segmented_reduce(exec, values_first, offsets_first, offsets_last, result, value_type(0));
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init)
+{
+  // use plus<T> as default BinaryFunction
+  return thrust::segmented_reduce(exec, values_first, offsets_first, offsets_last, result, init, thrust::plus<T>());
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator1 values_first,
+                                  RandomAccessIterator2 offsets_first,
+                                  RandomAccessIterator2 offsets_last,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  return thrust::segmented_transform_reduce(exec,
+                                            values_first,
+                                            offsets_first,
+                                            offsets_last,
+                                            result,
+                                            thrust::identity<value_type>(),
+                                            init,
+                                            binary_op);
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_transform_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  using offset_type  = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using segment_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+
+  const segment_type num_segments = (offsets_last - offsets_first) - 1;
+
+  if(num_segments <= 0)
+    return result;
+
+  // empty segments reduce to init
+  thrust::fill(exec, result, result + num_segments, init);
+
+  const offset_type begin = offsets_first[0];
+  const offset_type end   = offsets_last[-1];
+
+  if(end - begin <= 0)
+    return result + num_segments;
+
+  using segment_iterator =
+    thrust::transform_iterator<detail::segment_of_position<RandomAccessIterator2, segment_type>,
+                               thrust::counting_iterator<offset_type>,
+                               segment_type>;
+
+  segment_iterator segments(thrust::counting_iterator<offset_type>(begin),
+                            detail::segment_of_position<RandomAccessIterator2, segment_type>(offsets_first + 1, offsets_last));
+
+  // reduce the non-empty segments, then fold init into their sums
+  thrust::detail::temporary_array<segment_type, DerivedPolicy> reduced_segments(exec, num_segments);
+  thrust::detail::temporary_array<T, DerivedPolicy>            sums(exec, num_segments);
+
+  const segment_type num_reduced = thrust::reduce_by_key(exec,
+                                                         segments,
+                                                         segments + (end - begin),
+                                                         thrust::make_transform_iterator(values_first + begin, unary_op),
+                                                         reduced_segments.begin(),
+                                                         sums.begin(),
+                                                         thrust::equal_to<segment_type>(),
+                                                         binary_op).first - reduced_segments.begin();
+
+  thrust::transform(exec,
+                    sums.begin(),
+                    sums.begin() + num_reduced,
+                    thrust::make_permutation_iterator(result, reduced_segments.begin()),
+                    detail::fold_segment_init<T, BinaryFunction>(init, binary_op));
+
+  return result + num_segments;
+} // end segmented_transform_reduce()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
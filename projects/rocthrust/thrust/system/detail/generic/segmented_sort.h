@@ -0,0 +1,90 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/segmented_sort.inl>
+
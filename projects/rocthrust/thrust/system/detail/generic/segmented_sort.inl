@@ -0,0 +1,189 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// Labels every key in [offsets_first[0], offsets_last[-1]) with the index of
+// the segment containing it.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+THRUST_HOST_DEVICE
+  void segment_indices(thrust::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator offsets_first,
+                       RandomAccessIterator offsets_last,
+                       OutputIterator result)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  const offset_type begin = offsets_first[0];
+  const offset_type end   = offsets_last[-1];
+
+  // the segment of a key is the number of segment ends at or before it
+  thrust::upper_bound(exec,
+                      offsets_first + 1,
+                      offsets_last,
+                      thrust::counting_iterator<offset_type>(begin),
+                      thrust::counting_iterator<offset_type>(end),
+                      result);
+} // end segment_indices()
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  thrust::segmented_sort(exec, keys_first, keys_last, offsets_first, offsets_last, thrust::less<value_type>());
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp)
+{
+  using offset_type  = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using segment_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+
+  if(offsets_last - offsets_first < 2)
+    return;
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = static_cast<offset_type>(offsets_last[-1]) - begin;
+
+  if(n <= 0)
+    return;
+
+  RandomAccessIterator1 first = keys_first + begin;
+
+  thrust::detail::temporary_array<segment_type, DerivedPolicy> segments(exec, n);
+  detail::segment_indices(exec, offsets_first, offsets_last, segments.begin());
+
+  // sort all of the keys at once, then bring them back to their segments;
+  // the second sort is stable, so every segment remains sorted
+  thrust::stable_sort_by_key(exec, first, first + n, segments.begin(), comp);
+  thrust::stable_sort_by_key(exec, segments.begin(), segments.end(), first);
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  thrust::segmented_sort_by_key(exec, keys_first, keys_last, values_first, offsets_first, offsets_last, thrust::less<value_type>());
+} // end segmented_sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp)
+{
+  using offset_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+  using segment_type = typename thrust::iterator_difference<RandomAccessIterator3>::type;
+
+  if(offsets_last - offsets_first < 2)
+    return;
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = static_cast<offset_type>(offsets_last[-1]) - begin;
+
+  if(n <= 0)
+    return;
+
+  RandomAccessIterator1 keys   = keys_first + begin;
+  RandomAccessIterator2 values = values_first + begin;
+
+  thrust::detail::temporary_array<segment_type, DerivedPolicy> segments(exec, n);
+  detail::segment_indices(exec, offsets_first, offsets_last, segments.begin());
+
+  // sort all of the keys at once, then bring them back to their segments;
+  // the second sort is stable, so every segment remains sorted
+  thrust::stable_sort_by_key(exec,
+                             keys,
+                             keys + n,
+                             thrust::make_zip_iterator(thrust::make_tuple(segments.begin(), values)),
+                             comp);
+  thrust::stable_sort_by_key(exec,
+                             segments.begin(),
+                             segments.end(),
+                             thrust::make_zip_iterator(thrust::make_tuple(keys, values)));
+} // end segmented_sort_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-20120 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,6 +22,7 @@
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/random.h>
 #include <thrust/scan.h>
+#include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/shuffle.h>
 
 #include <cstdint>
@@ -0,0 +1,233 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/sort_strings.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+// The key of a string at a depth packs the string_key_chars characters of the
+// string from that depth on, padded with zeros, into the high bytes of a 64 bit
+// integer, and the number of characters left from that depth on, clamped to 8,
+// into the low byte. Comparing the keys of two strings compares them on those
+// characters first, and then puts a string which ends within them before a
+// longer one, so strings with equal keys are equal when the low byte is at most
+// string_key_chars and only differ beyond the characters of the key otherwise.
+const static int string_key_chars = 7;
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator,
+         typename Size>
+THRUST_HOST_DEVICE
+  std::uint64_t string_key(RandomAccessIterator string_first, Size length, Size depth)
+{
+  const Size remaining = length > depth ? length - depth : Size(0);
+
+  std::uint64_t key = 0;
+
+  for(int i = 0; i < string_key_chars; ++i)
+  {
+    key <<= 8;
+
+    if(Size(i) < remaining)
+      key |= static_cast<unsigned char>(string_first[depth + i]);
+  }
+
+  return (key << 8) | static_cast<std::uint64_t>(remaining < Size(8) ? remaining : Size(8));
+}
+
+
+// whether strings with this key may still differ beyond its characters
+THRUST_HOST_DEVICE
+inline bool string_key_continues(std::uint64_t key)
+{
+  return (key & 0xff) > string_key_chars;
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+struct string_key_functor
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  RandomAccessIterator1 chars_first;
+  RandomAccessIterator2 offsets_first;
+  offset_type           depth;
+
+  THRUST_HOST_DEVICE
+  string_key_functor(RandomAccessIterator1 chars_first, RandomAccessIterator2 offsets_first, offset_type depth)
+    : chars_first(chars_first), offsets_first(offsets_first), depth(depth)
+  {}
+
+  template<typename Index>
+  THRUST_HOST_DEVICE
+  std::uint64_t operator()(Index i) const
+  {
+    const offset_type begin = offsets_first[i];
+    const offset_type end   = offsets_first[i + 1];
+
+    return string_key(chars_first + begin, static_cast<offset_type>(end - begin), depth);
+  }
+};
+
+
+template<typename RandomAccessIterator>
+struct string_length_functor
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  RandomAccessIterator offsets_first;
+
+  THRUST_HOST_DEVICE
+  string_length_functor(RandomAccessIterator offsets_first)
+    : offsets_first(offsets_first)
+  {}
+
+  template<typename Index>
+  THRUST_HOST_DEVICE
+  offset_type operator()(Index i) const
+  {
+    return offsets_first[i + 1] - offsets_first[i];
+  }
+};
+
+
+} // end namespace detail
+
+
+// Sorts the strings string_key_chars characters at a time. Every round sorts
+// the permutation by the keys of the strings at the current depth, then stably
+// by the groups of strings which were equal up to that depth, and splits the
+// groups by key. The sorts are radix sorts on the device systems, and the rounds
+// stop once every string is in a group of its own or has ended.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 sort_strings(thrust::execution_policy<DerivedPolicy> &exec,
+                                     RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+  using key_type    = std::uint64_t;
+
+  const index_type n = static_cast<index_type>(offsets_last - offsets_first) - 1;
+
+  if(n <= 0)
+    return permutation_out;
+
+  thrust::sequence(exec, permutation_out, permutation_out + n);
+
+  const offset_type max_length = thrust::transform_reduce(exec,
+                                                          thrust::counting_iterator<index_type>(0),
+                                                          thrust::counting_iterator<index_type>(n),
+                                                          detail::string_length_functor<RandomAccessIterator2>(offsets_first),
+                                                          offset_type(0),
+                                                          thrust::maximum<offset_type>());
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy>   keys(exec, n);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> groups(exec, n);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> heads(exec, n);
+
+  // all of the strings are equal up to depth 0
+  thrust::fill(exec, groups.begin(), groups.end(), index_type(0));
+
+  for(offset_type depth = 0;; depth += detail::string_key_chars)
+  {
+    thrust::transform(exec,
+                      permutation_out,
+                      permutation_out + n,
+                      keys.begin(),
+                      detail::string_key_functor<RandomAccessIterator1, RandomAccessIterator2>(chars_first, offsets_first, depth));
+
+    if(depth == 0)
+    {
+      thrust::stable_sort_by_key(exec, keys.begin(), keys.end(), permutation_out);
+    }
+    else
+    {
+      thrust::stable_sort_by_key(exec,
+                                 keys.begin(),
+                                 keys.end(),
+                                 thrust::make_zip_iterator(thrust::make_tuple(permutation_out, groups.begin())));
+      thrust::stable_sort_by_key(exec,
+                                 groups.begin(),
+                                 groups.end(),
+                                 thrust::make_zip_iterator(thrust::make_tuple(permutation_out, keys.begin())));
+    }
+
+    // every string has ended within the keys of this round
+    if(max_length - depth <= detail::string_key_chars)
+      break;
+
+    // a string heads a new group unless its group and key match its predecessor's
+    auto groups_and_keys = thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), keys.begin()));
+
+    heads[0] = 0;
+    thrust::transform(exec,
+                      groups_and_keys,
+                      groups_and_keys + (n - 1),
+                      groups_and_keys + 1,
+                      heads.begin() + 1,
+                      thrust::not_equal_to<thrust::tuple<index_type, key_type>>());
+
+    thrust::inclusive_scan(exec, heads.begin(), heads.end(), groups.begin());
+
+    index_type last_group = groups[n - 1];
+
+    if(last_group == n - 1)
+      break;
+  }
+
+  return permutation_out + n;
+} // end sort_strings()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,9 +22,12 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/transform.h>
 #include <thrust/unique.h>
+#include <thrust/copy.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/detail/count.h>
 #include <thrust/distance.h>
 #include <thrust/functional.h>
@@ -38,6 +42,65 @@ namespace generic
 {
 
 
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  ForwardIterator unique_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                               ForwardIterator first,
+                               ForwardIterator last,
+                               BinaryPredicate binary_pred,
+                               typename thrust::iterator_difference<ForwardIterator>::type tile_size)
+{
+  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
+  using difference_type = typename thrust::iterator_difference<ForwardIterator>::type;
+
+  difference_type n = thrust::distance(first, last);
+
+  if(n <= 0)
+    return first;
+
+  tile_size = (thrust::min)(tile_size, n);
+
+  // the output never overtakes the input, so the range can be compacted
+  // one tile at a time through a copy of its elements. A tile is copied
+  // to the second slot of the copy, after the element before the tile;
+  // head_flags reads the slot before its first element, so the first
+  // slot is there even for the first tile
+  thrust::detail::temporary_array<InputType,DerivedPolicy> input(exec, tile_size + 1);
+
+  using namespace thrust::placeholders;
+
+  ForwardIterator result = first;
+
+  for(difference_type tile_begin = 0; tile_begin < n; tile_begin += tile_size)
+  {
+    const difference_type tile_n = (thrust::min)(tile_size, n - tile_begin);
+
+    // the first element of a tile is compared against the last element of
+    // the previous one, which still holds its original value: either it
+    // was not kept or every element before it was kept in place
+    const difference_type lead = tile_begin > 0 ? 1 : 0;
+
+    thrust::copy(exec, first + (tile_begin - lead), first + (tile_begin + tile_n), input.begin() + (1 - lead));
+
+    thrust::detail::head_flags<typename thrust::detail::temporary_array<InputType,DerivedPolicy>::iterator, BinaryPredicate>
+      stencil(input.begin() + (1 - lead), input.begin() + (1 + tile_n), binary_pred);
+
+    result = thrust::copy_if(exec, input.begin() + 1, input.begin() + (1 + tile_n), stencil.begin() + lead, result, _1);
+  }
+
+  return result;
+} // end unique_tiles()
+
+
+} // end namespace detail
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator>
 THRUST_HOST_DEVICE
@@ -60,11 +123,7 @@ THRUST_HOST_DEVICE
                          ForwardIterator last,
                          BinaryPredicate binary_pred)
 {
-  using InputType = typename thrust::iterator_traits<ForwardIterator>::value_type;
-
-  thrust::detail::temporary_array<InputType,DerivedPolicy> input(exec, first, last);
-
-  return thrust::unique_copy(exec, input.begin(), input.end(), first, binary_pred);
+  return detail::unique_tiles(exec, first, last, binary_pred, detail::copy_if_tile_size);
 } // end unique()
 
 
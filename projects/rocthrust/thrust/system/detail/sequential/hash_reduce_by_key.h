@@ -0,0 +1,288 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file hash_reduce_by_key.h
+ *  \brief Sequential implementation of hash_reduce_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/temporary_allocator.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/hash_reduce_by_key.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstdint>
+#include <new>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace hash_reduce_by_key_detail
+{
+
+
+// the table starts with room for this many keys and doubles when it's full
+const static int initial_capacity = 1 << 8;
+
+
+// spreads the bits of a hash over all of its bits (the finalizer of MurmurHash3),
+// so that the slot of a key depends on all of the bits of its hash
+THRUST_HOST_DEVICE inline std::uint64_t mix_hash(std::uint64_t hash)
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+
+  return hash;
+}
+
+
+// An open addressing hash table of distinct keys and the reductions of their
+// values. The entries are stored in order of insertion, and the slots, twice as
+// many as the entries the table has room for, hold the position of an entry
+// plus one, or zero when empty. The storage is allocated through the execution
+// policy given to insert and is returned by release.
+template<typename Key,
+         typename Value,
+         typename Size>
+struct hash_table
+{
+  Key           *keys;
+  Value         *values;
+  std::uint64_t *hashes;
+  Size          *slots;
+  Size           size;
+  Size           capacity;
+
+  THRUST_HOST_DEVICE
+  hash_table()
+    : keys(0), values(0), hashes(0), slots(0), size(0), capacity(0)
+  {}
+
+  // adds value to the entry of key, or inserts an entry for key; hash is mixed
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename DerivedPolicy,
+           typename BinaryPredicate,
+           typename BinaryFunction>
+  THRUST_HOST_DEVICE
+  void insert(thrust::execution_policy<DerivedPolicy> &exec,
+              const Key &key,
+              const Value &value,
+              std::uint64_t hash,
+              BinaryPredicate &binary_pred,
+              BinaryFunction &binary_op)
+  {
+    if(size == capacity)
+      grow(exec, capacity == 0 ? Size(initial_capacity) : 2 * capacity);
+
+    const Size mask = 2 * capacity - 1;
+
+    for(Size slot = static_cast<Size>(hash) & mask;; slot = (slot + 1) & mask)
+    {
+      const Size entry = slots[slot];
+
+      if(entry == 0)
+      {
+        ::new(static_cast<void *>(keys + size)) Key(key);
+        ::new(static_cast<void *>(values + size)) Value(value);
+        hashes[size] = hash;
+
+        slots[slot] = ++size;
+
+        return;
+      }
+
+      if(hashes[entry - 1] == hash && binary_pred(keys[entry - 1], key))
+      {
+        values[entry - 1] = binary_op(values[entry - 1], value);
+
+        return;
+      }
+    }
+  }
+
+  // makes room for n keys at once
+  template<typename DerivedPolicy>
+  THRUST_HOST_DEVICE
+  void reserve(thrust::execution_policy<DerivedPolicy> &exec, Size n)
+  {
+    Size new_capacity = capacity == 0 ? Size(initial_capacity) : capacity;
+
+    while(new_capacity < n)
+      new_capacity *= 2;
+
+    if(new_capacity > capacity)
+      grow(exec, new_capacity);
+  }
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename DerivedPolicy>
+  THRUST_HOST_DEVICE
+  void release(thrust::execution_policy<DerivedPolicy> &exec)
+  {
+    for(Size i = 0; i < size; ++i)
+    {
+      keys[i].~Key();
+      values[i].~Value();
+    }
+
+    deallocate(exec, keys, capacity);
+    deallocate(exec, values, capacity);
+    deallocate(exec, hashes, capacity);
+    deallocate(exec, slots, 2 * capacity);
+
+    *this = hash_table();
+  }
+
+private:
+  template<typename T, typename DerivedPolicy>
+  THRUST_HOST_DEVICE
+  static T *allocate(thrust::execution_policy<DerivedPolicy> &exec, Size n)
+  {
+    return thrust::raw_pointer_cast(thrust::detail::temporary_allocator<T, DerivedPolicy>(exec).allocate(n));
+  }
+
+  template<typename T, typename DerivedPolicy>
+  THRUST_HOST_DEVICE
+  static void deallocate(thrust::execution_policy<DerivedPolicy> &exec, T *p, Size n)
+  {
+    if(p != 0)
+    {
+      using pointer = typename thrust::detail::temporary_allocator<T, DerivedPolicy>::pointer;
+
+      thrust::detail::temporary_allocator<T, DerivedPolicy>(exec).deallocate(pointer(p), n);
+    }
+  }
+
+  // moves the entries to storage for new_capacity entries and rebuilds the slots
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename DerivedPolicy>
+  THRUST_HOST_DEVICE
+  void grow(thrust::execution_policy<DerivedPolicy> &exec, Size new_capacity)
+  {
+    hash_table grown;
+
+    grown.keys     = allocate<Key>(exec, new_capacity);
+    grown.values   = allocate<Value>(exec, new_capacity);
+    grown.hashes   = allocate<std::uint64_t>(exec, new_capacity);
+    grown.slots    = allocate<Size>(exec, 2 * new_capacity);
+    grown.size     = size;
+    grown.capacity = new_capacity;
+
+    const Size mask = 2 * new_capacity - 1;
+
+    for(Size slot = 0; slot < 2 * new_capacity; ++slot)
+      grown.slots[slot] = 0;
+
+    for(Size i = 0; i < size; ++i)
+    {
+      ::new(static_cast<void *>(grown.keys + i)) Key(keys[i]);
+      ::new(static_cast<void *>(grown.values + i)) Value(values[i]);
+      grown.hashes[i] = hashes[i];
+
+      Size slot = static_cast<Size>(hashes[i]) & mask;
+
+      while(grown.slots[slot] != 0)
+        slot = (slot + 1) & mask;
+
+      grown.slots[slot] = i + 1;
+    }
+
+    release(exec);
+
+    *this = grown;
+  }
+};
+
+
+} // end namespace hash_reduce_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       Hash hash)
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+  using KeyType         = typename thrust::iterator_value<InputIterator1>::type;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  // wrap binary_pred and binary_op
+  thrust::detail::wrapped_function<
+    BinaryPredicate,
+    bool
+  > wrapped_binary_pred(binary_pred);
+
+  thrust::detail::wrapped_function<
+    BinaryFunction,
+    ValueType
+  > wrapped_binary_op(binary_op);
+
+  hash_reduce_by_key_detail::hash_table<KeyType, ValueType, difference_type> table;
+
+  for(; keys_first != keys_last; ++keys_first, ++values_first)
+  {
+    const KeyType   key   = *keys_first;
+    const ValueType value = *values_first;
+
+    table.insert(exec, key, value, hash_reduce_by_key_detail::mix_hash(hash(key)), wrapped_binary_pred, wrapped_binary_op);
+  }
+
+  // the keys are written in order of their first occurrence
+  for(difference_type i = 0; i < table.size; ++i, ++keys_output, ++values_output)
+  {
+    *keys_output   = table.keys[i];
+    *values_output = table.values[i];
+  }
+
+  table.release(exec);
+
+  return thrust::make_pair(keys_output, values_output);
+} // end hash_reduce_by_key()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
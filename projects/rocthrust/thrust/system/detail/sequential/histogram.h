@@ -0,0 +1,131 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file histogram.h
+ *  \brief Sequential implementation of histogram algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace histogram_detail
+{
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+THRUST_HOST_DEVICE
+  RandomAccessIterator count_bins(InputIterator first,
+                                  InputIterator last,
+                                  RandomAccessIterator histogram,
+                                  int num_bins,
+                                  BinFunction bin_op)
+{
+  using Counter = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  if(num_bins <= 0)
+    return histogram;
+
+  for(int i = 0; i < num_bins; ++i)
+  {
+    histogram[i] = Counter(0);
+  }
+
+  // count every sample in a single pass
+  for(; first != last; ++first)
+  {
+    const int bin = bin_op(*first);
+
+    if(bin < num_bins)
+    {
+      histogram[bin] = histogram[bin] + Counter(1);
+    }
+  }
+
+  return histogram + num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+THRUST_HOST_DEVICE
+  RandomAccessIterator histogram_even(sequential::execution_policy<DerivedPolicy> &,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level)
+{
+  using thrust::system::detail::generic::detail::histogram_even_bin;
+
+  return histogram_detail::count_bins(first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_even_bin<LevelType>(lower_level, upper_level, num_levels - 1));
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+THRUST_HOST_DEVICE
+  RandomAccessIterator1 histogram_range(sequential::execution_policy<DerivedPolicy> &,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last)
+{
+  using thrust::system::detail::generic::detail::histogram_range_bin;
+
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_range_bin<RandomAccessIterator2>(levels_first, num_levels));
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
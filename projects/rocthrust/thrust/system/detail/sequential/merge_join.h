@@ -0,0 +1,286 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file merge_join.h
+ *  \brief Sequential implementations of merge_join, merge_left_outer_join and merge_semi_join.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/merge_join.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace merge_join_detail
+{
+
+
+enum join_kind
+{
+  inner_join,
+  left_outer_join,
+  semi_join
+};
+
+
+// Joins the keys [begin1, end1) of the first range with the keys [begin2, end2)
+// of the second range in a single merge pass, passing the positions of every
+// joined pair to sink. An element of the first range without a match is passed
+// with the position -1 by a left outer join, and only the first match of an
+// element is passed by a semi join. The ranges are expected to hold all of the
+// keys of both ranges which are equivalent to any of them.
+THRUST_EXEC_CHECK_DISABLE
+template<join_kind Kind,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename StrictWeakCompare,
+         typename Sink>
+THRUST_HOST_DEVICE
+  void join(InputIterator1 keys1_first,
+            typename thrust::iterator_difference<InputIterator1>::type begin1,
+            typename thrust::iterator_difference<InputIterator1>::type end1,
+            InputIterator2 keys2_first,
+            typename thrust::iterator_difference<InputIterator2>::type begin2,
+            typename thrust::iterator_difference<InputIterator2>::type end2,
+            StrictWeakCompare &comp,
+            Sink &sink)
+{
+  using difference_type1 = typename thrust::iterator_difference<InputIterator1>::type;
+  using difference_type2 = typename thrust::iterator_difference<InputIterator2>::type;
+  using value_type1      = typename thrust::iterator_value<InputIterator1>::type;
+  using value_type2      = typename thrust::iterator_value<InputIterator2>::type;
+
+  difference_type1 i = begin1;
+  difference_type2 j = begin2;
+
+  while(i < end1 && j < end2)
+  {
+    const value_type1 key1 = keys1_first[i];
+    const value_type2 key2 = keys2_first[j];
+
+    if(comp(key1, key2))
+    {
+      if(Kind == left_outer_join)
+        sink(i, difference_type2(-1));
+
+      ++i;
+    }
+    else if(comp(key2, key1))
+    {
+      ++j;
+    }
+    else
+    {
+      // keys2 [j, j_last) are equivalent to key1
+      difference_type2 j_last = j + 1;
+
+      while(j_last < end2 && !comp(key1, keys2_first[j_last]))
+        ++j_last;
+
+      // and so are keys1 [i, i_last)
+      do
+      {
+        if(Kind == semi_join)
+        {
+          sink(i, j);
+        }
+        else
+        {
+          for(difference_type2 k = j; k < j_last; ++k)
+            sink(i, k);
+        }
+
+        ++i;
+      }
+      while(i < end1 && !comp(key2, keys1_first[i]));
+
+      j = j_last;
+    }
+  }
+
+  if(Kind == left_outer_join)
+  {
+    for(; i < end1; ++i)
+      sink(i, difference_type2(-1));
+  }
+} // end join()
+
+
+// writes the positions of both elements of every joined pair
+template<typename OutputIterator1,
+         typename OutputIterator2>
+struct pair_writer
+{
+  OutputIterator1 index1_output;
+  OutputIterator2 index2_output;
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename Index1, typename Index2>
+  THRUST_HOST_DEVICE
+  void operator()(Index1 i, Index2 j)
+  {
+    *index1_output = i;
+    *index2_output = j;
+
+    ++index1_output;
+    ++index2_output;
+  }
+};
+
+
+// writes the position of the element of the first range of every joined pair
+template<typename OutputIterator>
+struct index_writer
+{
+  OutputIterator index1_output;
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename Index1, typename Index2>
+  THRUST_HOST_DEVICE
+  void operator()(Index1 i, Index2)
+  {
+    *index1_output = i;
+
+    ++index1_output;
+  }
+};
+
+
+template<typename Size>
+struct pair_counter
+{
+  Size count;
+
+  template<typename Index1, typename Index2>
+  THRUST_HOST_DEVICE
+  void operator()(Index1, Index2)
+  {
+    ++count;
+  }
+};
+
+
+} // end namespace merge_join_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(sequential::execution_policy<DerivedPolicy> &,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakCompare,
+    bool
+  > wrapped_comp(comp);
+
+  merge_join_detail::pair_writer<OutputIterator1, OutputIterator2> sink = {index1_output, index2_output};
+
+  merge_join_detail::join<merge_join_detail::inner_join>(
+    keys1_first, 0, keys1_last - keys1_first, keys2_first, 0, keys2_last - keys2_first, wrapped_comp, sink);
+
+  return thrust::make_pair(sink.index1_output, sink.index2_output);
+} // end merge_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(sequential::execution_policy<DerivedPolicy> &,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakCompare,
+    bool
+  > wrapped_comp(comp);
+
+  merge_join_detail::pair_writer<OutputIterator1, OutputIterator2> sink = {index1_output, index2_output};
+
+  merge_join_detail::join<merge_join_detail::left_outer_join>(
+    keys1_first, 0, keys1_last - keys1_first, keys2_first, 0, keys2_last - keys2_first, wrapped_comp, sink);
+
+  return thrust::make_pair(sink.index1_output, sink.index2_output);
+} // end merge_left_outer_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  OutputIterator1 merge_semi_join(sequential::execution_policy<DerivedPolicy> &,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakCompare,
+    bool
+  > wrapped_comp(comp);
+
+  merge_join_detail::index_writer<OutputIterator1> sink = {index1_output};
+
+  merge_join_detail::join<merge_join_detail::semi_join>(
+    keys1_first, 0, keys1_last - keys1_first, keys2_first, 0, keys2_last - keys2_first, wrapped_comp, sink);
+
+  return sink.index1_output;
+} // end merge_semi_join()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,368 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file multiway_merge.h
+ *  \brief Sequential implementation of multiway_merge, using a loser tree.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/swap.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace multiway_merge_detail
+{
+
+
+// A loser tree over num_runs runs. The runs are the leaves of a complete binary
+// tree, padded with empty runs to a power of two leaves, every internal node
+// holds the head of the run which lost the match played there and node 0 holds
+// the overall winner, so advancing the winner only replays the log2(num_runs)
+// matches on the path from its leaf to the root. The heads are copied into the
+// nodes, so that a match doesn't have to dereference the runs.
+//
+// An exhausted run loses every match, and equivalent heads are won by the
+// earlier run, which makes the merge stable. Since the leaves are in the order
+// of the runs, the loser kept at a node comes from an earlier run exactly when
+// the challenger comes up from the right child, and every match takes a single
+// comparison.
+template<typename Iterator,
+         typename Size,
+         typename StrictWeakCompare>
+class loser_tree
+{
+  public:
+    using value_type = typename thrust::iterator_value<Iterator>::type;
+
+    // the number of leaves of the tree over num_runs runs
+    THRUST_HOST_DEVICE
+    static Size num_leaves(Size num_runs)
+    {
+      Size result = 1;
+
+      while(result < num_runs)
+        result *= 2;
+
+      return result;
+    }
+
+    // sources has room for 2 * num_leaves(num_runs) entries, keys and
+    // exhausted for num_leaves(num_runs) entries
+    THRUST_HOST_DEVICE
+    loser_tree(Iterator *heads,
+               Iterator *ends,
+               Size *sources,
+               value_type *keys,
+               bool *exhausted,
+               Size num_runs,
+               StrictWeakCompare comp)
+      : m_heads(heads), m_ends(ends), m_sources(sources), m_keys(keys), m_exhausted(exhausted),
+        m_num_runs(num_runs), m_num_leaves(num_leaves(num_runs)), m_comp(comp)
+    {
+      // play the matches bottom-up; the winner of internal node i is kept in
+      // sources[num_leaves + i] until the match at its parent has been played
+      for(Size node = m_num_leaves - 1; node > 0; --node)
+      {
+        Size left  = winner_of(2 * node);
+        Size right = winner_of(2 * node + 1);
+
+        if(beats(left, right))
+        {
+          thrust::swap(left, right);
+        }
+
+        m_sources[node]                = left;
+        m_sources[m_num_leaves + node] = right;
+
+        load(node, left);
+      }
+
+      m_sources[0] = winner_of(1);
+
+      load(0, m_sources[0]);
+    }
+
+    // the run whose head is the next element of the merge
+    THRUST_HOST_DEVICE
+    Size winner() const
+    {
+      return m_sources[0];
+    }
+
+    // the next element of the merge
+    THRUST_HOST_DEVICE
+    const value_type &top() const
+    {
+      return m_keys[0];
+    }
+
+    // advances the winner past its head and finds the new winner
+    THRUST_HOST_DEVICE
+    void pop()
+    {
+      Size source = m_sources[0];
+
+      ++m_heads[source];
+
+      bool       exhausted = m_heads[source] == m_ends[source];
+      value_type key       = exhausted ? m_keys[0] : value_type(*m_heads[source]);
+
+      for(Size child = m_num_leaves + source, node = child / 2; node > 0; child = node, node /= 2)
+      {
+        const bool from_right = (child & 1) != 0;
+
+        const value_type &lhs = from_right ? key : m_keys[node];
+        const value_type &rhs = from_right ? m_keys[node] : key;
+
+        // whether the loser kept at node wins this match
+        bool node_wins = m_comp(lhs, rhs) != from_right;
+
+        if(m_exhausted[node])
+          node_wins = false;
+        else if(exhausted)
+          node_wins = true;
+
+        if(node_wins)
+        {
+          thrust::swap(source, m_sources[node]);
+          thrust::swap(key, m_keys[node]);
+          thrust::swap(exhausted, m_exhausted[node]);
+        }
+      }
+
+      m_sources[0]   = source;
+      m_keys[0]      = key;
+      m_exhausted[0] = exhausted;
+    }
+
+  private:
+    Iterator   *m_heads;
+    Iterator   *m_ends;
+    Size       *m_sources;
+    value_type *m_keys;
+    bool       *m_exhausted;
+    Size        m_num_runs;
+    Size        m_num_leaves;
+
+    thrust::detail::wrapped_function<StrictWeakCompare, bool> m_comp;
+
+    THRUST_HOST_DEVICE
+    Size winner_of(Size node) const
+    {
+      return node >= m_num_leaves ? node - m_num_leaves : m_sources[m_num_leaves + node];
+    }
+
+    THRUST_HOST_DEVICE
+    bool is_exhausted(Size run) const
+    {
+      return run >= m_num_runs || m_heads[run] == m_ends[run];
+    }
+
+    // copies the head of run to node
+    THRUST_HOST_DEVICE
+    void load(Size node, Size run)
+    {
+      m_exhausted[node] = is_exhausted(run);
+
+      if(!m_exhausted[node])
+      {
+        m_keys[node] = *m_heads[run];
+      }
+    }
+
+    // whether the head of run a precedes the head of run b, during construction
+    THRUST_HOST_DEVICE
+    bool beats(Size a, Size b) const
+    {
+      if(is_exhausted(a))
+        return false;
+
+      if(is_exhausted(b))
+        return true;
+
+      return a < b ? !m_comp(*m_heads[b], *m_heads[a]) : m_comp(*m_heads[a], *m_heads[b]);
+    }
+};
+
+
+} // end namespace multiway_merge_detail
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  RandomAccessIterator2 multiway_merge(sequential::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp)
+{
+  using run_type   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using iterator   = typename run_type::first_type;
+  using value_type = typename thrust::iterator_value<iterator>::type;
+  using size_type  = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  const size_type num_runs = runs_last - runs_first;
+
+  if(num_runs <= 0)
+    return result;
+
+  thrust::detail::temporary_array<iterator, DerivedPolicy>  heads(exec, num_runs);
+  thrust::detail::temporary_array<iterator, DerivedPolicy>  ends(exec, num_runs);
+
+  using tree_type = multiway_merge_detail::loser_tree<iterator, size_type, StrictWeakCompare>;
+
+  const size_type num_leaves = tree_type::num_leaves(num_runs);
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy>  sources(exec, 2 * num_leaves);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> keys(exec, num_leaves);
+  thrust::detail::temporary_array<bool, DerivedPolicy>       exhausted(exec, num_leaves);
+
+  typename thrust::iterator_difference<iterator>::type n = 0;
+
+  for(size_type i = 0; i < num_runs; ++i)
+  {
+    run_type run = runs_first[i];
+
+    heads[i] = run.first;
+    ends[i]  = run.second;
+    n       += run.second - run.first;
+  }
+
+  iterator *raw_heads = thrust::raw_pointer_cast(heads.data());
+
+  tree_type losers(raw_heads,
+                   thrust::raw_pointer_cast(ends.data()),
+                   thrust::raw_pointer_cast(sources.data()),
+                   thrust::raw_pointer_cast(keys.data()),
+                   thrust::raw_pointer_cast(exhausted.data()),
+                   num_runs,
+                   comp);
+
+  for(; n > 0; --n)
+  {
+    *result = losers.top();
+    ++result;
+
+    losers.pop();
+  }
+
+  return result;
+}
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+THRUST_HOST_DEVICE
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp)
+{
+  using run_type       = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using iterator       = typename run_type::first_type;
+  using key_type       = typename thrust::iterator_value<iterator>::type;
+  using value_iterator = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using size_type      = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  const size_type num_runs = key_runs_last - key_runs_first;
+
+  if(num_runs <= 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  thrust::detail::temporary_array<iterator, DerivedPolicy>       heads(exec, num_runs);
+  thrust::detail::temporary_array<iterator, DerivedPolicy>       ends(exec, num_runs);
+  thrust::detail::temporary_array<value_iterator, DerivedPolicy> value_heads(exec, num_runs);
+
+  using tree_type = multiway_merge_detail::loser_tree<iterator, size_type, StrictWeakCompare>;
+
+  const size_type num_leaves = tree_type::num_leaves(num_runs);
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> sources(exec, 2 * num_leaves);
+  thrust::detail::temporary_array<key_type, DerivedPolicy>  keys(exec, num_leaves);
+  thrust::detail::temporary_array<bool, DerivedPolicy>      exhausted(exec, num_leaves);
+
+  typename thrust::iterator_difference<iterator>::type n = 0;
+
+  for(size_type i = 0; i < num_runs; ++i)
+  {
+    run_type run = key_runs_first[i];
+
+    heads[i]       = run.first;
+    ends[i]        = run.second;
+    value_heads[i] = value_runs_first[i];
+    n             += run.second - run.first;
+  }
+
+  iterator       *raw_heads       = thrust::raw_pointer_cast(heads.data());
+  value_iterator *raw_value_heads = thrust::raw_pointer_cast(value_heads.data());
+
+  tree_type losers(raw_heads,
+                   thrust::raw_pointer_cast(ends.data()),
+                   thrust::raw_pointer_cast(sources.data()),
+                   thrust::raw_pointer_cast(keys.data()),
+                   thrust::raw_pointer_cast(exhausted.data()),
+                   num_runs,
+                   comp);
+
+  for(; n > 0; --n)
+  {
+    const size_type winner = losers.winner();
+
+    *keys_result   = losers.top();
+    *values_result = *raw_value_heads[winner];
+
+    ++keys_result;
+    ++values_result;
+    ++raw_value_heads[winner];
+
+    losers.pop();
+  }
+
+  return thrust::make_pair(keys_result, values_result);
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,300 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+/*! \file partial_sort.h
+ *  \brief Sequential implementations of selection and partial sort algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace partial_sort_detail
+{
+
+
+// Ranges of up to this many elements are finished with an insertion sort.
+const static int insertion_sort_threshold = 16;
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator>
+THRUST_HOST_DEVICE
+  void swap_values(RandomAccessIterator a, RandomAccessIterator b)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  value_type tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator median_of_three(RandomAccessIterator a,
+                                       RandomAccessIterator b,
+                                       RandomAccessIterator c,
+                                       StrictWeakOrdering &comp)
+{
+  if(comp(*a, *b))
+  {
+    if(comp(*b, *c)) return b;
+    return comp(*a, *c) ? c : a;
+  }
+
+  if(comp(*a, *c)) return a;
+  return comp(*b, *c) ? c : b;
+}
+
+
+// The policies of the host systems which don't select in parallel come
+// through here as well; the sorts must not dispatch on them, as they would
+// run the parallel algorithms of those systems, so they sort with seq.
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void seq_stable_sort(RandomAccessIterator first,
+                       RandomAccessIterator last,
+                       StrictWeakOrdering comp)
+{
+  thrust::detail::seq_t seq;
+  sequential::stable_sort(seq, first, last, comp);
+}
+
+
+// Quickselect with median of three pivots, which falls back to sorting the
+// remaining range once the partitions have failed to shrink it quickly
+// enough. The worst case is bounded by O(n log n).
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void introselect(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  int depth_limit = 0;
+  for(typename thrust::iterator_difference<RandomAccessIterator>::type n = last - first; n > 1; n /= 2)
+  {
+    depth_limit += 2;
+  }
+
+  while(last - first > insertion_sort_threshold)
+  {
+    if(depth_limit-- == 0)
+    {
+      partial_sort_detail::seq_stable_sort(first, last, comp);
+      return;
+    }
+
+    swap_values(first, median_of_three(first, first + (last - first) / 2, last - 1, wrapped_comp));
+
+    const value_type pivot = *first;
+
+    // Hoare partition of [first + 1, last) around the pivot; elements
+    // equivalent to it are spread over both sides
+    RandomAccessIterator i = first + 1;
+    RandomAccessIterator j = last - 1;
+
+    while(true)
+    {
+      while(i <= j && wrapped_comp(*i, pivot)) ++i;
+      while(i <= j && wrapped_comp(pivot, *j)) --j;
+
+      if(i >= j)
+        break;
+
+      swap_values(i, j);
+      ++i;
+      --j;
+    }
+
+    // [first, j) is not greater than the pivot and (j, last) is not less
+    swap_values(first, j);
+
+    if(nth == j)
+      return;
+
+    if(nth < j)
+      last = j;
+    else
+      first = j + 1;
+  }
+
+  sequential::insertion_sort(first, last, comp);
+}
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void sift_down(RandomAccessIterator heap, Size i, Size n, StrictWeakOrdering &comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  const value_type x = heap[i];
+
+  for(Size child = 2 * i + 1; child < n; child = 2 * i + 1)
+  {
+    if(child + 1 < n && comp(heap[child], heap[child + 1]))
+      ++child;
+
+    if(!comp(x, heap[child]))
+      break;
+
+    heap[i] = heap[child];
+    i = child;
+  }
+
+  heap[i] = x;
+}
+
+
+} // end namespace partial_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void nth_element(sequential::execution_policy<DerivedPolicy> &,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  if(nth == last)
+    return;
+
+  partial_sort_detail::introselect(first, nth, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void partial_sort(sequential::execution_policy<DerivedPolicy> &,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  if(first == middle)
+    return;
+
+  if(middle != last)
+  {
+    partial_sort_detail::introselect(first, middle, last, comp);
+  }
+
+  partial_sort_detail::seq_stable_sort(first, middle, comp);
+}
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  RandomAccessIterator partial_sort_copy(sequential::execution_policy<DerivedPolicy> &,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  using value_type      = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  RandomAccessIterator result = result_first;
+
+  for(; first != last && result != result_last; ++first, ++result)
+  {
+    *result = *first;
+  }
+
+  const difference_type r = result - result_first;
+
+  if(r == 0)
+    return result;
+
+  // keep the smallest elements seen so far in a heap with the greatest on top
+  for(difference_type i = r / 2; i > 0; --i)
+  {
+    partial_sort_detail::sift_down(result_first, i - 1, r, wrapped_comp);
+  }
+
+  for(; first != last; ++first)
+  {
+    const value_type x = *first;
+
+    if(wrapped_comp(x, *result_first))
+    {
+      *result_first = x;
+      partial_sort_detail::sift_down(result_first, difference_type(0), r, wrapped_comp);
+    }
+  }
+
+  partial_sort_detail::seq_stable_sort(result_first, result, comp);
+
+  return result;
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
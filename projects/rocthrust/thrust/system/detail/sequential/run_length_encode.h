@@ -0,0 +1,125 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file run_length_encode.h
+ *  \brief Sequential implementation of run-length encoding and decoding.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+THRUST_HOST_DEVICE
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(sequential::execution_policy<DerivedPolicy> &,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred)
+{
+  using count_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  // wrap binary_pred
+  thrust::detail::wrapped_function<
+    BinaryPredicate,
+    bool
+  > wrapped_binary_pred(binary_pred);
+
+  if(first == last)
+    return thrust::make_pair(values_output, counts_output);
+
+  // a single pass, which extends the current run until an element doesn't match its predecessor
+  RandomAccessIterator run = first;
+
+  for(RandomAccessIterator prev = first, next = first + 1; next != last; prev = next, ++next)
+  {
+    if(!wrapped_binary_pred(*prev, *next))
+    {
+      *values_output = *run;
+      *counts_output = static_cast<count_type>(next - run);
+
+      ++values_output;
+      ++counts_output;
+
+      run = next;
+    }
+  }
+
+  *values_output = *run;
+  *counts_output = static_cast<count_type>(last - run);
+
+  ++values_output;
+  ++counts_output;
+
+  return thrust::make_pair(values_output, counts_output);
+}
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 run_length_decode(sequential::execution_policy<DerivedPolicy> &,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result)
+{
+  using count_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  for(; values_first != values_last; ++values_first, ++counts_first)
+  {
+    const count_type count = *counts_first;
+
+    for(count_type i = 0; i < count; ++i)
+    {
+      *result = *values_first;
+      ++result;
+    }
+  }
+
+  return result;
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,87 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file segmented_reduce.h
+ *  \brief Sequential implementation of segmented reduce algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+THRUST_HOST_DEVICE
+  OutputIterator segmented_transform_reduce(sequential::execution_policy<DerivedPolicy> &,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<
+    BinaryFunction,
+    T
+  > wrapped_binary_op(binary_op);
+
+  for(; offsets_last - offsets_first > 1; ++offsets_first, ++result)
+  {
+    const offset_type begin = offsets_first[0];
+    const offset_type end   = offsets_first[1];
+
+    T sum = init;
+
+    for(offset_type i = begin; i < end; ++i)
+    {
+      sum = wrapped_binary_op(sum, unary_op(values_first[i]));
+    }
+
+    *result = sum;
+  }
+
+  return result;
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,119 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+/*! \file segmented_sort.h
+ *  \brief Sequential implementation of segmented sort algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace segmented_sort_detail
+{
+
+
+// Segments of up to this many keys are insertion sorted, which avoids the
+// setup cost of the general sort for the many short segments of a typical input.
+const static int insertion_sort_threshold = 32;
+
+
+} // end namespace segmented_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  for(; offsets_last - offsets_first > 1; ++offsets_first)
+  {
+    const offset_type begin = offsets_first[0];
+    const offset_type end   = offsets_first[1];
+
+    if(end - begin <= segmented_sort_detail::insertion_sort_threshold)
+    {
+      sequential::insertion_sort(keys_first + begin, keys_first + end, comp);
+    }
+    else
+    {
+      sequential::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+THRUST_HOST_DEVICE
+  void segmented_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator3>::type;
+
+  for(; offsets_last - offsets_first > 1; ++offsets_first)
+  {
+    const offset_type begin = offsets_first[0];
+    const offset_type end   = offsets_first[1];
+
+    if(end - begin <= segmented_sort_detail::insertion_sort_threshold)
+    {
+      sequential::insertion_sort_by_key(keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+    else
+    {
+      sequential::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+  }
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,373 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file sort_strings.h
+ *  \brief Sequential implementation of sort_strings, using a most significant
+ *         digit radix sort and a multikey quicksort.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/swap.h>
+#include <thrust/system/detail/generic/sort_strings.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace sort_strings_detail
+{
+
+
+// Ranges of at least this many strings are distributed into buckets by their
+// next character, smaller ranges are partitioned by multikey quicksort.
+const static int radix_sort_threshold = 1 << 10;
+
+// Ranges of up to this many strings are finished with an insertion sort.
+const static int insertion_sort_threshold = 16;
+
+
+// The strings of permutation positions [first, last) are equal up to depth;
+// when cached is set, the keys of the strings at key_depth are in place.
+template<typename Index,
+         typename Offset>
+struct task
+{
+  Index  first;
+  Index  last;
+  Offset depth;
+  Offset key_depth;
+  bool   cached;
+};
+
+
+// The radix digit of the string with this key, read at key_depth, at the depth
+// key_depth + k: 0 if the string ends before it, and the character plus 1
+// otherwise.
+THRUST_HOST_DEVICE
+inline int radix_digit(std::uint64_t key, int k)
+{
+  const int remaining = static_cast<int>(key & 0xff);
+
+  return remaining > k ? static_cast<int>((key >> (8 * (7 - k))) & 0xff) + 1 : 0;
+}
+
+
+// orders the indices of strings equal up to depth by the rest of the strings,
+// then by index
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+struct suffix_less
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  RandomAccessIterator1 chars_first;
+  RandomAccessIterator2 offsets_first;
+  offset_type           depth;
+
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename Index>
+  THRUST_HOST_DEVICE
+  bool operator()(Index a, Index b) const
+  {
+    offset_type       i      = offsets_first[a] + depth;
+    offset_type       j      = offsets_first[b] + depth;
+    const offset_type a_last = offsets_first[a + 1];
+    const offset_type b_last = offsets_first[b + 1];
+
+    for(; i < a_last && j < b_last; ++i, ++j)
+    {
+      const unsigned char x = static_cast<unsigned char>(chars_first[i]);
+      const unsigned char y = static_cast<unsigned char>(chars_first[j]);
+
+      if(x != y)
+        return x < y;
+    }
+
+    if(i < a_last || j < b_last)
+      return j < b_last;
+
+    return a < b;
+  }
+};
+
+
+// Sorts the count strings of the permutation [perm, perm + count), which are
+// equal up to depth. Both phases work on the keys of string_key_chars
+// characters cached in keys, so the characters of a string are read once for
+// every string_key_chars characters of depth rather than once per character.
+// Ranges of radix_sort_threshold strings or more are distributed into buckets
+// by their character at depth, and the keys move along with the strings, so the
+// buckets can go on with the next character of the keys. Smaller ranges are
+// split into the strings less than, equal to and greater than a pivot key.
+//
+// The pending ranges are kept on an explicit stack instead of recursing. They
+// are disjoint and hold at least 2 strings each, so stack needs room for
+// count / 2 + 1 entries. buffer, keys and key_buffer need room for count
+// entries.
+// Equal strings end up in the order of their indices, since the distribution
+// is stable and equal strings split off by the quicksort are sorted by index.
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Index,
+         typename Offset>
+THRUST_HOST_DEVICE
+  void sort_range(sequential::execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator1 chars_first,
+                  RandomAccessIterator2 offsets_first,
+                  RandomAccessIterator3 perm,
+                  Index *buffer,
+                  std::uint64_t *keys,
+                  std::uint64_t *key_buffer,
+                  task<Index, Offset> *stack,
+                  Index count,
+                  Offset depth)
+{
+  using thrust::system::detail::generic::detail::string_key;
+  using thrust::system::detail::generic::detail::string_key_chars;
+  using thrust::system::detail::generic::detail::string_key_continues;
+
+  const int num_digits = 257;
+
+  if(count < 2)
+    return;
+
+  Index top = 0;
+  stack[top++] = task<Index, Offset>{Index(0), count, depth, depth, false};
+
+  while(top > 0)
+  {
+    const task<Index, Offset> t = stack[--top];
+
+    const Index first = t.first;
+    const Index last  = t.last;
+
+    if(last - first <= insertion_sort_threshold)
+    {
+      suffix_less<RandomAccessIterator1, RandomAccessIterator2> comp = {chars_first, offsets_first, t.depth};
+
+      sequential::insertion_sort(perm + first, perm + last, comp);
+    }
+    else
+    {
+      const bool radix = last - first >= radix_sort_threshold;
+
+      // a radix pass can go on with keys read at a smaller depth, as long as
+      // they hold the character at depth
+      Offset key_depth = t.key_depth;
+
+      if(!t.cached || (radix ? t.depth - key_depth >= string_key_chars : t.depth != key_depth))
+      {
+        key_depth = t.depth;
+
+        for(Index i = first; i < last; ++i)
+        {
+          const Index  s     = perm[i];
+          const Offset begin = offsets_first[s];
+
+          keys[i] = string_key(chars_first + begin, static_cast<Offset>(offsets_first[s + 1] - begin), key_depth);
+        }
+      }
+
+      if(radix)
+      {
+        const int k = static_cast<int>(t.depth - key_depth);
+
+        // digit 0 is the end of a string, digit c + 1 is the character c
+        Index bucket_ends[num_digits];
+
+        for(int d = 0; d < num_digits; ++d)
+          bucket_ends[d] = 0;
+
+        for(Index i = first; i < last; ++i)
+        {
+          ++bucket_ends[radix_digit(keys[i], k)];
+        }
+
+        const int first_digit = radix_digit(keys[first], k);
+
+        if(bucket_ends[first_digit] == last - first)
+        {
+          // the strings share the character, so there's nothing to distribute
+          if(first_digit != 0)
+            stack[top++] = task<Index, Offset>{first, last, static_cast<Offset>(t.depth + 1), key_depth, true};
+
+          continue;
+        }
+
+        Index sum = first;
+        for(int d = 0; d < num_digits; ++d)
+        {
+          const Index bucket_size = bucket_ends[d];
+          bucket_ends[d] = sum;
+          sum += bucket_size;
+        }
+
+        // bucket_ends[d] moves from the beginning to the end of bucket d
+        for(Index i = first; i < last; ++i)
+        {
+          const Index j = bucket_ends[radix_digit(keys[i], k)]++;
+
+          buffer[j]     = perm[i];
+          key_buffer[j] = keys[i];
+        }
+
+        for(Index i = first; i < last; ++i)
+        {
+          perm[i] = buffer[i];
+          keys[i] = key_buffer[i];
+        }
+
+        // the strings which ended at depth are equal, and already in the order
+        // of their indices
+        for(int d = 1; d < num_digits; ++d)
+        {
+          const Index bucket_first = bucket_ends[d - 1];
+          const Index bucket_last  = bucket_ends[d];
+
+          if(bucket_last - bucket_first > 1)
+            stack[top++] = task<Index, Offset>{bucket_first, bucket_last, static_cast<Offset>(t.depth + 1), key_depth, true};
+        }
+
+        continue;
+      }
+
+      // median of three pivot
+      std::uint64_t a = keys[first];
+      std::uint64_t b = keys[first + (last - first) / 2];
+      std::uint64_t c = keys[last - 1];
+
+      const std::uint64_t pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+      // [first, lt) is less than the pivot, [lt, i) equal and [gt, last) greater
+      Index lt = first;
+      Index i  = first;
+      Index gt = last;
+
+      while(i < gt)
+      {
+        if(keys[i] < pivot)
+        {
+          thrust::swap(keys[i], keys[lt]);
+          thrust::swap(perm[i], perm[lt]);
+          ++lt;
+          ++i;
+        }
+        else if(pivot < keys[i])
+        {
+          --gt;
+          thrust::swap(keys[i], keys[gt]);
+          thrust::swap(perm[i], perm[gt]);
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      if(lt - first > 1)
+        stack[top++] = task<Index, Offset>{first, lt, t.depth, t.depth, true};
+
+      if(last - gt > 1)
+        stack[top++] = task<Index, Offset>{gt, last, t.depth, t.depth, true};
+
+      if(gt - lt > 1)
+      {
+        if(string_key_continues(pivot))
+        {
+          const Offset next_depth = static_cast<Offset>(t.depth + string_key_chars);
+
+          stack[top++] = task<Index, Offset>{lt, gt, next_depth, next_depth, false};
+        }
+        else
+        {
+          sequential::stable_sort(exec, perm + lt, perm + gt, thrust::less<Index>());
+        }
+      }
+    }
+  }
+} // end sort_range()
+
+
+} // end namespace sort_strings_detail
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+THRUST_HOST_DEVICE
+  RandomAccessIterator3 sort_strings(sequential::execution_policy<DerivedPolicy> &exec,
+                                     RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+  using task_type   = sort_strings_detail::task<index_type, offset_type>;
+
+  const index_type n = static_cast<index_type>(offsets_last - offsets_first) - 1;
+
+  if(n <= 0)
+    return permutation_out;
+
+  for(index_type i = 0; i < n; ++i)
+  {
+    permutation_out[i] = i;
+  }
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy>    buffer(exec, n);
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> keys(exec, n);
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> key_buffer(exec, n);
+  thrust::detail::temporary_array<task_type, DerivedPolicy>     stack(exec, n / 2 + 1);
+
+  sort_strings_detail::sort_range(exec,
+                                  chars_first,
+                                  offsets_first,
+                                  permutation_out,
+                                  thrust::raw_pointer_cast(buffer.data()),
+                                  thrust::raw_pointer_cast(keys.data()),
+                                  thrust::raw_pointer_cast(key_buffer.data()),
+                                  thrust::raw_pointer_cast(stack.data()),
+                                  n,
+                                  offset_type(0));
+
+  return permutation_out + n;
+} // end sort_strings()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,231 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+// Up to this many bins every thread counts into its own private copy of the
+// histogram, and the copies are summed at the end. Larger histograms are
+// counted directly into a single shared copy with atomic increments.
+const static int privatization_threshold = 1 << 16;
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+  RandomAccessIterator count_bins(execution_policy<DerivedPolicy> &exec,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  RandomAccessIterator histogram,
+                                  int num_bins,
+                                  BinFunction bin_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using Counter    = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using index_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  if(num_bins <= 0)
+    return histogram;
+
+  const index_type n = thrust::distance(first, last);
+
+  if(num_bins <= privatization_threshold)
+  {
+    const int num_threads = omp_get_max_threads();
+
+    // one row of counts per thread
+    thrust::detail::temporary_array<std::size_t, DerivedPolicy> private_bins(exec, static_cast<std::size_t>(num_threads) * num_bins);
+    std::size_t *counts = thrust::raw_pointer_cast(private_bins.data());
+
+    THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+    {
+      const int thread_id = omp_get_thread_num();
+
+      std::size_t *thread_counts = counts + static_cast<std::size_t>(thread_id) * num_bins;
+
+      for(int i = 0; i < num_bins; ++i)
+      {
+        thread_counts[i] = 0;
+      }
+
+      thrust::system::detail::internal::uniform_decomposition<index_type> decomp(n, 1, omp_get_num_threads());
+
+      if(thread_id < decomp.size())
+      {
+        InputIterator iter = first + decomp[thread_id].begin();
+
+        for(index_type i = decomp[thread_id].begin(); i < decomp[thread_id].end(); ++i, ++iter)
+        {
+          const int bin = bin_op(*iter);
+
+          if(bin < num_bins)
+          {
+            ++thread_counts[bin];
+          }
+        }
+      }
+
+      THRUST_PRAGMA_OMP(barrier)
+
+      // merge the private histograms, every thread summing a subset of the bins
+      const int active_threads = omp_get_num_threads();
+
+      THRUST_PRAGMA_OMP(for)
+      for(int bin = 0; bin < num_bins; ++bin)
+      {
+        std::size_t sum = 0;
+
+        for(int t = 0; t < active_threads; ++t)
+        {
+          sum += counts[static_cast<std::size_t>(t) * num_bins + bin];
+        }
+
+        histogram[bin] = static_cast<Counter>(sum);
+      }
+    }
+  }
+  else
+  {
+    thrust::detail::temporary_array<std::size_t, DerivedPolicy> shared_bins(exec, num_bins);
+    std::size_t *counts = thrust::raw_pointer_cast(shared_bins.data());
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(int bin = 0; bin < num_bins; ++bin)
+    {
+      counts[bin] = 0;
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(index_type i = 0; i < n; ++i)
+    {
+      const int bin = bin_op(first[i]);
+
+      if(bin < num_bins)
+      {
+        THRUST_PRAGMA_OMP(atomic)
+        ++counts[bin];
+      }
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(int bin = 0; bin < num_bins; ++bin)
+    {
+      histogram[bin] = static_cast<Counter>(counts[bin]);
+    }
+  }
+
+  return histogram + num_bins;
+#else
+  return histogram;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+  RandomAccessIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level)
+{
+  using thrust::system::detail::generic::detail::histogram_even_bin;
+
+  return histogram_detail::count_bins(exec,
+                                      first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_even_bin<LevelType>(lower_level, upper_level, num_levels - 1));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator1 histogram_range(execution_policy<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last)
+{
+  using thrust::system::detail::generic::detail::histogram_range_bin;
+
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(exec,
+                                      first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_range_bin<RandomAccessIterator2>(levels_first, num_levels));
+} // end histogram_range()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,462 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/binary_search.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace multiway_merge_detail
+{
+
+
+// The output is split into slices of equal size, this many per thread. A slice
+// holds at least min_chunk_size elements, so that a small merge is done by the
+// calling thread alone.
+const static int chunks_per_thread = 2;
+const static int min_chunk_size    = 1 << 14;
+
+
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakCompare>
+struct run_partitioner
+{
+  using run_type        = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using iterator        = typename run_type::first_type;
+  using value_type      = typename thrust::iterator_value<iterator>::type;
+  using difference_type = typename thrust::iterator_difference<iterator>::type;
+  using run_pair        = thrust::pair<iterator, iterator>;
+
+  RandomAccessIterator runs_first;
+  Size                 num_runs;
+  difference_type      n;
+  StrictWeakCompare    comp;
+
+  run_partitioner(RandomAccessIterator runs_first, Size num_runs, StrictWeakCompare comp)
+    : runs_first(runs_first), num_runs(num_runs), n(0), comp(comp)
+  {
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      n += size(i);
+    }
+  }
+
+  iterator begin(Size i) const
+  {
+    run_type run = runs_first[i];
+    return run.first;
+  }
+
+  difference_type size(Size i) const
+  {
+    run_type run = runs_first[i];
+    return run.second - run.first;
+  }
+
+  // orders the middle elements of the remaining intervals of two runs
+  struct candidate_less
+  {
+    const run_partitioner *runs;
+    const difference_type *lower;
+    const difference_type *upper;
+    // mutable because StrictWeakCompare::operator() might not be const
+    mutable StrictWeakCompare comp;
+
+    bool operator()(Size a, Size b) const
+    {
+      const value_type x = runs->begin(a)[lower[a] + (upper[a] - lower[a]) / 2];
+      const value_type y = runs->begin(b)[lower[b] + (upper[b] - lower[b]) / 2];
+
+      return a < b ? !comp(y, x) : comp(x, y);
+    }
+  };
+
+  // Writes to split the number of elements of every run which precede the
+  // element of the given rank in the stable merge of the runs. Every run i
+  // keeps an interval [lower[i], upper[i]) which holds its split; each round
+  // takes the weighted median of the middle elements of the intervals as a
+  // pivot, ranks it with a binary search in every interval and discards at
+  // least a quarter of the remaining elements. lower, upper and counts have
+  // room for num_runs entries, and candidates for num_runs indices.
+  void operator()(difference_type rank,
+                  difference_type *split,
+                  difference_type *upper,
+                  difference_type *counts,
+                  Size *candidates) const
+  {
+    difference_type *lower = split;
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      lower[i] = rank < n ? 0 : size(i);
+      upper[i] = rank > 0 ? size(i) : 0;
+    }
+
+    for(;;)
+    {
+      Size            num_candidates = 0;
+      difference_type total_width    = 0;
+
+      for(Size i = 0; i < num_runs; ++i)
+      {
+        if(lower[i] < upper[i])
+        {
+          candidates[num_candidates++] = i;
+          total_width += upper[i] - lower[i];
+        }
+      }
+
+      if(num_candidates == 0)
+        return;
+
+      const candidate_less less = {this, lower, upper, comp};
+
+      thrust::sort(thrust::seq, candidates, candidates + num_candidates, less);
+
+      Size            median = 0;
+      difference_type width  = upper[candidates[0]] - lower[candidates[0]];
+
+      while(2 * width < total_width)
+      {
+        ++median;
+        width += upper[candidates[median]] - lower[candidates[median]];
+      }
+
+      const Size            pivot          = candidates[median];
+      const difference_type pivot_position = lower[pivot] + (upper[pivot] - lower[pivot]) / 2;
+      const value_type      pivot_value    = begin(pivot)[pivot_position];
+
+      // count the elements of every run which precede the pivot, which are
+      // the equivalent elements of the earlier runs and the lesser elements
+      // of the later ones
+      difference_type pivot_rank = 0;
+
+      for(Size i = 0; i < num_runs; ++i)
+      {
+        const iterator first = begin(i);
+
+        if(i == pivot)
+          counts[i] = pivot_position;
+        else if(i < pivot)
+          counts[i] = thrust::upper_bound(thrust::seq, first + lower[i], first + upper[i], pivot_value, comp) - first;
+        else
+          counts[i] = thrust::lower_bound(thrust::seq, first + lower[i], first + upper[i], pivot_value, comp) - first;
+
+        pivot_rank += counts[i];
+      }
+
+      if(pivot_rank < rank)
+      {
+        // the pivot and every element before it precede the split
+        for(Size i = 0; i < num_runs; ++i)
+        {
+          lower[i] = counts[i];
+        }
+
+        lower[pivot] = pivot_position + 1;
+      }
+      else
+      {
+        for(Size i = 0; i < num_runs; ++i)
+        {
+          upper[i] = counts[i];
+        }
+
+        if(pivot_rank == rank)
+        {
+          for(Size i = 0; i < num_runs; ++i)
+          {
+            lower[i] = counts[i];
+          }
+        }
+      }
+    }
+  }
+
+  // writes the non-empty parts [lower[i], upper[i]) of the runs to slice, in
+  // order, and returns their number
+  Size slice(const difference_type *lower, const difference_type *upper, run_pair *slice) const
+  {
+    Size result = 0;
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      if(lower[i] < upper[i])
+      {
+        const iterator first = begin(i);
+
+        slice[result++] = run_pair(first + lower[i], first + upper[i]);
+      }
+    }
+
+    return result;
+  }
+
+  // as above, and writes the beginnings of the corresponding parts of the runs
+  // of values to value_slice
+  template<typename RandomAccessIterator2, typename ValueIterator>
+  Size slice(const difference_type *lower,
+             const difference_type *upper,
+             run_pair *slice,
+             RandomAccessIterator2 value_runs_first,
+             ValueIterator *value_slice) const
+  {
+    Size result = 0;
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      if(lower[i] < upper[i])
+      {
+        const iterator      first       = begin(i);
+        const ValueIterator value_first = value_runs_first[i];
+
+        value_slice[result] = value_first + lower[i];
+        slice[result++]     = run_pair(first + lower[i], first + upper[i]);
+      }
+    }
+
+    return result;
+  }
+};
+
+
+} // end namespace multiway_merge_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakCompare>
+  RandomAccessIterator2 multiway_merge(execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator1 runs_first,
+                                       RandomAccessIterator1 runs_last,
+                                       RandomAccessIterator2 result,
+                                       StrictWeakCompare comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using size_type   = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using partitioner = multiway_merge_detail::run_partitioner<RandomAccessIterator1, size_type, StrictWeakCompare>;
+
+  using difference_type = typename partitioner::difference_type;
+  using run_pair        = typename partitioner::run_pair;
+
+  const size_type num_runs = runs_last - runs_first;
+
+  if(num_runs <= 0)
+    return result;
+
+  const partitioner runs(runs_first, num_runs, comp);
+
+  const difference_type n = runs.n;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(
+    n,
+    multiway_merge_detail::min_chunk_size,
+    static_cast<difference_type>(omp_get_max_threads() * multiway_merge_detail::chunks_per_thread));
+
+  const difference_type num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    return thrust::multiway_merge(thrust::seq, runs_first, runs_last, result, comp);
+  }
+
+  // splits[chunk * num_runs + i] is the number of elements of run i which
+  // precede slice chunk of the output
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> splits_storage(exec, (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> scratch_storage(exec, 2 * (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<size_type, DerivedPolicy>       candidates_storage(exec, (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<run_pair, DerivedPolicy>        slices_storage(exec, num_chunks * num_runs);
+
+  difference_type *splits     = thrust::raw_pointer_cast(splits_storage.data());
+  difference_type *scratch    = thrust::raw_pointer_cast(scratch_storage.data());
+  size_type       *candidates = thrust::raw_pointer_cast(candidates_storage.data());
+  run_pair        *slices     = thrust::raw_pointer_cast(slices_storage.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk <= num_chunks; ++chunk)
+  {
+    runs(chunk < num_chunks ? decomp[chunk].begin() : n,
+         splits + chunk * num_runs,
+         scratch + 2 * chunk * num_runs,
+         scratch + (2 * chunk + 1) * num_runs,
+         candidates + chunk * num_runs);
+  }
+
+  // every thread merges an independent slice of the output
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    run_pair *slice = slices + chunk * num_runs;
+
+    const size_type slice_runs = runs.slice(splits + chunk * num_runs, splits + (chunk + 1) * num_runs, slice);
+
+    thrust::multiway_merge(thrust::seq, slice, slice + slice_runs, result + decomp[chunk].begin(), comp);
+  }
+
+  return result + n;
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end multiway_merge()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakCompare>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    multiway_merge_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 key_runs_first,
+                          RandomAccessIterator1 key_runs_last,
+                          RandomAccessIterator2 value_runs_first,
+                          RandomAccessIterator3 keys_result,
+                          RandomAccessIterator4 values_result,
+                          StrictWeakCompare comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using size_type      = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using partitioner    = multiway_merge_detail::run_partitioner<RandomAccessIterator1, size_type, StrictWeakCompare>;
+  using value_iterator = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  using difference_type = typename partitioner::difference_type;
+  using run_pair        = typename partitioner::run_pair;
+
+  const size_type num_runs = key_runs_last - key_runs_first;
+
+  if(num_runs <= 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  const partitioner runs(key_runs_first, num_runs, comp);
+
+  const difference_type n = runs.n;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(
+    n,
+    multiway_merge_detail::min_chunk_size,
+    static_cast<difference_type>(omp_get_max_threads() * multiway_merge_detail::chunks_per_thread));
+
+  const difference_type num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    return thrust::multiway_merge_by_key(thrust::seq, key_runs_first, key_runs_last, value_runs_first, keys_result, values_result, comp);
+  }
+
+  // splits[chunk * num_runs + i] is the number of elements of run i which
+  // precede slice chunk of the output
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> splits_storage(exec, (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> scratch_storage(exec, 2 * (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<size_type, DerivedPolicy>       candidates_storage(exec, (num_chunks + 1) * num_runs);
+  thrust::detail::temporary_array<run_pair, DerivedPolicy>        slices_storage(exec, num_chunks * num_runs);
+  thrust::detail::temporary_array<value_iterator, DerivedPolicy>  value_slices_storage(exec, num_chunks * num_runs);
+
+  difference_type *splits       = thrust::raw_pointer_cast(splits_storage.data());
+  difference_type *scratch      = thrust::raw_pointer_cast(scratch_storage.data());
+  size_type       *candidates   = thrust::raw_pointer_cast(candidates_storage.data());
+  run_pair        *slices       = thrust::raw_pointer_cast(slices_storage.data());
+  value_iterator  *value_slices = thrust::raw_pointer_cast(value_slices_storage.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk <= num_chunks; ++chunk)
+  {
+    runs(chunk < num_chunks ? decomp[chunk].begin() : n,
+         splits + chunk * num_runs,
+         scratch + 2 * chunk * num_runs,
+         scratch + (2 * chunk + 1) * num_runs,
+         candidates + chunk * num_runs);
+  }
+
+  // every thread merges an independent slice of the output
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    run_pair       *slice       = slices + chunk * num_runs;
+    value_iterator *value_slice = value_slices + chunk * num_runs;
+
+    const size_type slice_runs = runs.slice(
+      splits + chunk * num_runs, splits + (chunk + 1) * num_runs, slice, value_runs_first, value_slice);
+
+    thrust::multiway_merge_by_key(thrust::seq,
+                                  slice,
+                                  slice + slice_runs,
+                                  value_slice,
+                                  keys_result + decomp[chunk].begin(),
+                                  values_result + decomp[chunk].begin(),
+                                  comp);
+  }
+
+  return thrust::make_pair(keys_result + n, values_result + n);
+#else
+  return thrust::make_pair(keys_result, values_result);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end multiway_merge_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
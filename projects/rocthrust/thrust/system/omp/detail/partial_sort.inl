@@ -0,0 +1,171 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partial_sort.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace partial_sort_detail
+{
+
+
+// Up to this many selected elements, every thread keeps the best elements of
+// its part of the input in a heap, and the candidates of all of the threads
+// are merged at the end. Larger selections use the generic sample select.
+const static int heap_select_threshold = 1 << 12;
+
+
+} // end namespace partial_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void nth_element(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  // omp prefers generic::nth_element to cpp::nth_element
+  thrust::system::detail::generic::nth_element(exec, first, nth, last, comp);
+} // end nth_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void partial_sort(execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  // omp prefers generic::partial_sort to cpp::partial_sort
+  thrust::system::detail::generic::partial_sort(exec, first, middle, last, comp);
+} // end partial_sort()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using index_type = typename thrust::iterator_difference<InputIterator>::type;
+
+  const index_type n = thrust::distance(first, last);
+  const index_type r = (thrust::min)(n, static_cast<index_type>(result_last - result_first));
+
+  if(r == n || r > partial_sort_detail::heap_select_threshold)
+  {
+    return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  if(r <= 0)
+    return result_first;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp(n, 1, omp_get_max_threads());
+
+  const index_type num_parts = decomp.size();
+
+  // the best r elements of every part of the input
+  thrust::detail::temporary_array<value_type, DerivedPolicy> candidates(exec, num_parts * r);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> num_candidates(exec, num_parts);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type part = 0; part < num_parts; ++part)
+  {
+    num_candidates[part] = thrust::partial_sort_copy(thrust::seq,
+                                                     first + decomp[part].begin(),
+                                                     first + decomp[part].end(),
+                                                     candidates.begin() + part * r,
+                                                     candidates.begin() + (part + 1) * r,
+                                                     comp)
+                         - (candidates.begin() + part * r);
+  }
+
+  // pack the candidates together and select the best r among them
+  index_type num_packed = num_candidates[0];
+
+  for(index_type part = 1; part < num_parts; ++part)
+  {
+    for(index_type i = 0; i < num_candidates[part]; ++i, ++num_packed)
+    {
+      candidates[num_packed] = candidates[part * r + i];
+    }
+  }
+
+  return thrust::partial_sort_copy(thrust::seq,
+                                   candidates.begin(),
+                                   candidates.begin() + num_packed,
+                                   result_first,
+                                   result_last,
+                                   comp);
+#else
+  return result_first;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end partial_sort_copy()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
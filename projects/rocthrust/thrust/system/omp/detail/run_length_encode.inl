@@ -0,0 +1,322 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace run_length_encode_detail
+{
+
+
+// The input (or, when decoding, the output) is split into chunks of equal
+// size, this many per thread. A chunk holds at least min_chunk_size elements,
+// so that a short input is handled by the calling thread alone.
+const static int chunks_per_thread = 4;
+const static int min_chunk_size    = 1 << 12;
+
+
+template<typename RandomAccessIterator,
+         typename BinaryPredicate>
+struct chunk_encoder
+{
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  RandomAccessIterator first;
+  difference_type      n;
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  chunk_encoder(RandomAccessIterator first, difference_type n, BinaryPredicate binary_pred)
+    : first(first), n(n), binary_pred(binary_pred)
+  {}
+
+  // element i begins a run unless it matches its predecessor
+  bool is_head(difference_type i) const
+  {
+    return i == 0 || !binary_pred(first[i - 1], first[i]);
+  }
+
+  // counts the runs which begin in [begin, end)
+  difference_type count_runs(difference_type begin, difference_type end) const
+  {
+    difference_type result = 0;
+
+    for(difference_type i = begin; i < end; ++i)
+    {
+      if(is_head(i))
+        ++result;
+    }
+
+    return result;
+  }
+
+  // writes the runs which begin in [begin, end), starting at output position offset;
+  // the last of them may extend past end, the run continuing into begin doesn't
+  // belong to this chunk
+  template<typename OutputIterator1, typename OutputIterator2>
+  void encode_runs(difference_type begin,
+                   difference_type end,
+                   difference_type offset,
+                   OutputIterator1 values_output,
+                   OutputIterator2 counts_output) const
+  {
+    using count_type = typename thrust::iterator_value<OutputIterator2>::type;
+
+    difference_type run = begin;
+
+    while(run < end && !is_head(run))
+      ++run;
+
+    while(run < end)
+    {
+      difference_type next = run + 1;
+
+      while(next < n && !is_head(next))
+        ++next;
+
+      values_output[offset] = first[run];
+      counts_output[offset] = static_cast<count_type>(next - run);
+
+      ++offset;
+      run = next;
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator3,
+         typename Position>
+struct chunk_decoder
+{
+  using run_type = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  RandomAccessIterator1 values_first;
+  run_type              num_runs;
+  const Position       *positions;
+  RandomAccessIterator3 result;
+
+  // writes the output elements [begin, end)
+  void operator()(Position begin, Position end) const
+  {
+    using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+    run_type run = thrust::upper_bound(thrust::seq, positions + 1, positions + num_runs + 1, begin) - (positions + 1);
+
+    for(; begin < end; ++run)
+    {
+      const Position run_end = end < positions[run + 1] ? end : positions[run + 1];
+
+      if(begin < run_end)
+      {
+        const value_type value = values_first[run];
+
+        thrust::fill_n(thrust::seq, result + begin, run_end - begin, value);
+
+        begin = run_end;
+      }
+    }
+  }
+};
+
+
+} // end namespace run_length_encode_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    run_length_encode(execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator1 values_output,
+                      OutputIterator2 counts_output,
+                      BinaryPredicate binary_pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const difference_type n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(
+    n,
+    run_length_encode_detail::min_chunk_size,
+    static_cast<difference_type>(omp_get_max_threads() * run_length_encode_detail::chunks_per_thread));
+
+  const difference_type num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    return thrust::run_length_encode(thrust::seq, first, last, values_output, counts_output, binary_pred);
+  }
+
+  const run_length_encode_detail::chunk_encoder<RandomAccessIterator, BinaryPredicate> encoder(first, n, binary_pred);
+
+  // count the runs beginning in each chunk; the head flags are never stored
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> offsets_storage(exec, num_chunks + 1);
+
+  difference_type *offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    offsets[chunk + 1] = encoder.count_runs(decomp[chunk].begin(), decomp[chunk].end());
+  }
+
+  offsets[0] = 0;
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  // every chunk writes its own runs to their final positions
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    encoder.encode_runs(decomp[chunk].begin(), decomp[chunk].end(), offsets[chunk], values_output, counts_output);
+  }
+
+  const difference_type num_runs = offsets[num_chunks];
+
+  return thrust::make_pair(values_output + num_runs, counts_output + num_runs);
+#else
+  return thrust::make_pair(values_output, counts_output);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end run_length_encode()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 run_length_decode(execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 values_first,
+                                          RandomAccessIterator1 values_last,
+                                          RandomAccessIterator2 counts_first,
+                                          RandomAccessIterator3 result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using position_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+  using run_type      = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  const run_type num_runs = values_last - values_first;
+
+  if(num_runs <= 0)
+    return result;
+
+  // positions[i] is the position of run i in the output; the prefix sum which
+  // sizes the output is itself computed in parallel
+  thrust::detail::temporary_array<position_type, DerivedPolicy> positions_storage(exec, num_runs + 1);
+
+  position_type *positions = thrust::raw_pointer_cast(positions_storage.data());
+
+  positions[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(counts_first, thrust::identity<position_type>()),
+                         thrust::make_transform_iterator(counts_first + num_runs, thrust::identity<position_type>()),
+                         positions + 1);
+
+  const position_type n = positions[num_runs];
+
+  // balance the output, rather than the runs, over the threads
+  thrust::system::detail::internal::uniform_decomposition<position_type> decomp(
+    n,
+    run_length_encode_detail::min_chunk_size,
+    static_cast<position_type>(omp_get_max_threads() * run_length_encode_detail::chunks_per_thread));
+
+  const position_type num_chunks = decomp.size();
+
+  const run_length_encode_detail::chunk_decoder<RandomAccessIterator1, RandomAccessIterator3, position_type> decoder =
+    {values_first, num_runs, positions, result};
+
+  if(num_chunks <= 1)
+  {
+    decoder(0, n);
+    return result + n;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(position_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    decoder(decomp[chunk].begin(), decomp[chunk].end());
+  }
+
+  return result + n;
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end run_length_decode()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
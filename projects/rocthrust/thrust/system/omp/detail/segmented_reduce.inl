@@ -0,0 +1,286 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace segmented_reduce_detail
+{
+
+
+// The values and the segment ends are merged into a single sequence which is
+// split into chunks of equal length, this many per thread. A chunk holds at
+// least min_chunk_size items, so that combining the partial results of the
+// segments which cross chunk boundaries stays cheap.
+const static int chunks_per_thread = 4;
+const static int min_chunk_size    = 1 << 12;
+
+
+// The reductions of the pieces of the segments which cross the boundaries of a
+// chunk: head is the piece of a segment begun by an earlier chunk, tail is the
+// piece of a segment ended by a later one.
+template<typename T,
+         typename Size>
+struct chunk_partials
+{
+  Size first_segment;
+  Size last_segment;
+  T    head;
+  T    tail;
+  bool has_head;
+  bool has_tail;
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+struct chunk_reducer
+{
+  using index_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+
+  RandomAccessIterator1 values_first;
+  RandomAccessIterator2 offsets_first;
+  index_type            num_segments;
+  OutputIterator        result;
+  UnaryFunction         unary_op;
+  T                     init;
+  BinaryFunction        binary_op;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp;
+
+  index_type offset(index_type segment) const
+  {
+    return static_cast<index_type>(offsets_first[segment]);
+  }
+
+  // the number of segments which end before the given position of the merged sequence;
+  // the end of segment i is preceded by the i earlier ends and by offsets_first[i + 1] values
+  index_type segments_before(index_type diagonal) const
+  {
+    const index_type num_values = offset(num_segments) - offset(0);
+
+    index_type lo = diagonal > num_values ? diagonal - num_values : 0;
+    index_type hi = diagonal < num_segments ? diagonal : num_segments;
+
+    while(lo < hi)
+    {
+      const index_type mid = lo + (hi - lo) / 2;
+
+      if(offset(mid + 1) - offset(0) + mid < diagonal)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    return lo;
+  }
+
+  // reduces the non-empty range of values [first, last) without init
+  T reduce_values(index_type first, index_type last) const
+  {
+    return thrust::transform_reduce(thrust::seq,
+                                    values_first + first + 1,
+                                    values_first + last,
+                                    unary_op,
+                                    T(unary_op(values_first[first])),
+                                    binary_op);
+  }
+
+  void operator()(index_type chunk, chunk_partials<T, index_type> &partials) const
+  {
+    const index_type first_segment = segments_before(decomp[chunk].begin());
+    const index_type last_segment  = segments_before(decomp[chunk].end());
+
+    const index_type values_begin = offset(0) + decomp[chunk].begin() - first_segment;
+    const index_type values_end   = offset(0) + decomp[chunk].end() - last_segment;
+
+    partials.first_segment = first_segment;
+    partials.last_segment  = last_segment;
+    partials.has_head      = false;
+    partials.has_tail      = false;
+
+    index_type segment = first_segment;
+
+    if(segment < last_segment && offset(segment) < values_begin)
+    {
+      // the first segment ending in this chunk began in an earlier one
+      if(values_begin < offset(segment + 1))
+      {
+        partials.head     = reduce_values(values_begin, offset(segment + 1));
+        partials.has_head = true;
+      }
+
+      ++segment;
+    }
+
+    // the segments lying entirely within this chunk are reduced directly
+    if(segment < last_segment)
+    {
+      thrust::segmented_transform_reduce(thrust::seq,
+                                         values_first,
+                                         offsets_first + segment,
+                                         offsets_first + last_segment + 1,
+                                         result + segment,
+                                         unary_op,
+                                         init,
+                                         binary_op);
+    }
+
+    const index_type tail_begin = first_segment < last_segment ? offset(last_segment) : values_begin;
+
+    if(tail_begin < values_end)
+    {
+      partials.tail     = reduce_values(tail_begin, values_end);
+      partials.has_tail = true;
+    }
+  }
+};
+
+
+} // end namespace segmented_reduce_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_transform_reduce(execution_policy<DerivedPolicy> &exec,
+                                            RandomAccessIterator1 values_first,
+                                            RandomAccessIterator2 offsets_first,
+                                            RandomAccessIterator2 offsets_last,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = typename thrust::iterator_difference<RandomAccessIterator2>::type;
+
+  using reducer_type = segmented_reduce_detail::chunk_reducer<RandomAccessIterator1,
+                                                              RandomAccessIterator2,
+                                                              OutputIterator,
+                                                              UnaryFunction,
+                                                              T,
+                                                              BinaryFunction>;
+
+  const index_type num_segments = (offsets_last - offsets_first) - 1;
+
+  if(num_segments <= 0)
+    return result;
+
+  const index_type num_values = static_cast<index_type>(offsets_first[num_segments]) - static_cast<index_type>(offsets_first[0]);
+
+  // long segments are shared by several chunks and short ones are batched
+  // into one, so every chunk does the same amount of work
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp(
+    num_values + num_segments,
+    segmented_reduce_detail::min_chunk_size,
+    static_cast<index_type>(omp_get_max_threads() * segmented_reduce_detail::chunks_per_thread));
+
+  const index_type num_chunks = decomp.size();
+
+  const reducer_type reducer = {values_first, offsets_first, num_segments, result, unary_op, init, binary_op, decomp};
+
+  using partials_type = segmented_reduce_detail::chunk_partials<T, index_type>;
+
+  thrust::detail::temporary_array<partials_type, DerivedPolicy> partials_storage(exec, num_chunks);
+
+  partials_type *partials = thrust::raw_pointer_cast(partials_storage.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    reducer(chunk, partials[chunk]);
+  }
+
+  // combine the pieces of the segments which cross chunk boundaries, in order
+  bool carrying = false;
+  T    carry    = init;
+
+  for(index_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    const partials_type &p = partials[chunk];
+
+    if(p.first_segment < p.last_segment && carrying)
+    {
+      result[p.first_segment] = p.has_head ? binary_op(carry, p.head) : carry;
+      carrying                = false;
+    }
+
+    if(p.has_tail)
+    {
+      carry    = binary_op(carrying ? carry : init, p.tail);
+      carrying = true;
+    }
+  }
+
+  return result + num_segments;
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end segmented_transform_reduce()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
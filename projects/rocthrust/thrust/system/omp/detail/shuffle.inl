@@ -0,0 +1,302 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+#include <random>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+
+// Inputs of at least this many elements are shuffled in place with a merge
+// shuffle; smaller inputs are copied and compacted through a bijection.
+const static int merge_shuffle_threshold = 1 << 20;
+
+// Every leaf of the merge shuffle is Fisher-Yates shuffled by one thread.
+// The leaves do not depend on the number of threads, so a given generator
+// state always produces the same permutation.
+const static int merge_shuffle_block_size = 1 << 16;
+
+
+// Derive an independent seed for every task of the merge shuffle (splitmix64)
+inline std::uint64_t task_seed(std::uint64_t seed, std::uint64_t level, std::uint64_t task)
+{
+  std::uint64_t z = seed + (level << 48) + task * UINT64_C(0x9E3779B97F4A7C15);
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+
+template<typename RandomIterator, typename IndexType>
+void swap_elements(RandomIterator first, IndexType a, IndexType b)
+{
+  using InputType = typename thrust::iterator_value<RandomIterator>::type;
+
+  InputType tmp = first[a];
+  first[a]      = first[b];
+  first[b]      = tmp;
+}
+
+
+template<typename RandomIterator, typename IndexType, typename Engine>
+void fisher_yates(RandomIterator first, IndexType n, Engine &engine)
+{
+  for(IndexType i = n - 1; i > 0; --i)
+  {
+    std::uniform_int_distribution<IndexType> dist(0, i);
+    shuffle_detail::swap_elements(first, i, dist(engine));
+  }
+}
+
+
+// Merge the uniformly shuffled ranges [s, m) and [m, e) into a uniformly
+// shuffled range [s, e): coin flips pick the range each position is taken
+// from until one of them runs out, and the rest is inserted Fisher-Yates style.
+template<typename RandomIterator, typename IndexType, typename Engine>
+void merge_shuffled(RandomIterator first, IndexType s, IndexType m, IndexType e, Engine &engine)
+{
+  std::uint64_t bits     = 0;
+  int           num_bits = 0;
+
+  IndexType u = s;
+  IndexType v = m;
+
+  while(true)
+  {
+    if(num_bits == 0)
+    {
+      bits     = engine();
+      num_bits = 64;
+    }
+
+    const bool flip = bits & 1;
+    bits >>= 1;
+    --num_bits;
+
+    if(flip)
+    {
+      if(v == e)
+        break;
+
+      shuffle_detail::swap_elements(first, u, v);
+      ++v;
+    }
+    else if(u == v)
+    {
+      break;
+    }
+
+    ++u;
+  }
+
+  for(; u < e; ++u)
+  {
+    std::uniform_int_distribution<IndexType> dist(0, u - s);
+    shuffle_detail::swap_elements(first, s + dist(engine), u);
+  }
+}
+
+
+} // end namespace shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                  RandomIterator first,
+                  RandomIterator last,
+                  OutputIterator result,
+                  URBG &&g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  using index_type = std::int64_t;
+
+  // m is the length of the input
+  // we have an available bijection of length n via a feistel cipher
+  const std::uint64_t m = last - first;
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+  const index_type n = bijection.nearest_power_of_two();
+
+  // every thread compacts the keys of its own interval of [0,n); the output
+  // position of a key is the number of keys < m before it, exactly as in the
+  // generic scan based compaction
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const index_type num_intervals = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_intervals + 1);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type i = 0; i < num_intervals; ++i)
+  {
+    const thrust::system::detail::generic::feistel_bijection local_bijection = bijection;
+
+    const index_type begin = decomp[i].begin();
+    const index_type end   = decomp[i].end();
+
+    index_type count = 0;
+
+    for(index_type idx = begin; idx < end; ++idx)
+    {
+      count += local_bijection(idx) < m;
+    }
+
+    offsets[i + 1] = count;
+  }
+
+  offsets[0] = 0;
+  for(index_type i = 0; i < num_intervals; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type i = 0; i < num_intervals; ++i)
+  {
+    const thrust::system::detail::generic::feistel_bijection local_bijection = bijection;
+
+    const index_type begin = decomp[i].begin();
+    const index_type end   = decomp[i].end();
+
+    OutputIterator out = result + offsets[i];
+
+    for(index_type idx = begin; idx < end; ++idx)
+    {
+      const std::uint64_t key = local_bijection(idx);
+
+      if(key < m)
+      {
+        *out = first[key];
+        ++out;
+      }
+    }
+  }
+} // end shuffle_copy()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+void shuffle(execution_policy<DerivedPolicy> &exec,
+             RandomIterator first,
+             RandomIterator last,
+             URBG &&g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  using InputType  = typename thrust::iterator_value<RandomIterator>::type;
+  using index_type = std::int64_t;
+
+  const index_type n = last - first;
+
+  if(n < shuffle_detail::merge_shuffle_threshold)
+  {
+    // copy input to temp buffer
+    thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+    omp::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+    return;
+  }
+
+  const std::uint64_t seed = (static_cast<std::uint64_t>(g()) << 32) ^ static_cast<std::uint64_t>(g());
+
+  const index_type block_size = shuffle_detail::merge_shuffle_block_size;
+  const index_type num_blocks = (n + block_size - 1) / block_size;
+
+  // shuffle every leaf
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type i = 0; i < num_blocks; ++i)
+  {
+    std::mt19937_64 engine(shuffle_detail::task_seed(seed, 0, i));
+
+    const index_type begin = i * block_size;
+    const index_type end   = (begin + block_size < n) ? begin + block_size : n;
+
+    shuffle_detail::fisher_yates(first + begin, end - begin, engine);
+  }
+
+  // merge pairs of shuffled ranges until a single one is left
+  std::uint64_t level = 1;
+
+  for(index_type width = block_size; width < n; width *= 2, ++level)
+  {
+    const index_type num_merges = (n + 2 * width - 1) / (2 * width);
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(index_type i = 0; i < num_merges; ++i)
+    {
+      const index_type s = 2 * width * i;
+      const index_type m = (s + width < n) ? s + width : n;
+      const index_type e = (m + width < n) ? m + width : n;
+
+      if(m < e)
+      {
+        std::mt19937_64 engine(shuffle_detail::task_seed(seed, level, i));
+
+        shuffle_detail::merge_shuffled(first, s, m, e, engine);
+      }
+    }
+  }
+} // end shuffle()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -27,7 +27,9 @@
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/sort.h>
-#include <thrust/merge.h>
+#include <thrust/copy.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 
@@ -42,52 +44,17 @@ namespace sort_detail
 {
 
 
-template<typename DerivedPolicy,
-         typename RandomAccessIterator,
-         typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy> &exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
-{
-  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
-
-  thrust::detail::temporary_array<value_type,DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type,DerivedPolicy> b(exec, middle, last);
-
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
-}
-
-
-template<typename DerivedPolicy,
-         typename RandomAccessIterator1,
-         typename RandomAccessIterator2,
-         typename StrictWeakOrdering>
-void inplace_merge_by_key(execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 middle1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+// Writes the tiles of decomp, of the range beginning at first, to runs.
+template<typename RandomAccessIterator,
+         typename IndexType>
+void tiles(RandomAccessIterator first,
+           const thrust::system::detail::internal::uniform_decomposition<IndexType> &decomp,
+           thrust::pair<RandomAccessIterator, RandomAccessIterator> *runs)
 {
-  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
-  using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
-
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> rhs2(exec, middle2, last2);
-
-  thrust::merge_by_key(thrust::seq,
-                       lhs1.begin(), lhs1.end(),
-                       rhs1.begin(), rhs1.end(),
-                       lhs2.begin(), rhs2.begin(),
-                       first1, first2,
-                       comp);
+  for(IndexType i = 0; i < decomp.size(); ++i)
+  {
+    runs[i] = thrust::make_pair(first + decomp[i].begin(), first + decomp[i].end());
+  }
 }
 
 
@@ -117,60 +84,37 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using RunType   = thrust::pair<RandomAccessIterator, RandomAccessIterator>;
 
   if(first == last)
     return;
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if(p_i < decomp.size())
-    {
-      thrust::stable_sort(thrust::seq,
-                          first + decomp[p_i].begin(),
-                          first + decomp[p_i].end(),
-                          comp);
-    }
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_max_threads());
 
-    THRUST_PRAGMA_OMP(barrier)
-
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < decomp.size(); ++i)
+  {
+    thrust::stable_sort(thrust::seq,
+                        first + decomp[i].begin(),
+                        first + decomp[i].end(),
+                        comp);
+  }
 
-    while(nseg>1)
-    {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
+  if(decomp.size() <= 1)
+    return;
 
-      if((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(exec,
-                                   first + decomp[a].begin(),
-                                   first + decomp[b].end(),
-                                   first + decomp[c].end(),
-                                   comp);
+  // the sorted tiles are merged at once, with every thread merging a slice of
+  // the output, rather than in rounds of pairwise merges
+  thrust::detail::temporary_array<RunType, DerivedPolicy>   runs(exec, decomp.size());
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> merged(exec, last - first);
 
-        b = c;
-        c += h;
-      }
+  sort_detail::tiles(first, decomp, thrust::raw_pointer_cast(runs.data()));
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  thrust::multiway_merge(exec, runs.begin(), runs.end(), merged.begin(), comp);
 
-      THRUST_PRAGMA_OMP(barrier)
-    }
-  }
+  thrust::copy(exec, merged.begin(), merged.end(), first);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -199,63 +143,49 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using IndexType  = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using KeyType    = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using ValueType  = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using RunType    = thrust::pair<RandomAccessIterator1, RandomAccessIterator1>;
 
   if(keys_first == keys_last)
     return;
 
-  THRUST_PRAGMA_OMP(parallel)
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_max_threads());
+
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < decomp.size(); ++i)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if(p_i < decomp.size())
-    {
-      thrust::stable_sort_by_key(thrust::seq,
-                                 keys_first + decomp[p_i].begin(),
-                                 keys_first + decomp[p_i].end(),
-                                 values_first + decomp[p_i].begin(),
-                                 comp);
-    }
-
-    THRUST_PRAGMA_OMP(barrier)
-
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
-
-    while(nseg>1)
-    {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(exec,
-                                          keys_first + decomp[a].begin(),
-                                          keys_first + decomp[b].end(),
-                                          keys_first + decomp[c].end(),
-                                          values_first + decomp[a].begin(),
-                                          comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
-
-      THRUST_PRAGMA_OMP(barrier)
-    }
+    thrust::stable_sort_by_key(thrust::seq,
+                               keys_first + decomp[i].begin(),
+                               keys_first + decomp[i].end(),
+                               values_first + decomp[i].begin(),
+                               comp);
   }
+
+  if(decomp.size() <= 1)
+    return;
+
+  // the sorted tiles are merged at once, with every thread merging a slice of
+  // the output, rather than in rounds of pairwise merges
+  thrust::detail::temporary_array<RunType, DerivedPolicy>               runs(exec, decomp.size());
+  thrust::detail::temporary_array<RandomAccessIterator2, DerivedPolicy> value_runs(exec, decomp.size());
+  thrust::detail::temporary_array<KeyType, DerivedPolicy>               merged_keys(exec, keys_last - keys_first);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy>             merged_values(exec, keys_last - keys_first);
+
+  sort_detail::tiles(keys_first, decomp, thrust::raw_pointer_cast(runs.data()));
+
+  for(IndexType i = 0; i < decomp.size(); ++i)
+  {
+    value_runs[i] = values_first + decomp[i].begin();
+  }
+
+  thrust::multiway_merge_by_key(
+    exec, runs.begin(), runs.end(), value_runs.begin(), merged_keys.begin(), merged_values.begin(), comp);
+
+  thrust::copy(exec, merged_keys.begin(), merged_keys.end(), keys_first);
+  thrust::copy(exec, merged_values.begin(), merged_values.end(), values_first);
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -32,6 +33,7 @@
 
 #include <thrust/system/omp/detail/adjacent_difference.h>
 #include <thrust/system/omp/detail/assign_value.h>
+#include <thrust/system/omp/detail/batch_copy.h>
 #include <thrust/system/omp/detail/binary_search.h>
 #include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/copy_if.h>
@@ -44,24 +46,34 @@
 #include <thrust/system/omp/detail/gather.h>
 #include <thrust/system/omp/detail/generate.h>
 #include <thrust/system/omp/detail/get_value.h>
+#include <thrust/system/omp/detail/hash_reduce_by_key.h>
+#include <thrust/system/omp/detail/histogram.h>
 #include <thrust/system/omp/detail/inner_product.h>
 #include <thrust/system/omp/detail/iter_swap.h>
 #include <thrust/system/omp/detail/logical.h>
 #include <thrust/system/omp/detail/malloc_and_free.h>
 #include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/merge_join.h>
 #include <thrust/system/omp/detail/mismatch.h>
+#include <thrust/system/omp/detail/multiway_merge.h>
+#include <thrust/system/omp/detail/partial_sort.h>
 #include <thrust/system/omp/detail/partition.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/omp/detail/replace.h>
 #include <thrust/system/omp/detail/reverse.h>
+#include <thrust/system/omp/detail/run_length_encode.h>
 #include <thrust/system/omp/detail/scan.h>
 #include <thrust/system/omp/detail/scan_by_key.h>
 #include <thrust/system/omp/detail/scatter.h>
+#include <thrust/system/omp/detail/segmented_reduce.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
 #include <thrust/system/omp/detail/sequence.h>
 #include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/omp/detail/shuffle.h>
 #include <thrust/system/omp/detail/sort.h>
+#include <thrust/system/omp/detail/sort_strings.h>
 #include <thrust/system/omp/detail/swap_ranges.h>
 #include <thrust/system/omp/detail/tabulate.h>
 #include <thrust/system/omp/detail/transform.h>
@@ -139,6 +151,12 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  \p thrust::omp::par.with_cached_temporaries() is a policy which obtains the temporary storage of
+ *  algorithms from a \p thrust::mr::caching_resource shared by all uses of the policy, so that
+ *  calling an algorithm repeatedly with the same sizes, as in the iterations of a solver, allocates
+ *  memory only the first time. The cache is returned by \p thrust::omp::par.temporary_cache(),
+ *  through which it can be bounded with \p set_max_cached_bytes or emptied with \p trim.
  */
 static const unspecified par;
 
@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file extrema.h
+ *  \brief stdpar implementations of min_element, max_element and minmax_element.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/stdpar/detail/execution_policy.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+namespace dispatch
+{
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_comp(comp);
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  auto raw_result = std::max_element(stdpar::detail::unsequenced_policy(),
+                                     raw_first,
+                                     thrust::try_unwrap_contiguous_iterator(last),
+                                     wrapped_comp);
+
+  return first + (raw_result - raw_first);
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_comp(comp);
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  auto raw_result = std::min_element(stdpar::detail::unsequenced_policy(),
+                                     raw_first,
+                                     thrust::try_unwrap_contiguous_iterator(last),
+                                     wrapped_comp);
+
+  return first + (raw_result - raw_first);
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first,
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp,
+                                                             thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+} // end minmax_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &,
+                                                             ForwardIterator first,
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp,
+                                                             thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_comp(comp);
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  auto raw_result = std::minmax_element(stdpar::detail::unsequenced_policy(),
+                                        raw_first,
+                                        thrust::try_unwrap_contiguous_iterator(last),
+                                        wrapped_comp);
+
+  return thrust::make_pair(first + (raw_result.first  - raw_first),
+                           first + (raw_result.second - raw_first));
+} // end minmax_element()
+
+
+} // end dispatch
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return stdpar::detail::dispatch::max_element(exec, first, last, comp,
+    typename use_std_algorithm<ForwardIterator>::type());
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return stdpar::detail::dispatch::min_element(exec, first, last, comp,
+    typename use_std_algorithm<ForwardIterator>::type());
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first,
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp)
+{
+  return stdpar::detail::dispatch::minmax_element(exec, first, last, comp,
+    typename use_std_algorithm<ForwardIterator>::type());
+} // end minmax_element()
+
+
+} // end detail
+} // end stdpar
+} // end system
+THRUST_NAMESPACE_END
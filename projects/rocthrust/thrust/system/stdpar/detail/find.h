@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file find.h
+ *  \brief stdpar implementation of find_if.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/generic/find.h>
+#include <thrust/system/stdpar/detail/execution_policy.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+namespace dispatch
+{
+
+
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred,
+                      thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+}
+
+
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred,
+                      thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  auto raw_result = std::find_if(stdpar::detail::unsequenced_policy(),
+                                 raw_first,
+                                 thrust::try_unwrap_contiguous_iterator(last),
+                                 wrapped_pred);
+
+  return first + (raw_result - raw_first);
+}
+
+
+} // end dispatch
+
+
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred)
+{
+  return stdpar::detail::dispatch::find_if(exec, first, last, pred,
+    typename use_std_algorithm<InputIterator>::type());
+}
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
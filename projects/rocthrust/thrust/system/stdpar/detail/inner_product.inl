@@ -0,0 +1,64 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/stdpar/detail/inner_product.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputType,
+         typename BinaryFunction1,
+         typename BinaryFunction2>
+  OutputType inner_product(execution_policy<DerivedPolicy> &,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputType init,
+                           BinaryFunction1 binary_op1,
+                           BinaryFunction2 binary_op2)
+{
+  thrust::detail::wrapped_function<BinaryFunction1,OutputType> wrapped_binary_op1(binary_op1);
+  thrust::detail::wrapped_function<BinaryFunction2,OutputType> wrapped_binary_op2(binary_op2);
+
+  return std::transform_reduce(stdpar::detail::unsequenced_policy(),
+                               thrust::try_unwrap_contiguous_iterator(first1),
+                               thrust::try_unwrap_contiguous_iterator(last1),
+                               thrust::try_unwrap_contiguous_iterator(first2),
+                               init,
+                               wrapped_binary_op1,
+                               wrapped_binary_op2);
+} // end inner_product()
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
+
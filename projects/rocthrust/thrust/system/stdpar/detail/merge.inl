@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/stdpar/detail/merge.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator merge(execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 first1,
+                       InputIterator1 last1,
+                       InputIterator2 first2,
+                       InputIterator2 last2,
+                       OutputIterator result,
+                       StrictWeakOrdering comp,
+                       thrust::detail::false_type)
+{
+  return thrust::system::detail::sequential::merge(exec, first1, last1, first2, last2, result, comp);
+} // end merge()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator merge(execution_policy<DerivedPolicy> &,
+                       InputIterator1 first1,
+                       InputIterator1 last1,
+                       InputIterator2 first2,
+                       InputIterator2 last2,
+                       OutputIterator result,
+                       StrictWeakOrdering comp,
+                       thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  auto raw_result = thrust::try_unwrap_contiguous_iterator(result);
+
+  auto raw_end = std::merge(stdpar::detail::parallel_policy(),
+                            thrust::try_unwrap_contiguous_iterator(first1),
+                            thrust::try_unwrap_contiguous_iterator(last1),
+                            thrust::try_unwrap_contiguous_iterator(first2),
+                            thrust::try_unwrap_contiguous_iterator(last2),
+                            raw_result,
+                            wrapped_comp);
+
+  return result + (raw_end - raw_result);
+} // end merge()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator merge(execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 first1,
+                       InputIterator1 last1,
+                       InputIterator2 first2,
+                       InputIterator2 last2,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  return stdpar::detail::dispatch::merge(exec, first1, last1, first2, last2, result, comp,
+    typename use_std_algorithm<InputIterator1, InputIterator2, OutputIterator>::type());
+} // end merge()
+
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/scan.h>
+#include <thrust/system/stdpar/detail/scan.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op,
+                                thrust::detail::false_type)
+{
+  return thrust::system::detail::sequential::inclusive_scan(exec, first, last, result, binary_op);
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op,
+                                thrust::detail::true_type)
+{
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  const auto n = thrust::distance(first, last);
+
+  std::inclusive_scan(stdpar::detail::unsequenced_policy(),
+                      thrust::try_unwrap_contiguous_iterator(first),
+                      thrust::try_unwrap_contiguous_iterator(last),
+                      thrust::try_unwrap_contiguous_iterator(result),
+                      wrapped_binary_op);
+
+  return result + n;
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op,
+                                thrust::detail::false_type)
+{
+  return thrust::system::detail::sequential::exclusive_scan(exec, first, last, result, init, binary_op);
+} // end exclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op,
+                                thrust::detail::true_type)
+{
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  thrust::detail::wrapped_function<BinaryFunction,InitialValueType> wrapped_binary_op(binary_op);
+
+  const auto n = thrust::distance(first, last);
+
+  auto raw_first  = thrust::try_unwrap_contiguous_iterator(first);
+  auto raw_last   = thrust::try_unwrap_contiguous_iterator(last);
+  auto raw_result = thrust::try_unwrap_contiguous_iterator(result);
+
+  if (stdpar::detail::ranges_overlap(raw_first, raw_last, raw_result))
+  {
+    // the parallel exclusive scan of libstdc++ reads elements it has already
+    // overwritten when it scans in place, so the input is scanned from a copy
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> input(exec, first, n);
+
+    std::exclusive_scan(stdpar::detail::unsequenced_policy(),
+                        thrust::raw_pointer_cast(input.data()),
+                        thrust::raw_pointer_cast(input.data()) + n,
+                        raw_result,
+                        init,
+                        wrapped_binary_op);
+  }
+  else
+  {
+    std::exclusive_scan(stdpar::detail::unsequenced_policy(),
+                        raw_first,
+                        raw_last,
+                        raw_result,
+                        init,
+                        wrapped_binary_op);
+  }
+
+  return result + n;
+} // end exclusive_scan()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  return stdpar::detail::dispatch::inclusive_scan(exec, first, last, result, binary_op,
+    typename use_std_algorithm<InputIterator, OutputIterator>::type());
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  return stdpar::detail::dispatch::exclusive_scan(exec, first, last, result, init, binary_op,
+    typename use_std_algorithm<InputIterator, OutputIterator>::type());
+} // end exclusive_scan()
+
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,237 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sequence.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/stdpar/detail/sort.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+
+namespace sort_detail
+{
+
+
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+struct indirect_compare
+{
+  RandomAccessIterator keys;
+  StrictWeakOrdering   comp;
+
+  indirect_compare(RandomAccessIterator keys, StrictWeakOrdering comp)
+    : keys(keys), comp(comp)
+  {}
+
+  bool operator()(std::size_t lhs, std::size_t rhs) const
+  {
+    return comp(keys[lhs], keys[rhs]);
+  }
+};
+
+
+template<typename SourceIterator>
+struct gather_functor
+{
+  SourceIterator source;
+
+  gather_functor(SourceIterator source)
+    : source(source)
+  {}
+
+  typename thrust::iterator_value<SourceIterator>::type
+  operator()(std::size_t i) const
+  {
+    return source[i];
+  }
+};
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename Permutation>
+void permute(execution_policy<DerivedPolicy> &exec,
+             RandomAccessIterator first,
+             std::size_t n,
+             const Permutation &permutation)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  // copy the input aside, then gather it back through the permutation
+  thrust::detail::temporary_array<value_type, DerivedPolicy> tmp(exec, first, n);
+
+  const std::size_t *raw_permutation = thrust::raw_pointer_cast(permutation.data());
+
+  std::transform(stdpar::detail::unsequenced_policy(),
+                 raw_permutation,
+                 raw_permutation + n,
+                 thrust::try_unwrap_contiguous_iterator(first),
+                 gather_functor<value_type *>(thrust::raw_pointer_cast(tmp.data())));
+}
+
+
+} // end namespace sort_detail
+
+
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void sort(execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            StrictWeakOrdering comp,
+            thrust::detail::false_type)
+{
+  thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+} // end sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void sort(execution_policy<DerivedPolicy> &,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            StrictWeakOrdering comp,
+            thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  std::sort(stdpar::detail::unsequenced_policy(),
+            thrust::try_unwrap_contiguous_iterator(first),
+            thrust::try_unwrap_contiguous_iterator(last),
+            wrapped_comp);
+} // end sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void stable_sort(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp,
+                   thrust::detail::false_type)
+{
+  thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+} // end stable_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void stable_sort(execution_policy<DerivedPolicy> &,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp,
+                   thrust::detail::true_type)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  std::stable_sort(stdpar::detail::parallel_policy(),
+                   thrust::try_unwrap_contiguous_iterator(first),
+                   thrust::try_unwrap_contiguous_iterator(last),
+                   wrapped_comp);
+} // end stable_sort()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void sort(execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            StrictWeakOrdering comp)
+{
+  stdpar::detail::dispatch::sort(exec, first, last, comp,
+    typename use_std_algorithm<RandomAccessIterator>::type());
+} // end sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void stable_sort(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  stdpar::detail::dispatch::stable_sort(exec, first, last, comp,
+    typename use_std_algorithm<RandomAccessIterator>::type());
+} // end stable_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_first,
+                          RandomAccessIterator1 keys_last,
+                          RandomAccessIterator2 values_first,
+                          StrictWeakOrdering comp)
+{
+  const std::size_t n = static_cast<std::size_t>(thrust::distance(keys_first, keys_last));
+
+  if(n < 2) return;
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> permutation(exec, n);
+  thrust::sequence(exec, permutation.begin(), permutation.end());
+
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  auto raw_keys = thrust::try_unwrap_contiguous_iterator(keys_first);
+
+  sort_detail::indirect_compare<decltype(raw_keys), decltype(wrapped_comp)> indirect_comp(raw_keys, wrapped_comp);
+
+  std::size_t *raw_permutation = thrust::raw_pointer_cast(permutation.data());
+
+  std::stable_sort(stdpar::detail::parallel_policy(),
+                   raw_permutation,
+                   raw_permutation + n,
+                   indirect_comp);
+
+  sort_detail::permute(exec, keys_first,   n, permutation);
+  sort_detail::permute(exec, values_first, n, permutation);
+} // end stable_sort_by_key()
+
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,139 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/system/stdpar/detail/std_execution.h
+ *  \brief Selects the standard library execution policies used by the stdpar system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/logical_metafunctions.h>
+#include <thrust/type_traits/remove_cvref.h>
+
+#if THRUST_CPP_DIALECT >= 2017
+#  if defined(__has_include)
+#    if __has_include(<execution>)
+#      include <execution>
+#    endif
+#  endif
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+
+#if defined(__cpp_lib_parallel_algorithm) && (__cpp_lib_parallel_algorithm >= 201603L)
+#  define THRUST_STDPAR_HAS_PARALLEL_ALGORITHMS THRUST_TRUE
+#else
+#  define THRUST_STDPAR_HAS_PARALLEL_ALGORITHMS THRUST_FALSE
+#endif
+
+// ========================================================================
+// X Note to the user: If you've found this line due to a compiler error, X
+// X you need a C++17 standard library which provides <execution>, e.g.   X
+// X libstdc++ (with TBB), libc++ with PSTL enabled, or MSVC.             X
+// ========================================================================
+#if THRUST_STDPAR_HAS_PARALLEL_ALGORITHMS == THRUST_FALSE
+#  error The stdpar system requires C++17 parallel algorithms (<execution>).
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+
+// Thrust only requires that user functors may be invoked concurrently,
+// which is what par_unseq asks for; algorithms which need element
+// accesses to be sequenced within a thread use par instead.
+inline const std::execution::parallel_unsequenced_policy& unsequenced_policy()
+{
+  return std::execution::par_unseq;
+}
+
+inline const std::execution::parallel_policy& parallel_policy()
+{
+  return std::execution::par;
+}
+
+// The standard algorithms may copy an element through auto and combine it
+// in place, which silently writes through proxy references such as the
+// ones returned by zip_iterator. Only iterators which (once unwrapped)
+// dereference to a true reference or to a plain value are forwarded to the
+// standard library; the others take the sequential path.
+template<typename Iterator>
+struct has_std_reference
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::detail::is_reference<typename thrust::iterator_reference<Iterator>::type>::value ||
+      thrust::detail::is_same<thrust::remove_cvref_t<typename thrust::iterator_reference<Iterator>::type>,
+                              typename thrust::iterator_value<Iterator>::type>::value
+    >
+{};
+
+template<typename... Iterators>
+struct use_std_algorithm
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::conjunction<has_std_reference<thrust::try_unwrap_contiguous_iterator_t<Iterators>>...>::value
+    >
+{};
+
+// Whether an output range starting at result overlaps the input range
+// [first, last). Contiguous ranges are compared by address; other iterators
+// only alias when they are the same iterator.
+template<typename Iterator>
+bool same_position(Iterator a, Iterator b)
+{
+  return a == b;
+}
+
+template<typename Iterator1, typename Iterator2>
+bool same_position(Iterator1, Iterator2)
+{
+  return false;
+}
+
+template<typename T, typename U>
+bool ranges_overlap(T* first, T* last, U* result)
+{
+  const char* begin = reinterpret_cast<const char*>(first);
+  const char* end   = reinterpret_cast<const char*>(last);
+  const char* out   = reinterpret_cast<const char*>(result);
+
+  const std::size_t out_bytes = static_cast<std::size_t>(last - first) * sizeof(U);
+
+  std::less<const char*> less;
+  return first != last && less(out, end) && less(begin, out + out_bytes);
+}
+
+template<typename Iterator1, typename Iterator2>
+bool ranges_overlap(Iterator1 first, Iterator1 last, Iterator2 result)
+{
+  return first != last && same_position(first, result);
+}
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,215 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/transform_scan.h>
+#include <thrust/system/stdpar/detail/transform_scan.h>
+#include <thrust/system/stdpar/detail/std_execution.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/remove_cvref.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+namespace detail
+{
+
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename AssociativeOperator>
+  OutputIterator transform_inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          AssociativeOperator binary_op,
+                                          thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::transform_inclusive_scan(exec, first, last, result, unary_op, binary_op);
+} // end transform_inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename AssociativeOperator>
+  OutputIterator transform_exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          T init,
+                                          AssociativeOperator binary_op,
+                                          thrust::detail::false_type)
+{
+  return thrust::system::detail::generic::transform_exclusive_scan(exec, first, last, result, unary_op, init, binary_op);
+} // end transform_exclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename AssociativeOperator>
+  OutputIterator transform_inclusive_scan(execution_policy<DerivedPolicy> &,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          AssociativeOperator binary_op,
+                                          thrust::detail::true_type)
+{
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using InputType = typename thrust::iterator_value<InputIterator>::type;
+  using ResultType = thrust::detail::invoke_result_t<UnaryFunction, InputType>;
+  using ValueType = thrust::remove_cvref_t<ResultType>;
+
+  thrust::detail::wrapped_function<UnaryFunction,ValueType>       wrapped_unary_op(unary_op);
+  thrust::detail::wrapped_function<AssociativeOperator,ValueType> wrapped_binary_op(binary_op);
+
+  const auto n = thrust::distance(first, last);
+
+  // note that std::transform_inclusive_scan takes the scan operator before the transformation
+  std::transform_inclusive_scan(stdpar::detail::unsequenced_policy(),
+                                thrust::try_unwrap_contiguous_iterator(first),
+                                thrust::try_unwrap_contiguous_iterator(last),
+                                thrust::try_unwrap_contiguous_iterator(result),
+                                wrapped_binary_op,
+                                wrapped_unary_op);
+
+  return result + n;
+} // end transform_inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename AssociativeOperator>
+  OutputIterator transform_exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          T init,
+                                          AssociativeOperator binary_op,
+                                          thrust::detail::true_type)
+{
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = thrust::remove_cvref_t<T>;
+
+  thrust::detail::wrapped_function<UnaryFunction,ValueType>       wrapped_unary_op(unary_op);
+  thrust::detail::wrapped_function<AssociativeOperator,ValueType> wrapped_binary_op(binary_op);
+
+  using InputType = typename thrust::iterator_value<InputIterator>::type;
+
+  const auto n = thrust::distance(first, last);
+
+  auto raw_first  = thrust::try_unwrap_contiguous_iterator(first);
+  auto raw_last   = thrust::try_unwrap_contiguous_iterator(last);
+  auto raw_result = thrust::try_unwrap_contiguous_iterator(result);
+
+  if (stdpar::detail::ranges_overlap(raw_first, raw_last, raw_result))
+  {
+    // as in exclusive_scan, the input of an in-place scan is scanned from a copy
+    thrust::detail::temporary_array<InputType, DerivedPolicy> input(exec, first, n);
+
+    std::transform_exclusive_scan(stdpar::detail::unsequenced_policy(),
+                                  thrust::raw_pointer_cast(input.data()),
+                                  thrust::raw_pointer_cast(input.data()) + n,
+                                  raw_result,
+                                  ValueType(init),
+                                  wrapped_binary_op,
+                                  wrapped_unary_op);
+  }
+  else
+  {
+    std::transform_exclusive_scan(stdpar::detail::unsequenced_policy(),
+                                  raw_first,
+                                  raw_last,
+                                  raw_result,
+                                  ValueType(init),
+                                  wrapped_binary_op,
+                                  wrapped_unary_op);
+  }
+
+  return result + n;
+} // end transform_exclusive_scan()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename AssociativeOperator>
+  OutputIterator transform_inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          AssociativeOperator binary_op)
+{
+  return stdpar::detail::dispatch::transform_inclusive_scan(exec, first, last, result, unary_op, binary_op,
+    typename use_std_algorithm<InputIterator, OutputIterator>::type());
+} // end transform_inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename AssociativeOperator>
+  OutputIterator transform_exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          OutputIterator result,
+                                          UnaryFunction unary_op,
+                                          T init,
+                                          AssociativeOperator binary_op)
+{
+  return stdpar::detail::dispatch::transform_exclusive_scan(exec, first, last, result, unary_op, init, binary_op,
+    typename use_std_algorithm<InputIterator, OutputIterator>::type());
+} // end transform_exclusive_scan()
+
+
+} // end namespace detail
+} // end namespace stdpar
+} // end namespace system
+THRUST_NAMESPACE_END
+
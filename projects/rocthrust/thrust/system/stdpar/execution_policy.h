@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+/*! \file thrust/system/stdpar/execution_policy.h
+ *  \brief Execution policies for Thrust's stdpar system.
+ */
+
+#include <thrust/detail/config.h>
+
+// get the execution policies definitions first
+#include <thrust/system/stdpar/detail/execution_policy.h>
+
+// get the definition of par
+#include <thrust/system/stdpar/detail/par.h>
+
+// now get all the algorithm definitions
+
+#include <thrust/system/stdpar/detail/adjacent_difference.h>
+#include <thrust/system/stdpar/detail/assign_value.h>
+#include <thrust/system/stdpar/detail/batch_copy.h>
+#include <thrust/system/stdpar/detail/binary_search.h>
+#include <thrust/system/stdpar/detail/copy.h>
+#include <thrust/system/stdpar/detail/copy_if.h>
+#include <thrust/system/stdpar/detail/count.h>
+#include <thrust/system/stdpar/detail/equal.h>
+#include <thrust/system/stdpar/detail/extrema.h>
+#include <thrust/system/stdpar/detail/fill.h>
+#include <thrust/system/stdpar/detail/find.h>
+#include <thrust/system/stdpar/detail/for_each.h>
+#include <thrust/system/stdpar/detail/gather.h>
+#include <thrust/system/stdpar/detail/generate.h>
+#include <thrust/system/stdpar/detail/get_value.h>
+#include <thrust/system/stdpar/detail/hash_reduce_by_key.h>
+#include <thrust/system/stdpar/detail/histogram.h>
+#include <thrust/system/stdpar/detail/inner_product.h>
+#include <thrust/system/stdpar/detail/iter_swap.h>
+#include <thrust/system/stdpar/detail/logical.h>
+#include <thrust/system/stdpar/detail/malloc_and_free.h>
+#include <thrust/system/stdpar/detail/merge.h>
+#include <thrust/system/stdpar/detail/merge_join.h>
+#include <thrust/system/stdpar/detail/mismatch.h>
+#include <thrust/system/stdpar/detail/multiway_merge.h>
+#include <thrust/system/stdpar/detail/partial_sort.h>
+#include <thrust/system/stdpar/detail/partition.h>
+#include <thrust/system/stdpar/detail/reduce.h>
+#include <thrust/system/stdpar/detail/reduce_by_key.h>
+#include <thrust/system/stdpar/detail/remove.h>
+#include <thrust/system/stdpar/detail/replace.h>
+#include <thrust/system/stdpar/detail/reverse.h>
+#include <thrust/system/stdpar/detail/run_length_encode.h>
+#include <thrust/system/stdpar/detail/scan.h>
+#include <thrust/system/stdpar/detail/scan_by_key.h>
+#include <thrust/system/stdpar/detail/scatter.h>
+#include <thrust/system/stdpar/detail/segmented_reduce.h>
+#include <thrust/system/stdpar/detail/segmented_sort.h>
+#include <thrust/system/stdpar/detail/sequence.h>
+#include <thrust/system/stdpar/detail/set_operations.h>
+#include <thrust/system/stdpar/detail/shuffle.h>
+#include <thrust/system/stdpar/detail/sort.h>
+#include <thrust/system/stdpar/detail/sort_strings.h>
+#include <thrust/system/stdpar/detail/swap_ranges.h>
+#include <thrust/system/stdpar/detail/tabulate.h>
+#include <thrust/system/stdpar/detail/transform.h>
+#include <thrust/system/stdpar/detail/transform_reduce.h>
+#include <thrust/system/stdpar/detail/transform_scan.h>
+#include <thrust/system/stdpar/detail/uninitialized_copy.h>
+#include <thrust/system/stdpar/detail/uninitialized_fill.h>
+#include <thrust/system/stdpar/detail/unique.h>
+#include <thrust/system/stdpar/detail/unique_by_key.h>
+
+
+// define these entities here for the purpose of Doxygenating them
+// they are actually defined elsewhere
+#if 0
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+
+/*! \p thrust::stdpar::execution_policy is the base class for all Thrust parallel execution
+ *  policies which are derived from Thrust's stdpar backend system.
+ */
+template<typename DerivedPolicy>
+struct execution_policy : thrust::execution_policy<DerivedPolicy>
+{};
+
+
+/*! \p stdpar::tag is a type representing Thrust's stdpar backend system in C++'s type system.
+ *  Iterators "tagged" with a type which is convertible to \p stdpar::tag assert that they may be
+ *  "dispatched" to algorithm implementations in the \p stdpar system.
+ */
+struct tag : thrust::system::stdpar::execution_policy<tag> { unspecified };
+
+
+/*! \p thrust::stdpar::par is the parallel execution policy associated with Thrust's stdpar
+ *  backend system.
+ *
+ *  Instead of relying on implicit algorithm dispatch through iterator system tags, users may
+ *  directly target Thrust's stdpar backend system by providing \p thrust::stdpar::par as an algorithm
+ *  parameter.
+ *
+ *  Explicit dispatch can be useful in avoiding the introduction of data copies into containers such
+ *  as \p thrust::stdpar::vector.
+ *
+ *  The type of \p thrust::stdpar::par is implementation-defined.
+ *
+ *  The following code snippet demonstrates how to use \p thrust::stdpar::par to explicitly dispatch an
+ *  invocation of \p thrust::for_each to the stdpar backend system:
+ *
+ *  \code
+ *  #include <thrust/for_each.h>
+ *  #include <thrust/system/stdpar/execution_policy.h>
+ *  #include <cstdio>
+ *
+ *  struct printf_functor
+ *  {
+ *    THRUST_HOST_DEVICE
+ *    void operator()(int x)
+ *    {
+ *      printf("%d\n", x);
+ *    }
+ *  };
+ *  ...
+ *  int vec[3];
+ *  vec[0] = 0; vec[1] = 1; vec[2] = 2;
+ *
+ *  thrust::for_each(thrust::stdpar::par, vec.begin(), vec.end(), printf_functor());
+ *
+ *  // 0 1 2 is printed to standard output in some unspecified order
+ *  \endcode
+ */
+static const unspecified par;
+
+
+/*! \}
+ */
+
+
+} // end stdpar
+} // end system
+THRUST_NAMESPACE_END
+#endif
+
+
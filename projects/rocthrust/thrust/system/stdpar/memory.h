@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2008-2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/system/stdpar/memory.h
+ *  \brief Managing memory associated with Thrust's stdpar system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/stdpar/memory_resource.h>
+#include <thrust/memory.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/mr/allocator.h>
+#include <ostream>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace stdpar
+{
+
+/*! Allocates an area of memory available to Thrust's <tt>stdpar</tt> system.
+ *  \param n Number of bytes to allocate.
+ *  \return A <tt>stdpar::pointer<void></tt> pointing to the beginning of the newly
+ *          allocated memory. A null <tt>stdpar::pointer<void></tt> is returned if
+ *          an error occurs.
+ *  \note The <tt>stdpar::pointer<void></tt> returned by this function must be
+ *        deallocated with \p stdpar::free.
+ *  \see stdpar::free
+ *  \see std::malloc
+ */
+inline pointer<void> malloc(std::size_t n);
+
+/*! Allocates a typed area of memory available to Thrust's <tt>stdpar</tt> system.
+ *  \param n Number of elements to allocate.
+ *  \return A <tt>stdpar::pointer<T></tt> pointing to the beginning of the newly
+ *          allocated memory. A null <tt>stdpar::pointer<T></tt> is returned if
+ *          an error occurs.
+ *  \note The <tt>stdpar::pointer<T></tt> returned by this function must be
+ *        deallocated with \p stdpar::free.
+ *  \see stdpar::free
+ *  \see std::malloc
+ */
+template<typename T>
+inline pointer<T> malloc(std::size_t n);
+
+/*! Deallocates an area of memory previously allocated by <tt>stdpar::malloc</tt>.
+ *  \param ptr A <tt>stdpar::pointer<void></tt> pointing to the beginning of an area
+ *         of memory previously allocated with <tt>stdpar::malloc</tt>.
+ *  \see stdpar::malloc
+ *  \see std::free
+ */
+inline void free(pointer<void> ptr);
+
+/*! \p stdpar::allocator is the default allocator used by the \p stdpar system's
+ *  containers such as <tt>stdpar::vector</tt> if no user-specified allocator is
+ *  provided. \p stdpar::allocator allocates (deallocates) storage with \p
+ *  stdpar::malloc (\p stdpar::free).
+ */
+template<typename T>
+using allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::stdpar::memory_resource
+>;
+
+/*! \p stdpar::universal_allocator allocates memory that can be used by the \p stdpar
+ *  system and host systems.
+ */
+template<typename T>
+using universal_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::stdpar::universal_memory_resource
+>;
+
+}} // namespace system::stdpar
+
+/*! \namespace thrust::stdpar
+ *  \brief \p thrust::stdpar is a top-level alias for thrust::system::stdpar.
+ */
+namespace stdpar
+{
+using thrust::system::stdpar::malloc;
+using thrust::system::stdpar::free;
+using thrust::system::stdpar::allocator;
+using thrust::system::stdpar::universal_allocator;
+} // namsespace stdpar
+
+THRUST_NAMESPACE_END
+
+#include <thrust/system/stdpar/detail/memory.inl>
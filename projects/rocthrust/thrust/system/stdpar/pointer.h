@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2008-2020 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/system/stdpar/memory.h
+ *  \brief Managing memory associated with Thrust's stdpar system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <type_traits>
+#include <thrust/system/stdpar/detail/execution_policy.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/reference.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system { namespace stdpar
+{
+
+/*! \p stdpar::pointer stores a pointer to an object allocated in memory accessible
+ *  by the \p stdpar system. This type provides type safety when dispatching
+ *  algorithms on ranges resident in \p stdpar memory.
+ *
+ *  \p stdpar::pointer has pointer semantics: it may be dereferenced and
+ *  manipulated with pointer arithmetic.
+ *
+ *  \p stdpar::pointer can be created with the function \p stdpar::malloc, or by
+ *  explicitly calling its constructor with a raw pointer.
+ *
+ *  The raw pointer encapsulated by a \p stdpar::pointer may be obtained by eiter its
+ *  <tt>get</tt> member function or the \p raw_pointer_cast function.
+ *
+ *  \note \p stdpar::pointer is not a "smart" pointer; it is the programmer's
+ *        responsibility to deallocate memory pointed to by \p stdpar::pointer.
+ *
+ *  \tparam T specifies the type of the pointee.
+ *
+ *  \see stdpar::malloc
+ *  \see stdpar::free
+ *  \see raw_pointer_cast
+ */
+template <typename T>
+using pointer = thrust::pointer<
+  T,
+  thrust::system::stdpar::tag,
+  thrust::tagged_reference<T, thrust::system::stdpar::tag>
+>;
+
+/*! \p stdpar::universal_pointer stores a pointer to an object allocated in memory
+ * accessible by the \p stdpar system and host systems.
+ *
+ *  \p stdpar::universal_pointer has pointer semantics: it may be dereferenced and
+ *  manipulated with pointer arithmetic.
+ *
+ *  \p stdpar::universal_pointer can be created with \p stdpar::universal_allocator
+ *  or by explicitly calling its constructor with a raw pointer.
+ *
+ *  The raw pointer encapsulated by a \p stdpar::universal_pointer may be obtained
+ *  by eiter its <tt>get</tt> member function or the \p raw_pointer_cast
+ *  function.
+ *
+ *  \note \p stdpar::universal_pointer is not a "smart" pointer; it is the
+ *        programmer's responsibility to deallocate memory pointed to by
+ *        \p stdpar::universal_pointer.
+ *
+ *  \tparam T specifies the type of the pointee.
+ *
+ *  \see stdpar::universal_allocator
+ *  \see raw_pointer_cast
+ */
+template <typename T>
+using universal_pointer = thrust::pointer<
+  T,
+  thrust::system::stdpar::tag,
+  typename std::add_lvalue_reference<T>::type
+>;
+
+/*! \p reference is a wrapped reference to an object stored in memory available
+ *  to the \p stdpar system. \p reference is the type of the result of
+ *  dereferencing a \p stdpar::pointer.
+ *
+ *  \tparam T Specifies the type of the referenced object.
+ */
+template <typename T>
+using reference = thrust::tagged_reference<T, thrust::system::stdpar::tag>;
+
+}} // namespace system::stdpar
+
+/*! \addtogroup system_backends Systems
+ *  \ingroup system
+ *  \{
+ */
+
+/*! \namespace thrust::stdpar
+ *  \brief \p thrust::stdpar is a top-level alias for \p thrust::system::stdpar. */
+namespace stdpar
+{
+using thrust::system::stdpar::pointer;
+using thrust::system::stdpar::universal_pointer;
+using thrust::system::stdpar::reference;
+} // namespace stdpar
+
+THRUST_NAMESPACE_END
+
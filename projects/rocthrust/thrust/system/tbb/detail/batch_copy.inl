@@ -0,0 +1,177 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/batch_copy.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace batch_copy_detail
+{
+
+
+// The elements of all of the buffers are split into chunks of equal size, this
+// many per thread. A chunk holds at least min_chunk_bytes bytes, so that a small
+// batch is copied by the calling thread without opening a parallel region.
+const static int chunks_per_thread = 4;
+const static int min_chunk_bytes   = 1 << 16;
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Offset,
+         typename Size>
+struct chunk_copier
+{
+  RandomAccessIterator1 src_ptrs;
+  RandomAccessIterator2 dst_ptrs;
+  const Offset         *offsets;
+  Size                  num_buffers;
+
+  // copies the elements [first, last) of the concatenation of all of the buffers
+  void operator()(Offset first, Offset last) const
+  {
+    using src_iterator = typename thrust::iterator_value<RandomAccessIterator1>::type;
+    using dst_iterator = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+    Size buffer = thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_buffers + 1, first) - (offsets + 1);
+
+    for(; buffer < num_buffers && offsets[buffer] < last; ++buffer)
+    {
+      const Offset begin = first > offsets[buffer] ? first : offsets[buffer];
+      const Offset end   = last < offsets[buffer + 1] ? last : offsets[buffer + 1];
+
+      if(begin < end)
+      {
+        src_iterator src = src_ptrs[buffer];
+        dst_iterator dst = dst_ptrs[buffer];
+
+        // trivially copyable buffers are copied with memcpy
+        thrust::copy_n(thrust::seq, src + (begin - offsets[buffer]), end - begin, dst + (begin - offsets[buffer]));
+      }
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Offset,
+         typename Size>
+struct chunk_body
+{
+  chunk_copier<RandomAccessIterator1, RandomAccessIterator2, Offset, Size> copier;
+
+  thrust::system::detail::internal::uniform_decomposition<Offset> decomp;
+
+  chunk_body(chunk_copier<RandomAccessIterator1, RandomAccessIterator2, Offset, Size> copier,
+             thrust::system::detail::internal::uniform_decomposition<Offset> decomp)
+    : copier(copier), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Offset> &r) const
+  {
+    for(Offset chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      copier(decomp[chunk].begin(), decomp[chunk].end());
+    }
+  }
+};
+
+
+} // end namespace batch_copy_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+  void batch_copy(execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator1 src_ptrs,
+                  RandomAccessIterator2 dst_ptrs,
+                  RandomAccessIterator3 sizes,
+                  Size num_buffers)
+{
+  using offset_type = typename thrust::iterator_difference<RandomAccessIterator3>::type;
+  using value_type  = typename thrust::iterator_value<typename thrust::iterator_value<RandomAccessIterator2>::type>::type;
+
+  if(num_buffers <= 0)
+    return;
+
+  // offsets[i] is the position of buffer i in the concatenation of all of the
+  // buffers; the sizes are summed sequentially, which is cheap next to the copy
+  thrust::detail::temporary_array<offset_type, DerivedPolicy> offsets_storage(exec, num_buffers + 1);
+
+  offset_type *offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  offsets[0] = 0;
+  for(Size i = 0; i < num_buffers; ++i)
+  {
+    offsets[i + 1] = offsets[i] + static_cast<offset_type>(sizes[i]);
+  }
+
+  const offset_type n = offsets[num_buffers];
+
+  // balance the bytes, rather than the buffers, over the threads
+  const offset_type granularity = sizeof(value_type) < static_cast<std::size_t>(batch_copy_detail::min_chunk_bytes)
+                                ? static_cast<offset_type>(batch_copy_detail::min_chunk_bytes / sizeof(value_type))
+                                : 1;
+
+  thrust::system::detail::internal::uniform_decomposition<offset_type> decomp(
+    n, granularity, static_cast<offset_type>(::tbb::this_task_arena::max_concurrency() * batch_copy_detail::chunks_per_thread));
+
+  const offset_type num_chunks = decomp.size();
+
+  const batch_copy_detail::chunk_copier<RandomAccessIterator1, RandomAccessIterator2, offset_type, Size> copier =
+    {src_ptrs, dst_ptrs, offsets, num_buffers};
+
+  if(num_chunks <= 1)
+  {
+    copier(0, n);
+    return;
+  }
+
+  batch_copy_detail::chunk_body<RandomAccessIterator1, RandomAccessIterator2, offset_type, Size> body(copier, decomp);
+
+  ::tbb::parallel_for(::tbb::blocked_range<offset_type>(0, num_chunks, 1), body);
+} // end batch_copy()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
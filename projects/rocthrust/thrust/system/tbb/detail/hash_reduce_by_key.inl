@@ -0,0 +1,398 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/hash_reduce_by_key.h>
+#include <thrust/pair.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/hash_reduce_by_key.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/hash_reduce_by_key.h>
+
+#include <cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace hash_reduce_by_key_detail
+{
+
+
+using thrust::system::detail::sequential::hash_reduce_by_key_detail::hash_table;
+using thrust::system::detail::sequential::hash_reduce_by_key_detail::mix_hash;
+
+
+// The input is split into one chunk per thread, every chunk aggregated in a
+// table of its own. A chunk holds at least min_chunk_size elements, so that
+// a short input is handled by the calling thread alone.
+const static int min_chunk_size = 1 << 14;
+
+
+// The keys are aggregated in three steps: every chunk of the input is
+// aggregated in a table of its own, the entries of every table are ordered
+// by the partition of the hash space their hashes fall in, and every
+// partition merges its entries of all of the tables in a table of its own.
+// There are as many partitions as chunks, and the partition of a hash is
+// taken from its high bits, which don't select its slot in a table.
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+struct aggregator
+{
+  using difference_type = typename thrust::iterator_difference<InputIterator1>::type;
+  using KeyType         = typename thrust::iterator_value<InputIterator1>::type;
+  using ValueType       = typename thrust::iterator_value<InputIterator2>::type;
+  using table_type      = hash_table<KeyType, ValueType, difference_type>;
+
+  DerivedPolicy  &exec;
+  InputIterator1  keys_first;
+  InputIterator2  values_first;
+  BinaryPredicate binary_pred;
+  BinaryFunction  binary_op;
+  Hash            hash;
+
+  difference_type num_partitions;
+
+  // the tables of the chunks and of the partitions
+  table_type *chunk_tables;
+  table_type *partition_tables;
+
+  // the entries of chunk c, ordered by partition, are
+  // order[orders[c]], ..., order[orders[c + 1] - 1], and those in partition p
+  // begin at order[partition_starts[c * (num_partitions + 1) + p]]
+  difference_type       *order;
+  const difference_type *orders;
+  difference_type       *partition_starts;
+
+  void aggregate_chunk(difference_type chunk, difference_type begin, difference_type end) const
+  {
+    thrust::detail::wrapped_function<BinaryPredicate, bool>   wrapped_binary_pred(binary_pred);
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+    Hash chunk_hash = hash;
+
+    table_type &table = chunk_tables[chunk];
+
+    for(difference_type i = begin; i < end; ++i)
+    {
+      const KeyType   key   = keys_first[i];
+      const ValueType value = values_first[i];
+
+      table.insert(exec, key, value, mix_hash(chunk_hash(key)), wrapped_binary_pred, wrapped_binary_op);
+    }
+  }
+
+  difference_type partition_of(std::uint64_t hash) const
+  {
+    return static_cast<difference_type>(((hash >> 32) * static_cast<std::uint64_t>(num_partitions)) >> 32);
+  }
+
+  // a counting sort of the entries of the table of chunk by partition
+  void order_chunk(difference_type chunk) const
+  {
+    const table_type &table = chunk_tables[chunk];
+
+    difference_type *starts = partition_starts + chunk * (num_partitions + 1);
+
+    for(difference_type p = 0; p <= num_partitions; ++p)
+      starts[p] = 0;
+
+    for(difference_type i = 0; i < table.size; ++i)
+      ++starts[partition_of(table.hashes[i]) + 1];
+
+    starts[0] = orders[chunk];
+    for(difference_type p = 0; p < num_partitions; ++p)
+      starts[p + 1] += starts[p];
+
+    // starts[p] is advanced past the entries of partition p while they're
+    // placed, and is then where partition p + 1 begins
+    for(difference_type i = 0; i < table.size; ++i)
+      order[starts[partition_of(table.hashes[i])]++] = i;
+
+    for(difference_type p = num_partitions; p > 0; --p)
+      starts[p] = starts[p - 1];
+
+    starts[0] = orders[chunk];
+  }
+
+  void merge_partition(difference_type partition) const
+  {
+    thrust::detail::wrapped_function<BinaryPredicate, bool>   wrapped_binary_pred(binary_pred);
+    thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op(binary_op);
+
+    table_type &table = partition_tables[partition];
+
+    // the partition holds at most as many keys as its entries in all of the tables
+    difference_type num_entries = 0;
+
+    for(difference_type chunk = 0; chunk < num_partitions; ++chunk)
+    {
+      const difference_type *starts = partition_starts + chunk * (num_partitions + 1);
+
+      num_entries += starts[partition + 1] - starts[partition];
+    }
+
+    table.reserve(exec, num_entries);
+
+    for(difference_type chunk = 0; chunk < num_partitions; ++chunk)
+    {
+      const table_type      &chunk_table = chunk_tables[chunk];
+      const difference_type *starts      = partition_starts + chunk * (num_partitions + 1);
+
+      for(difference_type k = starts[partition]; k < starts[partition + 1]; ++k)
+      {
+        const difference_type i = order[k];
+
+        table.insert(exec, chunk_table.keys[i], chunk_table.values[i], chunk_table.hashes[i], wrapped_binary_pred, wrapped_binary_op);
+      }
+    }
+  }
+
+  // writes the keys of a partition, then returns the storage of the partition
+  // and of the chunk with the same index
+  template<typename OutputIterator1, typename OutputIterator2>
+  void write_partition(difference_type partition,
+                       difference_type offset,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output) const
+  {
+    table_type &table = partition_tables[partition];
+
+    for(difference_type i = 0; i < table.size; ++i)
+    {
+      keys_output[offset + i]   = table.keys[i];
+      values_output[offset + i] = table.values[i];
+    }
+
+    table.release(exec);
+    chunk_tables[partition].release(exec);
+  }
+};
+
+
+template<typename Aggregator>
+struct aggregate_body
+{
+  using difference_type = typename Aggregator::difference_type;
+
+  Aggregator aggregator;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp;
+
+  aggregate_body(Aggregator aggregator, thrust::system::detail::internal::uniform_decomposition<difference_type> decomp)
+    : aggregator(aggregator), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<difference_type> &r) const
+  {
+    for(difference_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      aggregator.aggregate_chunk(chunk, decomp[chunk].begin(), decomp[chunk].end());
+    }
+  }
+};
+
+
+template<typename Aggregator>
+struct order_body
+{
+  using difference_type = typename Aggregator::difference_type;
+
+  Aggregator aggregator;
+
+  order_body(Aggregator aggregator) : aggregator(aggregator) {}
+
+  void operator()(const ::tbb::blocked_range<difference_type> &r) const
+  {
+    for(difference_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      aggregator.order_chunk(chunk);
+    }
+  }
+};
+
+
+template<typename Aggregator>
+struct merge_body
+{
+  using difference_type = typename Aggregator::difference_type;
+
+  Aggregator aggregator;
+
+  merge_body(Aggregator aggregator) : aggregator(aggregator) {}
+
+  void operator()(const ::tbb::blocked_range<difference_type> &r) const
+  {
+    for(difference_type partition = r.begin(); partition != r.end(); ++partition)
+    {
+      aggregator.merge_partition(partition);
+    }
+  }
+};
+
+
+template<typename Aggregator,
+         typename OutputIterator1,
+         typename OutputIterator2>
+struct write_body
+{
+  using difference_type = typename Aggregator::difference_type;
+
+  Aggregator             aggregator;
+  const difference_type *offsets;
+  OutputIterator1        keys_output;
+  OutputIterator2        values_output;
+
+  write_body(Aggregator aggregator,
+             const difference_type *offsets,
+             OutputIterator1 keys_output,
+             OutputIterator2 values_output)
+    : aggregator(aggregator), offsets(offsets), keys_output(keys_output), values_output(values_output)
+  {}
+
+  void operator()(const ::tbb::blocked_range<difference_type> &r) const
+  {
+    for(difference_type partition = r.begin(); partition != r.end(); ++partition)
+    {
+      aggregator.write_partition(partition, offsets[partition], keys_output, values_output);
+    }
+  }
+};
+
+
+} // end namespace hash_reduce_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename Hash>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    hash_reduce_by_key(execution_policy<DerivedPolicy> &exec,
+                       InputIterator1 keys_first,
+                       InputIterator1 keys_last,
+                       InputIterator2 values_first,
+                       OutputIterator1 keys_output,
+                       OutputIterator2 values_output,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       Hash hash)
+{
+  using aggregator_type = hash_reduce_by_key_detail::aggregator<DerivedPolicy, InputIterator1, InputIterator2, BinaryPredicate, BinaryFunction, Hash>;
+  using difference_type = typename aggregator_type::difference_type;
+  using table_type      = typename aggregator_type::table_type;
+
+  const difference_type n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(
+    n,
+    hash_reduce_by_key_detail::min_chunk_size,
+    static_cast<difference_type>(::tbb::this_task_arena::max_concurrency()));
+
+  const difference_type num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    return thrust::hash_reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op, hash);
+  }
+
+  thrust::detail::temporary_array<table_type, DerivedPolicy>      chunk_tables(exec, num_chunks);
+  thrust::detail::temporary_array<table_type, DerivedPolicy>      partition_tables(exec, num_chunks);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> orders_storage(exec, num_chunks + 1);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> offsets_storage(exec, num_chunks + 1);
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> partition_starts(exec, num_chunks * (num_chunks + 1));
+
+  difference_type *orders  = thrust::raw_pointer_cast(orders_storage.data());
+  difference_type *offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  aggregator_type aggregator = {thrust::detail::derived_cast(exec),
+                                keys_first,
+                                values_first,
+                                binary_pred,
+                                binary_op,
+                                hash,
+                                num_chunks,
+                                thrust::raw_pointer_cast(chunk_tables.data()),
+                                thrust::raw_pointer_cast(partition_tables.data()),
+                                0,
+                                orders,
+                                thrust::raw_pointer_cast(partition_starts.data())};
+
+  hash_reduce_by_key_detail::aggregate_body<aggregator_type> aggregate(aggregator, decomp);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_chunks, 1), aggregate);
+
+  orders[0] = 0;
+  for(difference_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    orders[chunk + 1] = orders[chunk] + aggregator.chunk_tables[chunk].size;
+  }
+
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> order(exec, orders[num_chunks]);
+
+  aggregator.order = thrust::raw_pointer_cast(order.data());
+
+  hash_reduce_by_key_detail::order_body<aggregator_type> order_chunks(aggregator);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_chunks, 1), order_chunks);
+
+  hash_reduce_by_key_detail::merge_body<aggregator_type> merge(aggregator);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_chunks, 1), merge);
+
+  // the partitions are written one after the other
+  offsets[0] = 0;
+  for(difference_type partition = 0; partition < num_chunks; ++partition)
+  {
+    offsets[partition + 1] = offsets[partition] + aggregator.partition_tables[partition].size;
+  }
+
+  hash_reduce_by_key_detail::write_body<aggregator_type, OutputIterator1, OutputIterator2> write(
+    aggregator, offsets, keys_output, values_output);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_chunks, 1), write);
+
+  const difference_type num_keys = offsets[num_chunks];
+
+  return thrust::make_pair(keys_output + num_keys, values_output + num_keys);
+} // end hash_reduce_by_key()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
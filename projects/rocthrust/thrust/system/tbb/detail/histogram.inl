@@ -0,0 +1,231 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+// Up to this many bins every body counts into its own private copy of the
+// histogram, and the copies are summed when the bodies are joined. Larger
+// histograms are counted directly into a single shared copy with atomic
+// increments.
+const static int privatization_threshold = 1 << 16;
+
+
+template<typename InputIterator,
+         typename BinFunction>
+struct private_body
+{
+  InputIterator            first;
+  BinFunction              bin_op;
+  int                      num_bins;
+  std::vector<std::size_t> counts;
+
+  private_body(InputIterator first, BinFunction bin_op, int num_bins)
+    : first(first), bin_op(bin_op), num_bins(num_bins), counts(num_bins, 0)
+  {}
+
+  private_body(private_body &b, ::tbb::split)
+    : first(b.first), bin_op(b.bin_op), num_bins(b.num_bins), counts(b.num_bins, 0)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r)
+  {
+    // we assume that blocked_range specifies a contiguous range of integers
+    InputIterator iter = first + r.begin();
+
+    for(Size i = r.begin(); i != r.end(); ++i, ++iter)
+    {
+      const int bin = bin_op(*iter);
+
+      if(bin < num_bins)
+      {
+        ++counts[bin];
+      }
+    }
+  }
+
+  void join(private_body &b)
+  {
+    for(int bin = 0; bin < num_bins; ++bin)
+    {
+      counts[bin] += b.counts[bin];
+    }
+  }
+}; // end private_body
+
+
+template<typename InputIterator,
+         typename BinFunction>
+struct shared_body
+{
+  InputIterator             first;
+  BinFunction               bin_op;
+  int                       num_bins;
+  std::atomic<std::size_t> *counts;
+
+  shared_body(InputIterator first, BinFunction bin_op, int num_bins, std::atomic<std::size_t> *counts)
+    : first(first), bin_op(bin_op), num_bins(num_bins), counts(counts)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    // we assume that blocked_range specifies a contiguous range of integers
+    InputIterator iter = first + r.begin();
+
+    for(Size i = r.begin(); i != r.end(); ++i, ++iter)
+    {
+      const int bin = bin_op(*iter);
+
+      if(bin < num_bins)
+      {
+        counts[bin].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+}; // end shared_body
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+  RandomAccessIterator count_bins(execution_policy<DerivedPolicy> &,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  RandomAccessIterator histogram,
+                                  int num_bins,
+                                  BinFunction bin_op)
+{
+  using Counter = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using Size    = typename thrust::iterator_difference<InputIterator>::type;
+
+  if(num_bins <= 0)
+    return histogram;
+
+  const Size n = thrust::distance(first, last);
+
+  if(num_bins <= privatization_threshold)
+  {
+    private_body<InputIterator, BinFunction> body(first, bin_op, num_bins);
+    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), body);
+
+    for(int bin = 0; bin < num_bins; ++bin)
+    {
+      histogram[bin] = static_cast<Counter>(body.counts[bin]);
+    }
+  }
+  else
+  {
+    // value initialization zeroes the counters
+    std::vector<std::atomic<std::size_t>> counts(num_bins);
+
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n),
+                        shared_body<InputIterator, BinFunction>(first, bin_op, num_bins, counts.data()));
+
+    ::tbb::parallel_for(::tbb::blocked_range<int>(0, num_bins),
+                        [&](const ::tbb::blocked_range<int> &r)
+                        {
+                          for(int bin = r.begin(); bin != r.end(); ++bin)
+                          {
+                            histogram[bin] = static_cast<Counter>(counts[bin].load(std::memory_order_relaxed));
+                          }
+                        });
+  }
+
+  return histogram + num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename LevelType>
+  RandomAccessIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      int num_levels,
+                                      LevelType lower_level,
+                                      LevelType upper_level)
+{
+  using thrust::system::detail::generic::detail::histogram_even_bin;
+
+  return histogram_detail::count_bins(exec,
+                                      first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_even_bin<LevelType>(lower_level, upper_level, num_levels - 1));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator1 histogram_range(execution_policy<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 histogram,
+                                        RandomAccessIterator2 levels_first,
+                                        RandomAccessIterator2 levels_last)
+{
+  using thrust::system::detail::generic::detail::histogram_range_bin;
+
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(exec,
+                                      first,
+                                      last,
+                                      histogram,
+                                      num_levels - 1,
+                                      histogram_range_bin<RandomAccessIterator2>(levels_first, num_levels));
+} // end histogram_range()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,402 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/binary_search.h>
+#include <thrust/merge_join.h>
+#include <thrust/pair.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/merge_join.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/merge_join.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace merge_join_detail
+{
+
+
+using thrust::system::detail::sequential::merge_join_detail::join_kind;
+using thrust::system::detail::sequential::merge_join_detail::inner_join;
+using thrust::system::detail::sequential::merge_join_detail::left_outer_join;
+using thrust::system::detail::sequential::merge_join_detail::semi_join;
+using thrust::system::detail::sequential::merge_join_detail::pair_counter;
+using thrust::system::detail::sequential::merge_join_detail::pair_writer;
+using thrust::system::detail::sequential::merge_join_detail::index_writer;
+
+
+// The merged input is split into chunks of equal size, this many per thread.
+// A chunk holds at least min_chunk_size elements, so that a short input is
+// handled by the calling thread alone.
+const static int chunks_per_thread = 4;
+const static int min_chunk_size    = 1 << 12;
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename StrictWeakCompare>
+struct chunk_joiner
+{
+  using difference_type1 = typename thrust::iterator_difference<InputIterator1>::type;
+  using difference_type2 = typename thrust::iterator_difference<InputIterator2>::type;
+
+  InputIterator1   keys1_first;
+  difference_type1 n1;
+  InputIterator2   keys2_first;
+  difference_type2 n2;
+
+  thrust::detail::wrapped_function<StrictWeakCompare, bool> comp;
+
+  chunk_joiner(InputIterator1 keys1_first,
+               difference_type1 n1,
+               InputIterator2 keys2_first,
+               difference_type2 n2,
+               StrictWeakCompare comp)
+    : keys1_first(keys1_first), n1(n1), keys2_first(keys2_first), n2(n2), comp(comp)
+  {}
+
+  // Finds where the merge path of both ranges crosses the given diagonal, then
+  // moves the split back to the first key of both ranges equivalent to the next
+  // merged key, so that the keys equivalent to any key lie in a single chunk.
+  void split(difference_type1 diagonal, difference_type1 &i, difference_type2 &j) const
+  {
+    difference_type1 lo = diagonal > difference_type1(n2) ? diagonal - difference_type1(n2) : 0;
+    difference_type1 hi = diagonal < n1 ? diagonal : n1;
+
+    while(lo < hi)
+    {
+      const difference_type1 mid = lo + (hi - lo) / 2;
+
+      if(comp(keys2_first[diagonal - mid - 1], keys1_first[mid]))
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+    i = lo;
+    j = static_cast<difference_type2>(diagonal - lo);
+
+    if(i < n1 && (j == n2 || !comp(keys2_first[j], keys1_first[i])))
+      snap(keys1_first[i], i, j);
+    else if(j < n2)
+      snap(keys2_first[j], i, j);
+  }
+
+  template<typename Key>
+  void snap(const Key &key, difference_type1 &i, difference_type2 &j) const
+  {
+    i = thrust::lower_bound(thrust::seq, keys1_first, keys1_first + i, key, comp) - keys1_first;
+    j = thrust::lower_bound(thrust::seq, keys2_first, keys2_first + j, key, comp) - keys2_first;
+  }
+
+  template<join_kind Kind, typename Sink>
+  void join(difference_type1 begin1,
+            difference_type1 end1,
+            difference_type2 begin2,
+            difference_type2 end2,
+            Sink &sink) const
+  {
+    thrust::detail::wrapped_function<StrictWeakCompare, bool> chunk_comp = comp;
+
+    thrust::system::detail::sequential::merge_join_detail::join<Kind>(
+      keys1_first, begin1, end1, keys2_first, begin2, end2, chunk_comp, sink);
+  }
+};
+
+
+template<typename OutputIterator1, typename OutputIterator2, typename Size>
+pair_writer<OutputIterator1, OutputIterator2> sink_at(pair_writer<OutputIterator1, OutputIterator2> sink, Size offset)
+{
+  pair_writer<OutputIterator1, OutputIterator2> result = {sink.index1_output + offset, sink.index2_output + offset};
+  return result;
+}
+
+
+template<typename OutputIterator, typename Size>
+index_writer<OutputIterator> sink_at(index_writer<OutputIterator> sink, Size offset)
+{
+  index_writer<OutputIterator> result = {sink.index1_output + offset};
+  return result;
+}
+
+
+template<typename Joiner>
+struct split_body
+{
+  using difference_type1 = typename Joiner::difference_type1;
+  using difference_type2 = typename Joiner::difference_type2;
+
+  Joiner joiner;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type1> decomp;
+
+  difference_type1 *begins1;
+  difference_type2 *begins2;
+
+  split_body(Joiner joiner,
+             thrust::system::detail::internal::uniform_decomposition<difference_type1> decomp,
+             difference_type1 *begins1,
+             difference_type2 *begins2)
+    : joiner(joiner), decomp(decomp), begins1(begins1), begins2(begins2)
+  {}
+
+  void operator()(const ::tbb::blocked_range<difference_type1> &r) const
+  {
+    for(difference_type1 chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      joiner.split(decomp[chunk].begin(), begins1[chunk], begins2[chunk]);
+    }
+  }
+};
+
+
+template<join_kind Kind, typename Joiner>
+struct count_body
+{
+  using difference_type1 = typename Joiner::difference_type1;
+  using difference_type2 = typename Joiner::difference_type2;
+
+  Joiner joiner;
+
+  const difference_type1 *begins1;
+  const difference_type2 *begins2;
+  difference_type1       *offsets;
+
+  count_body(Joiner joiner, const difference_type1 *begins1, const difference_type2 *begins2, difference_type1 *offsets)
+    : joiner(joiner), begins1(begins1), begins2(begins2), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<difference_type1> &r) const
+  {
+    for(difference_type1 chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      pair_counter<difference_type1> counter = {0};
+
+      joiner.template join<Kind>(begins1[chunk], begins1[chunk + 1], begins2[chunk], begins2[chunk + 1], counter);
+
+      offsets[chunk + 1] = counter.count;
+    }
+  }
+};
+
+
+template<join_kind Kind, typename Joiner, typename Sink>
+struct join_body
+{
+  using difference_type1 = typename Joiner::difference_type1;
+  using difference_type2 = typename Joiner::difference_type2;
+
+  Joiner joiner;
+
+  const difference_type1 *begins1;
+  const difference_type2 *begins2;
+  const difference_type1 *offsets;
+  Sink                    sink;
+
+  join_body(Joiner joiner,
+            const difference_type1 *begins1,
+            const difference_type2 *begins2,
+            const difference_type1 *offsets,
+            Sink sink)
+    : joiner(joiner), begins1(begins1), begins2(begins2), offsets(offsets), sink(sink)
+  {}
+
+  void operator()(const ::tbb::blocked_range<difference_type1> &r) const
+  {
+    for(difference_type1 chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      Sink chunk_sink = merge_join_detail::sink_at(sink, offsets[chunk]);
+
+      joiner.template join<Kind>(begins1[chunk], begins1[chunk + 1], begins2[chunk], begins2[chunk + 1], chunk_sink);
+    }
+  }
+};
+
+
+// Joins both ranges in two passes over the chunks of their merge path: the
+// first counts the joined pairs of each chunk, the second writes them at the
+// offsets of the chunks. Returns the number of joined pairs.
+template<join_kind Kind,
+         typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Sink,
+         typename StrictWeakCompare>
+  typename thrust::iterator_difference<InputIterator1>::type
+    join_chunks(execution_policy<DerivedPolicy> &exec,
+                InputIterator1 keys1_first,
+                InputIterator1 keys1_last,
+                InputIterator2 keys2_first,
+                InputIterator2 keys2_last,
+                Sink sink,
+                StrictWeakCompare comp)
+{
+  using difference_type1 = typename thrust::iterator_difference<InputIterator1>::type;
+  using difference_type2 = typename thrust::iterator_difference<InputIterator2>::type;
+
+  const difference_type1 n1 = keys1_last - keys1_first;
+  const difference_type2 n2 = keys2_last - keys2_first;
+
+  const chunk_joiner<InputIterator1, InputIterator2, StrictWeakCompare> joiner(keys1_first, n1, keys2_first, n2, comp);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type1> decomp(
+    n1 + difference_type1(n2),
+    min_chunk_size,
+    static_cast<difference_type1>(::tbb::this_task_arena::max_concurrency() * chunks_per_thread));
+
+  const difference_type1 num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    Sink result = sink;
+
+    joiner.template join<Kind>(0, n1, 0, n2, result);
+
+    return result.index1_output - sink.index1_output;
+  }
+
+  // chunk c joins the keys [begins1[c], begins1[c + 1]) and [begins2[c], begins2[c + 1])
+  thrust::detail::temporary_array<difference_type1, DerivedPolicy> begins1_storage(exec, num_chunks + 1);
+  thrust::detail::temporary_array<difference_type2, DerivedPolicy> begins2_storage(exec, num_chunks + 1);
+  thrust::detail::temporary_array<difference_type1, DerivedPolicy> offsets_storage(exec, num_chunks + 1);
+
+  difference_type1 *begins1 = thrust::raw_pointer_cast(begins1_storage.data());
+  difference_type2 *begins2 = thrust::raw_pointer_cast(begins2_storage.data());
+  difference_type1 *offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  begins1[0]          = 0;
+  begins2[0]          = 0;
+  begins1[num_chunks] = n1;
+  begins2[num_chunks] = n2;
+
+  using joiner_type = chunk_joiner<InputIterator1, InputIterator2, StrictWeakCompare>;
+
+  split_body<joiner_type> splitter(joiner, decomp, begins1, begins2);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type1>(1, num_chunks, 1), splitter);
+
+  // count the joined pairs of each chunk
+  count_body<Kind, joiner_type> counter(joiner, begins1, begins2, offsets);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type1>(0, num_chunks, 1), counter);
+
+  offsets[0] = 0;
+  for(difference_type1 chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  // every chunk writes its own pairs to their final positions
+  join_body<Kind, joiner_type, Sink> writer(joiner, begins1, begins2, offsets, sink);
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type1>(0, num_chunks, 1), writer);
+
+  return offsets[num_chunks];
+} // end join_chunks()
+
+
+} // end namespace merge_join_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_join(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys1_first,
+               InputIterator1 keys1_last,
+               InputIterator2 keys2_first,
+               InputIterator2 keys2_last,
+               OutputIterator1 index1_output,
+               OutputIterator2 index2_output,
+               StrictWeakCompare comp)
+{
+  const merge_join_detail::pair_writer<OutputIterator1, OutputIterator2> sink = {index1_output, index2_output};
+
+  const typename thrust::iterator_difference<InputIterator1>::type num_pairs =
+    merge_join_detail::join_chunks<merge_join_detail::inner_join>(exec, keys1_first, keys1_last, keys2_first, keys2_last, sink, comp);
+
+  return thrust::make_pair(index1_output + num_pairs, index2_output + num_pairs);
+} // end merge_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_left_outer_join(execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 keys1_first,
+                          InputIterator1 keys1_last,
+                          InputIterator2 keys2_first,
+                          InputIterator2 keys2_last,
+                          OutputIterator1 index1_output,
+                          OutputIterator2 index2_output,
+                          StrictWeakCompare comp)
+{
+  const merge_join_detail::pair_writer<OutputIterator1, OutputIterator2> sink = {index1_output, index2_output};
+
+  const typename thrust::iterator_difference<InputIterator1>::type num_pairs =
+    merge_join_detail::join_chunks<merge_join_detail::left_outer_join>(exec, keys1_first, keys1_last, keys2_first, keys2_last, sink, comp);
+
+  return thrust::make_pair(index1_output + num_pairs, index2_output + num_pairs);
+} // end merge_left_outer_join()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename StrictWeakCompare>
+  OutputIterator1 merge_semi_join(execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 keys1_first,
+                                  InputIterator1 keys1_last,
+                                  InputIterator2 keys2_first,
+                                  InputIterator2 keys2_last,
+                                  OutputIterator1 index1_output,
+                                  StrictWeakCompare comp)
+{
+  const merge_join_detail::index_writer<OutputIterator1> sink = {index1_output};
+
+  return index1_output
+       + merge_join_detail::join_chunks<merge_join_detail::semi_join>(exec, keys1_first, keys1_last, keys2_first, keys2_last, sink, comp);
+} // end merge_semi_join()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -18,6 +18,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/cached_temporaries_execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -31,6 +32,8 @@ namespace detail
 
 struct par_t : thrust::system::tbb::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
+    thrust::system::tbb::detail::execution_policy>,
+  thrust::detail::cached_temporaries_execution_policy<
     thrust::system::tbb::detail::execution_policy>
 {
   THRUST_HOST_DEVICE
@@ -0,0 +1,248 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/seq.h>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace segmented_sort_detail
+{
+
+
+// Segments of at least this many keys are sorted one after another, each by
+// the parallel sort. Shorter segments are sorted whole by a single thread.
+const static int large_segment_threshold = 1 << 16;
+
+
+// The short segments are dealt out in chunks of roughly equal numbers of keys,
+// this many per thread, so that threads which draw long segments early don't
+// hold up the others.
+const static int chunks_per_thread = 8;
+
+
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+struct keys_sorter
+{
+  RandomAccessIterator keys_first;
+  RandomAccessIterator keys_last;
+  StrictWeakOrdering   comp;
+
+  template<typename OffsetIterator>
+  void sort_sequential(OffsetIterator offsets_first, OffsetIterator offsets_last)
+  {
+    thrust::segmented_sort(thrust::seq, keys_first, keys_last, offsets_first, offsets_last, comp);
+  }
+
+  template<typename DerivedPolicy, typename Size>
+  void sort_parallel(execution_policy<DerivedPolicy> &exec, Size begin, Size end)
+  {
+    thrust::sort(exec, keys_first + begin, keys_first + end, comp);
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+struct pairs_sorter
+{
+  RandomAccessIterator1 keys_first;
+  RandomAccessIterator1 keys_last;
+  RandomAccessIterator2 values_first;
+  StrictWeakOrdering    comp;
+
+  template<typename OffsetIterator>
+  void sort_sequential(OffsetIterator offsets_first, OffsetIterator offsets_last)
+  {
+    thrust::segmented_sort_by_key(thrust::seq, keys_first, keys_last, values_first, offsets_first, offsets_last, comp);
+  }
+
+  template<typename DerivedPolicy, typename Size>
+  void sort_parallel(execution_policy<DerivedPolicy> &exec, Size begin, Size end)
+  {
+    thrust::sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+  }
+};
+
+
+template<typename RandomAccessIterator,
+         typename Sorter>
+struct chunk_body
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using index_type  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  RandomAccessIterator offsets_first;
+  index_type           num_segments;
+  Sorter               sorter;
+
+  thrust::system::detail::internal::uniform_decomposition<offset_type> decomp;
+
+  chunk_body(RandomAccessIterator offsets_first,
+             index_type num_segments,
+             Sorter sorter,
+             thrust::system::detail::internal::uniform_decomposition<offset_type> decomp)
+    : offsets_first(offsets_first), num_segments(num_segments), sorter(sorter), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    const offset_type keys_begin = offsets_first[0];
+
+    Sorter chunk_sorter = sorter;
+
+    for(index_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      const index_type first_segment = thrust::lower_bound(thrust::seq,
+                                                           offsets_first,
+                                                           offsets_first + num_segments,
+                                                           keys_begin + decomp[chunk].begin()) - offsets_first;
+      const index_type last_segment  = thrust::lower_bound(thrust::seq,
+                                                           offsets_first + first_segment,
+                                                           offsets_first + num_segments,
+                                                           keys_begin + decomp[chunk].end()) - offsets_first;
+
+      // sort the runs of short segments between the large ones sequentially
+      index_type run = first_segment;
+
+      for(index_type i = first_segment; i < last_segment; ++i)
+      {
+        if(offsets_first[i + 1] - offsets_first[i] >= large_segment_threshold)
+        {
+          if(run < i)
+          {
+            chunk_sorter.sort_sequential(offsets_first + run, offsets_first + i + 1);
+          }
+
+          run = i + 1;
+        }
+      }
+
+      if(run < last_segment)
+      {
+        chunk_sorter.sort_sequential(offsets_first + run, offsets_first + last_segment + 1);
+      }
+    }
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Sorter>
+void sort_segments(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator offsets_first,
+                   RandomAccessIterator offsets_last,
+                   Sorter sorter)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using index_type  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const index_type num_segments = (offsets_last - offsets_first) - 1;
+
+  if(num_segments <= 0)
+    return;
+
+  // the large segments have enough keys to keep every thread busy by themselves
+  for(index_type i = 0; i < num_segments; ++i)
+  {
+    const offset_type begin = offsets_first[i];
+    const offset_type end   = offsets_first[i + 1];
+
+    if(end - begin >= large_segment_threshold)
+    {
+      sorter.sort_parallel(exec, begin, end);
+    }
+  }
+
+  const offset_type keys_begin = offsets_first[0];
+  const offset_type keys_end   = offsets_first[num_segments];
+
+  // split the keys evenly into chunks; a chunk owns the short segments which start inside it
+  thrust::system::detail::internal::uniform_decomposition<offset_type> decomp(
+    keys_end - keys_begin, 1, static_cast<offset_type>(::tbb::this_task_arena::max_concurrency() * chunks_per_thread));
+
+  chunk_body<RandomAccessIterator, Sorter> body(offsets_first, num_segments, sorter, decomp);
+
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, decomp.size(), 1), body);
+}
+
+
+} // end namespace segmented_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void segmented_sort(execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator1 keys_first,
+                      RandomAccessIterator1 keys_last,
+                      RandomAccessIterator2 offsets_first,
+                      RandomAccessIterator2 offsets_last,
+                      StrictWeakOrdering comp)
+{
+  segmented_sort_detail::keys_sorter<RandomAccessIterator1, StrictWeakOrdering> sorter = {keys_first, keys_last, comp};
+
+  segmented_sort_detail::sort_segments(exec, offsets_first, offsets_last, sorter);
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             RandomAccessIterator3 offsets_first,
+                             RandomAccessIterator3 offsets_last,
+                             StrictWeakOrdering comp)
+{
+  segmented_sort_detail::pairs_sorter<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering> sorter = {keys_first, keys_last, values_first, comp};
+
+  segmented_sort_detail::sort_segments(exec, offsets_first, offsets_last, sorter);
+} // end segmented_sort_by_key()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
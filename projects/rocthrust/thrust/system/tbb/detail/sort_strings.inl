@@ -0,0 +1,391 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/binary_search.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/sort_strings.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/sort_strings.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/sort_strings.h>
+
+#include <cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace sort_strings_detail
+{
+
+
+// A range of strings is split into chunks of equal size, this many per thread.
+// A chunk holds at least min_chunk_size strings, so that a range of fewer
+// strings is sorted by the calling thread alone.
+const static int chunks_per_thread = 4;
+const static int min_chunk_size    = 1 << 14;
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+struct string_sorter
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+  using task_type   = thrust::system::detail::sequential::sort_strings_detail::task<index_type, offset_type>;
+
+  RandomAccessIterator1 chars_first;
+  RandomAccessIterator2 offsets_first;
+  RandomAccessIterator3 perm;
+  index_type           *buffer;
+  std::uint64_t        *keys;
+  std::uint64_t        *key_buffer;
+  task_type            *stack;
+
+  // reads the keys at depth of the strings of permutation positions [first, last)
+  void read_keys(index_type first, index_type last, offset_type depth) const
+  {
+    using thrust::system::detail::generic::detail::string_key;
+
+    for(index_type i = first; i < last; ++i)
+    {
+      const index_type  s     = perm[i];
+      const offset_type begin = offsets_first[s];
+
+      keys[i] = string_key(chars_first + begin, static_cast<offset_type>(offsets_first[s + 1] - begin), depth);
+    }
+  }
+
+  // the first group of equal keys which begins at or after position i of the
+  // sorted keys [first, last)
+  index_type group_at_or_after(index_type first, index_type last, index_type i) const
+  {
+    if(i == first || i == last || keys[i] != keys[i - 1])
+      return i;
+
+    return thrust::upper_bound(thrust::seq, keys + i, keys + last, keys[i - 1]) - keys;
+  }
+
+  // Sorts the groups of equal keys in [first, last) beyond the characters of
+  // the keys, except for a final group of more than max_group_size strings,
+  // which is returned instead.
+  thrust::pair<index_type, index_type>
+    sort_groups(index_type first, index_type last, offset_type depth, index_type max_group_size) const
+  {
+    using thrust::system::detail::generic::detail::string_key_chars;
+    using thrust::system::detail::generic::detail::string_key_continues;
+
+    thrust::detail::seq_t seq;
+
+    while(first < last)
+    {
+      index_type group_last = first + 1;
+
+      while(group_last < last && keys[group_last] == keys[first])
+        ++group_last;
+
+      // strings with equal keys which ended within them are equal, and already
+      // in the order of their indices
+      if(group_last - first > 1 && string_key_continues(keys[first]))
+      {
+        if(group_last == last && group_last - first > max_group_size)
+          return thrust::make_pair(first, group_last);
+
+        thrust::system::detail::sequential::sort_strings_detail::sort_range(
+          seq,
+          chars_first,
+          offsets_first,
+          perm + first,
+          buffer + first,
+          keys + first,
+          key_buffer + first,
+          stack + first,
+          static_cast<index_type>(group_last - first),
+          static_cast<offset_type>(depth + string_key_chars));
+      }
+
+      first = group_last;
+    }
+
+    return thrust::make_pair(last, last);
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+struct read_keys_body
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+
+  string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp;
+
+  index_type  first;
+  offset_type depth;
+
+  read_keys_body(string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter,
+                 thrust::system::detail::internal::uniform_decomposition<index_type> decomp,
+                 index_type first,
+                 offset_type depth)
+    : sorter(sorter), decomp(decomp), first(first), depth(depth)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      sorter.read_keys(first + decomp[chunk].begin(), first + decomp[chunk].end(), depth);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+struct group_starts_body
+{
+  using index_type = typename thrust::iterator_value<RandomAccessIterator3>::type;
+
+  string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp;
+
+  index_type  first;
+  index_type  last;
+  index_type *group_starts;
+
+  group_starts_body(string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter,
+                    thrust::system::detail::internal::uniform_decomposition<index_type> decomp,
+                    index_type first,
+                    index_type last,
+                    index_type *group_starts)
+    : sorter(sorter), decomp(decomp), first(first), last(last), group_starts(group_starts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      const index_type i = chunk < decomp.size() ? first + decomp[chunk].begin() : last;
+
+      group_starts[chunk] = sorter.group_at_or_after(first, last, i);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+struct sort_groups_body
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+
+  string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter;
+
+  const index_type *group_starts;
+  index_type       *large_groups;
+  offset_type       depth;
+  index_type        max_group_size;
+
+  sort_groups_body(string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> sorter,
+                   const index_type *group_starts,
+                   index_type *large_groups,
+                   offset_type depth,
+                   index_type max_group_size)
+    : sorter(sorter), group_starts(group_starts), large_groups(large_groups), depth(depth), max_group_size(max_group_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      thrust::pair<index_type, index_type> large_group =
+        sorter.sort_groups(group_starts[chunk], group_starts[chunk + 1], depth, max_group_size);
+
+      large_groups[2 * chunk]     = large_group.first;
+      large_groups[2 * chunk + 1] = large_group.second;
+    }
+  }
+};
+
+
+// Sorts the strings of permutation positions [first, last), which are equal up
+// to depth and in the order of their indices. The strings are sorted by their
+// keys at depth with the parallel sort, then the groups of equal keys are dealt
+// out to the threads, which sort them with the sequential algorithm. A group
+// which is larger than a chunk is sorted in parallel in the same way instead,
+// after the others.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  void sort_range(execution_policy<DerivedPolicy> &exec,
+                  const string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> &sorter,
+                  typename thrust::iterator_value<RandomAccessIterator3>::type first,
+                  typename thrust::iterator_value<RandomAccessIterator3>::type last,
+                  typename thrust::iterator_value<RandomAccessIterator2>::type depth)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+
+  const index_type n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp(
+    n,
+    min_chunk_size,
+    static_cast<index_type>(::tbb::this_task_arena::max_concurrency() * chunks_per_thread));
+
+  const index_type num_chunks = decomp.size();
+
+  if(num_chunks <= 1)
+  {
+    thrust::detail::seq_t seq;
+
+    thrust::system::detail::sequential::sort_strings_detail::sort_range(
+      seq,
+      sorter.chars_first,
+      sorter.offsets_first,
+      sorter.perm + first,
+      sorter.buffer + first,
+      sorter.keys + first,
+      sorter.key_buffer + first,
+      sorter.stack + first,
+      n,
+      depth);
+
+    return;
+  }
+
+  read_keys_body<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> reader(sorter, decomp, first, depth);
+
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, num_chunks, 1), reader);
+
+  // stable, so that equal strings stay in the order of their indices
+  thrust::stable_sort_by_key(exec, sorter.keys + first, sorter.keys + last, sorter.perm + first);
+
+  // chunk i sorts the groups which begin in it, that is the groups in
+  // [group_starts[i], group_starts[i + 1])
+  thrust::detail::temporary_array<index_type, DerivedPolicy> group_starts_storage(exec, num_chunks + 1);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> large_groups_storage(exec, 2 * num_chunks);
+
+  index_type *group_starts = thrust::raw_pointer_cast(group_starts_storage.data());
+  index_type *large_groups = thrust::raw_pointer_cast(large_groups_storage.data());
+
+  group_starts_body<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> starter(
+    sorter, decomp, first, last, group_starts);
+
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, num_chunks + 1, 1), starter);
+
+  // only the last group of a chunk can be larger than a chunk
+  const index_type max_group_size = (n + num_chunks - 1) / num_chunks;
+
+  sort_groups_body<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3> group_sorter(
+    sorter, group_starts, large_groups, depth, max_group_size);
+
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, num_chunks, 1), group_sorter);
+
+  for(index_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    if(large_groups[2 * chunk] < large_groups[2 * chunk + 1])
+    {
+      sort_strings_detail::sort_range(exec,
+                                      sorter,
+                                      large_groups[2 * chunk],
+                                      large_groups[2 * chunk + 1],
+                                      static_cast<offset_type>(depth + thrust::system::detail::generic::detail::string_key_chars));
+    }
+  }
+} // end sort_range()
+
+
+} // end namespace sort_strings_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  RandomAccessIterator3 sort_strings(execution_policy<DerivedPolicy> &exec,
+                                     RandomAccessIterator1 chars_first,
+                                     RandomAccessIterator2 offsets_first,
+                                     RandomAccessIterator2 offsets_last,
+                                     RandomAccessIterator3 permutation_out)
+{
+  using offset_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using index_type  = typename thrust::iterator_value<RandomAccessIterator3>::type;
+  using sorter_type = sort_strings_detail::string_sorter<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3>;
+  using task_type   = typename sorter_type::task_type;
+
+  const index_type n = static_cast<index_type>(offsets_last - offsets_first) - 1;
+
+  if(n <= 0)
+    return permutation_out;
+
+  if(n < sort_strings_detail::min_chunk_size)
+  {
+    return thrust::sort_strings(thrust::seq, chars_first, offsets_first, offsets_last, permutation_out);
+  }
+
+  thrust::sequence(exec, permutation_out, permutation_out + n);
+
+  // the groups sorted by the threads are disjoint, and every group uses the
+  // part of the scratch space at its own positions; a group of 2 strings or
+  // more needs fewer than one entry of stack per string
+  thrust::detail::temporary_array<index_type, DerivedPolicy>    buffer(exec, n);
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> keys(exec, n);
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> key_buffer(exec, n);
+  thrust::detail::temporary_array<task_type, DerivedPolicy>     stack(exec, n);
+
+  const sorter_type sorter = {chars_first,
+                              offsets_first,
+                              permutation_out,
+                              thrust::raw_pointer_cast(buffer.data()),
+                              thrust::raw_pointer_cast(keys.data()),
+                              thrust::raw_pointer_cast(key_buffer.data()),
+                              thrust::raw_pointer_cast(stack.data())};
+
+  sort_strings_detail::sort_range(exec, sorter, index_type(0), n, offset_type(0));
+
+  return permutation_out + n;
+} // end sort_strings()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
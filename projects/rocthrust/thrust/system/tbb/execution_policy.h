@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -32,6 +33,7 @@
 
 #include <thrust/system/tbb/detail/adjacent_difference.h>
 #include <thrust/system/tbb/detail/assign_value.h>
+#include <thrust/system/tbb/detail/batch_copy.h>
 #include <thrust/system/tbb/detail/binary_search.h>
 #include <thrust/system/tbb/detail/copy.h>
 #include <thrust/system/tbb/detail/copy_if.h>
@@ -44,24 +46,34 @@
 #include <thrust/system/tbb/detail/gather.h>
 #include <thrust/system/tbb/detail/generate.h>
 #include <thrust/system/tbb/detail/get_value.h>
+#include <thrust/system/tbb/detail/hash_reduce_by_key.h>
+#include <thrust/system/tbb/detail/histogram.h>
 #include <thrust/system/tbb/detail/inner_product.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/logical.h>
 #include <thrust/system/tbb/detail/malloc_and_free.h>
 #include <thrust/system/tbb/detail/merge.h>
+#include <thrust/system/tbb/detail/merge_join.h>
 #include <thrust/system/tbb/detail/mismatch.h>
+#include <thrust/system/tbb/detail/multiway_merge.h>
+#include <thrust/system/tbb/detail/partial_sort.h>
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/tbb/detail/reduce.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/remove.h>
 #include <thrust/system/tbb/detail/replace.h>
 #include <thrust/system/tbb/detail/reverse.h>
+#include <thrust/system/tbb/detail/run_length_encode.h>
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/system/tbb/detail/scan_by_key.h>
 #include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/system/tbb/detail/segmented_reduce.h>
+#include <thrust/system/tbb/detail/segmented_sort.h>
 #include <thrust/system/tbb/detail/sequence.h>
 #include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/shuffle.h>
 #include <thrust/system/tbb/detail/sort.h>
+#include <thrust/system/tbb/detail/sort_strings.h>
 #include <thrust/system/tbb/detail/swap_ranges.h>
 #include <thrust/system/tbb/detail/tabulate.h>
 #include <thrust/system/tbb/detail/transform.h>
@@ -139,6 +151,12 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  \p thrust::tbb::par.with_cached_temporaries() is a policy which obtains the temporary storage of
+ *  algorithms from a \p thrust::mr::caching_resource shared by all uses of the policy, so that
+ *  calling an algorithm repeatedly with the same sizes, as in the iterations of a solver, allocates
+ *  memory only the first time. The cache is returned by \p thrust::tbb::par.temporary_cache(),
+ *  through which it can be bounded with \p set_max_cached_bytes or emptied with \p trim.
  */
 static const unspecified par;
 
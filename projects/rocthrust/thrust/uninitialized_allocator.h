@@ -0,0 +1,158 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file uninitialized_allocator.h
+ *  \brief Facilities for creating containers whose new elements are left
+ *         uninitialized.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/destroy_range.h>
+
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! \brief The type of \p no_init.
+ */
+struct no_init_t
+{
+};
+
+/*! \brief A tag which, passed to the constructors and the \p resize method of
+ *         vectors, leaves the new elements uninitialized instead of value
+ *         initializing them, if their type is trivially default constructible.
+ *         Elements of other types are default constructed.
+ *
+ *  This saves a pass over the memory when the elements are about to be
+ *  overwritten anyway, such as the buffer of a read from a file.
+ *
+ *  \code
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<char> buffer(n, thrust::no_init);
+ *  std::fread(buffer.data(), 1, n, file);
+ *  \endcode
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \brief An allocator adaptor whose default construction of elements does
+ *         nothing, so that containers using it leave new elements
+ *         uninitialized unless they are given a value. All other operations
+ *         are those of the adapted allocator.
+ *
+ *  Unlike \p no_init, which only applies to the calls it is passed to, the
+ *  allocator affects all default construction of a container, including the
+ *  elements added by \p resize without a value. It is meant for elements of
+ *  trivially default constructible types, such as numbers, which are left
+ *  indeterminate; containers of such elements are available as
+ *  \p uninitialized_host_vector and \p uninitialized_universal_vector.
+ *
+ *  \tparam T The type of the elements allocated.
+ *  \tparam Base The allocator adapted. It is rebound to \p T, so that the
+ *          adaptor is correct however it is rebound itself.
+ *
+ *  \see https://en.cppreference.com/w/cpp/named_req/Allocator
+ */
+template <typename T, typename Base = std::allocator<T>>
+class uninitialized_allocator
+  : public thrust::detail::allocator_traits<Base>::template rebind_alloc<T>
+{
+public:
+  /*! The type of the adapted allocator, rebound to \p T.
+   */
+  using base_allocator_type =
+    typename thrust::detail::allocator_traits<Base>::template rebind_alloc<T>;
+
+  /*! The type of the elements allocated.
+   */
+  using value_type = T;
+
+  /*! Obtains the type of an \p uninitialized_allocator of elements of another
+   *  type.
+   */
+  template <typename U>
+  struct rebind
+  {
+    /*! The rebound allocator type.
+     */
+    using other = uninitialized_allocator<U, Base>;
+  };
+
+  /*! Constructs the adapted allocator with its default constructor.
+   */
+  uninitialized_allocator() = default;
+
+  /*! Adapts a copy of an allocator.
+   *  \param base The allocator to adapt.
+   */
+  uninitialized_allocator(const base_allocator_type &base)
+    : base_allocator_type(base)
+  {}
+
+  /*! Adapts a copy of the allocator adapted by another
+   *  \p uninitialized_allocator.
+   *  \param other The allocator to copy.
+   */
+  template <typename U, typename OtherBase>
+  uninitialized_allocator(const uninitialized_allocator<U, OtherBase> &other)
+    : base_allocator_type(
+        static_cast<const typename uninitialized_allocator<U, OtherBase>::base_allocator_type &>(other))
+  {}
+
+  /*! Default construction of an element, which does nothing. Construction
+   *  with arguments is not declared, so that it is done by placement new.
+   */
+  template <typename U>
+  THRUST_HOST_DEVICE
+  void construct(U *)
+  {
+    // no-op
+  }
+};
+
+/*! \}
+ */
+
+/*! \cond
+ */
+
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+// the adaptor destroys elements as the adapted allocator does
+template <typename U, typename Base, typename T>
+struct has_effectful_member_destroy<uninitialized_allocator<U, Base>, T>
+  : has_effectful_member_destroy<typename uninitialized_allocator<U, Base>::base_allocator_type, T>
+{};
+
+} // namespace allocator_traits_detail
+} // namespace detail
+
+/*! \endcond
+ */
+
+THRUST_NAMESPACE_END
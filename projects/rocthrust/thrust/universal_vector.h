@@ -23,6 +23,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/universal_allocator.h>
+#include <thrust/uninitialized_allocator.h>
 
 /*! \cond
  *  skip overloaded implementation
@@ -56,6 +57,16 @@ THRUST_NAMESPACE_BEGIN
  */
 using thrust::system::__THRUST_DEVICE_SYSTEM_NAMESPACE::universal_vector;
 
+/*! A \p universal_vector whose elements are left uninitialized when it is
+ *  created or resized without a value, for elements of trivially default
+ *  constructible types that are about to be overwritten.
+ *
+ *  \see uninitialized_allocator
+ */
+template <typename T>
+using uninitialized_universal_vector =
+  universal_vector<T, uninitialized_allocator<T, universal_allocator<T>>>;
+
 /*! \} // containers
  */
 